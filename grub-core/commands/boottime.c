@@ -18,48 +18,123 @@
 
 #include <grub/dl.h>
 #include <grub/misc.h>
-#include <grub/command.h>
+#include <grub/extcmd.h>
+#include <grub/time.h>
 #include <grub/i18n.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
+static const struct grub_arg_option options[] =
+  {
+    {"json", 'j', 0,
+     N_("Print the records as a Chrome trace (JSON) instead of a table."),
+     0, 0},
+    {0, 0, 0, 0, 0, 0}
+  };
+
+/* Open spans last until now.  */
+static grub_uint64_t
+span_end (const struct grub_boot_time *cur)
+{
+  return cur->end ? : grub_get_time_ms ();
+}
+
+static void
+print_json_string (const char *str)
+{
+  grub_printf ("\"");
+  for (; *str; str++)
+    {
+      if (*str == '"' || *str == '\\')
+	grub_printf ("\\%c", *str);
+      else if ((grub_uint8_t) *str < 0x20)
+	grub_printf ("\\u%04x", (grub_uint8_t) *str);
+      else
+	grub_printf ("%c", *str);
+    }
+  grub_printf ("\"");
+}
+
+/* Print the records in the Chrome trace event format, which trace viewers
+   can load directly.  Times there are in microseconds.  */
+static void
+print_json (grub_uint64_t start_time)
+{
+  struct grub_boot_time *cur;
+
+  grub_printf ("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+  for (cur = grub_boot_time_head; cur; cur = cur->next)
+    {
+      grub_printf ("{\"name\":");
+      print_json_string (cur->msg ? : "");
+      grub_printf (",\"cat\":\"grub\",\"pid\":1,\"tid\":1,\"ts\":%llu",
+		   (unsigned long long) (cur->tp - start_time) * 1000);
+      if (cur->is_span)
+	grub_printf (",\"ph\":\"X\",\"dur\":%llu",
+		     (unsigned long long) (span_end (cur) - cur->tp) * 1000);
+      else
+	grub_printf (",\"ph\":\"i\",\"s\":\"g\"");
+      grub_printf (",\"args\":{\"file\":");
+      print_json_string (cur->file);
+      grub_printf (",\"line\":%d}}%s\n", cur->line, cur->next ? "," : "");
+    }
+  grub_printf ("]}\n");
+}
 
 static grub_err_t
-grub_cmd_boottime (struct grub_command *cmd __attribute__ ((unused)),
+grub_cmd_boottime (grub_extcmd_context_t ctxt,
 		   int argc __attribute__ ((unused)),
 		   char *argv[] __attribute__ ((unused)))
 {
   struct grub_boot_time *cur;
   grub_uint64_t last_time = 0, start_time = 0;
+  int i;
+
   if (!grub_boot_time_head)
     {
       grub_puts_ (N_("No boot time statistics is available\n"));
       return 0;
     }
   start_time = last_time = grub_boot_time_head->tp;
+
+  if (ctxt->state[0].set)
+    {
+      print_json (start_time);
+      return 0;
+    }
+
   for (cur = grub_boot_time_head; cur; cur = cur->next)
     {
       grub_uint32_t tmabs = cur->tp - start_time;
       grub_uint32_t tmrel = cur->tp - last_time;
       last_time = cur->tp;
 
-      grub_printf ("%3d.%03ds %2d.%03ds %s:%d %s\n", 
-		   tmabs / 1000, tmabs % 1000, tmrel / 1000, tmrel % 1000, cur->file, cur->line,
-		   cur->msg);
+      grub_printf ("%3d.%03ds %2d.%03ds ",
+		   tmabs / 1000, tmabs % 1000, tmrel / 1000, tmrel % 1000);
+      for (i = 0; i < cur->depth; i++)
+	grub_printf ("  ");
+      grub_printf ("%s:%d %s", cur->file, cur->line, cur->msg);
+      if (cur->is_span)
+	{
+	  grub_uint32_t dur = span_end (cur) - cur->tp;
+	  grub_printf (" [%d.%03ds%s]", dur / 1000, dur % 1000,
+		       cur->end ? "" : ", open");
+	}
+      grub_printf ("\n");
     }
  return 0;
 }
 
-static grub_command_t cmd_boottime;
+static grub_extcmd_t cmd_boottime;
 
 GRUB_MOD_INIT(boottime)
 {
   cmd_boottime =
-    grub_register_command ("boottime", grub_cmd_boottime,
-			   0, N_("Show boot time statistics."));
+    grub_register_extcmd ("boottime", grub_cmd_boottime, 0, N_("[--json]"),
+			  N_("Show boot time statistics."), options);
 }
 
 GRUB_MOD_FINI(boottime)
 {
-  grub_unregister_command (cmd_boottime);
+  grub_unregister_extcmd (cmd_boottime);
 }
@@ -866,7 +866,7 @@ grub_cmd_verify_signature (grub_extcmd_context_t ctxt,
 static int sec = 0;
 
 static grub_err_t
-grub_pubkey_init (grub_file_t io, enum grub_file_type type __attribute__ ((unused)),
+grub_pubkey_init (grub_file_t io, enum grub_file_type type,
 		  void **context, enum grub_verify_flags *flags)
 {
   grub_file_t sig;
@@ -905,6 +905,17 @@ grub_pubkey_init (grub_file_t io, enum grub_file_type type __attribute__ ((unuse
       return err;
     }
   *context = ctxt;
+
+  /*
+   * The generic initrd loader reads initrds in full, front to back, before
+   * booting, so there is no need to keep a second copy of them just for
+   * hashing.  Only do this when no decompressor sits on top: gzio and xzio
+   * seek back to the start, and gzio to the end, while probing the file.
+   */
+  if ((type & GRUB_FILE_TYPE_MASK) == GRUB_FILE_TYPE_LINUX_INITRD
+      && (type & GRUB_FILE_TYPE_NO_DECOMPRESS))
+    *flags |= GRUB_VERIFY_FLAGS_STREAM;
+
   return GRUB_ERR_NONE;
 }
 
@@ -26,28 +26,153 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 struct grub_file_verifier *grub_file_verifiers;
 
+struct grub_verified_ctx
+{
+  struct grub_file_verifier *ver;
+  void *context;
+};
+
 struct grub_verified
 {
   grub_file_t file;
   void *buf;
+
+  /* Streaming mode: verifiers still being fed and how far they got.  */
+  int stream;
+  struct grub_verified_ctx *vers;
+  unsigned nvers;
+  grub_off_t fed;
 };
 typedef struct grub_verified *grub_verified_t;
 
+/* Size of the buffer used to feed data the consumer skipped over.  */
+#define VERIFIED_SKIP_SIZE 65536
+
+static void
+verified_close_contexts (grub_verified_t verified)
+{
+  unsigned i;
+
+  for (i = 0; i < verified->nvers; i++)
+    if (verified->vers[i].ver->close)
+      verified->vers[i].ver->close (verified->vers[i].context);
+  grub_free (verified->vers);
+  verified->vers = NULL;
+  verified->nvers = 0;
+}
+
 static void
 verified_free (grub_verified_t verified)
 {
   if (verified)
     {
+      verified_close_contexts (verified);
       grub_free (verified->buf);
       grub_free (verified);
     }
 }
 
+/* Pass the next LEN bytes of the file to every verifier, and once the
+   whole file went through, get their verdict.  */
+static grub_err_t
+verified_feed (grub_verified_t verified, grub_file_t file, void *buf,
+	       grub_size_t len)
+{
+  grub_err_t err;
+  unsigned i;
+
+  for (i = 0; i < verified->nvers; i++)
+    {
+      err = verified->vers[i].ver->write (verified->vers[i].context, buf, len);
+      if (err)
+	return err;
+    }
+  verified->fed += len;
+
+  if (verified->fed < file->size)
+    return GRUB_ERR_NONE;
+
+  for (i = 0; i < verified->nvers; i++)
+    {
+      struct grub_file_verifier *ver = verified->vers[i].ver;
+
+      err = ver->fini ? ver->fini (verified->vers[i].context) : GRUB_ERR_NONE;
+      if (err)
+	return err;
+    }
+  verified_close_contexts (verified);
+  grub_dprintf ("verify", "file: %s verified while streaming\n", file->name);
+  return GRUB_ERR_NONE;
+}
+
+static grub_ssize_t
+verified_stream_read (struct grub_file *file, char *buf, grub_size_t len)
+{
+  grub_verified_t verified = file->data;
+  grub_ssize_t r;
+
+  /* Anything read twice or after the verdict would go unchecked.  */
+  if (file->offset < verified->fed || !verified->vers)
+    {
+      grub_error (GRUB_ERR_ACCESS_DENIED,
+		  N_("verified file %s must be read sequentially"),
+		  file->name);
+      return -1;
+    }
+
+  /* The consumer skipped some data, the verifiers still need it.  */
+  if (file->offset > verified->fed)
+    {
+      char *skip;
+
+      skip = grub_malloc (VERIFIED_SKIP_SIZE);
+      if (!skip)
+	return -1;
+      grub_file_seek (verified->file, verified->fed);
+      while (verified->fed < file->offset)
+	{
+	  grub_size_t n = VERIFIED_SKIP_SIZE;
+
+	  if (n > file->offset - verified->fed)
+	    n = file->offset - verified->fed;
+	  if (grub_file_read (verified->file, skip, n) != (grub_ssize_t) n
+	      || verified_feed (verified, file, skip, n))
+	    {
+	      grub_free (skip);
+	      if (!grub_errno)
+		grub_error (GRUB_ERR_FILE_READ_ERROR,
+			    N_("premature end of file %s"), file->name);
+	      return -1;
+	    }
+	}
+      grub_free (skip);
+    }
+
+  grub_file_seek (verified->file, file->offset);
+  r = grub_file_read (verified->file, buf, len);
+  if (r != (grub_ssize_t) len)
+    {
+      if (!grub_errno)
+	grub_error (GRUB_ERR_FILE_READ_ERROR, N_("premature end of file %s"),
+		    file->name);
+      return -1;
+    }
+
+  /* Hash exactly the bytes the consumer gets.  */
+  if (verified_feed (verified, file, buf, len))
+    return -1;
+
+  return len;
+}
+
 static grub_ssize_t
 verified_read (struct grub_file *file, char *buf, grub_size_t len)
 {
   grub_verified_t verified = file->data;
 
+  if (verified->stream)
+    return verified_stream_read (file, buf, len);
+
   grub_memcpy (buf, (char *) verified->buf + file->offset, len);
   return len;
 }
@@ -57,6 +182,11 @@ verified_close (struct grub_file *file)
 {
   grub_verified_t verified = file->data;
 
+  /* Don't hide the error that made the caller give up early.  */
+  if (verified->stream && verified->vers && grub_errno == GRUB_ERR_NONE)
+    grub_error (GRUB_ERR_ACCESS_DENIED,
+		N_("%s was closed before it could be verified"), file->name);
+
   grub_file_close (verified->file);
   verified_free (verified);
   file->data = 0;
@@ -84,6 +214,8 @@ grub_verifiers_open (grub_file_t io, enum grub_file_type type)
   grub_file_t ret = 0;
   grub_err_t err;
   int defer = 0;
+  int stream;
+  unsigned i;
 
   grub_dprintf ("verify", "file: %s type: %d\n", io->name, type);
 
@@ -109,7 +241,10 @@ grub_verifiers_open (grub_file_t io, enum grub_file_type type)
 	  continue;
 	}
       if (!(flags & GRUB_VERIFY_FLAGS_SKIP_VERIFICATION))
-	break;
+	{
+	  stream = !!(flags & GRUB_VERIFY_FLAGS_STREAM);
+	  break;
+	}
     }
 
   if (!ver)
@@ -125,78 +260,105 @@ grub_verifiers_open (grub_file_t io, enum grub_file_type type)
       return io;
     }
 
-  ret = grub_malloc (sizeof (*ret));
-  if (!ret)
+  verified = grub_zalloc (sizeof (*verified));
+  if (!verified)
+    goto fail;
+  verified->vers = grub_malloc (sizeof (verified->vers[0]));
+  if (!verified->vers)
+    goto fail;
+  verified->vers[0].ver = ver;
+  verified->vers[0].context = context;
+  verified->nvers = 1;
+
+  FOR_LIST_ELEMENTS_NEXT(ver, grub_file_verifiers)
     {
-      goto fail;
+      enum grub_verify_flags flags = 0;
+      struct grub_verified_ctx *vers;
+
+      err = ver->init (io, type, &context, &flags);
+      if (err)
+	goto fail_noclose;
+      if (flags & GRUB_VERIFY_FLAGS_SKIP_VERIFICATION ||
+	  /* Verification done earlier. So, we are happy here. */
+	  flags & GRUB_VERIFY_FLAGS_DEFER_AUTH)
+	continue;
+      if (!(flags & GRUB_VERIFY_FLAGS_STREAM))
+	stream = 0;
+
+      vers = grub_realloc (verified->vers, sizeof (vers[0])
+			   * (verified->nvers + 1));
+      if (!vers)
+	goto fail;
+      verified->vers = vers;
+      verified->vers[verified->nvers].ver = ver;
+      verified->vers[verified->nvers].context = context;
+      verified->nvers++;
     }
+
+  ret = grub_malloc (sizeof (*ret));
+  if (!ret)
+    goto fail_noclose;
   *ret = *io;
 
   ret->fs = &verified_fs;
   ret->not_easily_seekable = 0;
+  /* Readers of IO's mapping would see data that was never verified.  */
+  ret->mapped = 0;
+
+  if (stream && ret->size)
+    {
+      /* Only forward reads work.  Not every consumer checks this (gzio
+	 doesn't), so verifiers must only ask for streaming where the
+	 reader is known to go front to back.  */
+      ret->not_easily_seekable = 1;
+      verified->stream = 1;
+      verified->file = io;
+      ret->data = verified;
+      return ret;
+    }
+
   if (ret->size >> (sizeof (grub_size_t) * GRUB_CHAR_BIT - 1))
     {
       grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
 		  N_("big file signature isn't implemented yet"));
-      goto fail;
-    }
-  verified = grub_malloc (sizeof (*verified));
-  if (!verified)
-    {
-      goto fail;
+      goto fail_noclose;
     }
   verified->buf = grub_malloc (ret->size);
   if (!verified->buf)
     {
-      goto fail;
+      goto fail_noclose;
     }
   if (grub_file_read (io, verified->buf, ret->size) != (grub_ssize_t) ret->size)
     {
       if (!grub_errno)
 	grub_error (GRUB_ERR_FILE_READ_ERROR, N_("premature end of file %s"),
 		    io->name);
-      goto fail;
+      goto fail_noclose;
     }
 
-  err = ver->write (context, verified->buf, ret->size);
-  if (err)
-    goto fail;
-
-  err = ver->fini ? ver->fini (context) : GRUB_ERR_NONE;
-  if (err)
-    goto fail;
-
-  if (ver->close)
-    ver->close (context);
-
-  FOR_LIST_ELEMENTS_NEXT(ver, grub_file_verifiers)
+  for (i = 0; i < verified->nvers; i++)
     {
-      enum grub_verify_flags flags = 0;
-      err = ver->init (io, type, &context, &flags);
-      if (err)
-	goto fail_noclose;
-      if (flags & GRUB_VERIFY_FLAGS_SKIP_VERIFICATION ||
-	  /* Verification done earlier. So, we are happy here. */
-	  flags & GRUB_VERIFY_FLAGS_DEFER_AUTH)
-	continue;
+      ver = verified->vers[i].ver;
+      context = verified->vers[i].context;
+
       err = ver->write (context, verified->buf, ret->size);
       if (err)
-	goto fail;
+	goto fail_noclose;
 
       err = ver->fini ? ver->fini (context) : GRUB_ERR_NONE;
       if (err)
-	goto fail;
-
-      if (ver->close)
-	ver->close (context);
+	goto fail_noclose;
     }
+  verified_close_contexts (verified);
 
   verified->file = io;
   ret->data = verified;
+  ret->mapped = verified->buf;
   return ret;
 
  fail:
-  ver->close (context);
+  if (ver->close)
+    ver->close (context);
  fail_noclose:
   verified_free (verified);
   grub_free (ret);
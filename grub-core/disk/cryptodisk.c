@@ -104,6 +104,21 @@ gf_mul_be (grub_uint8_t *o, const grub_uint8_t *a, const grub_uint8_t *b)
     }
 }
 
+/* XOR every block of a sector with its XTS tweak, starting at TWEAK.  */
+static void
+xts_xor (const struct grub_cryptodisk *dev, grub_uint8_t *b,
+	 grub_uint8_t *tweak)
+{
+  unsigned j;
+
+  for (j = 0; j < (1U << dev->log_sector_size);
+       j += dev->cipher->cipher->blocksize)
+    {
+      grub_crypto_xor (b + j, b + j, tweak, dev->cipher->cipher->blocksize);
+      gf_mul_x (tweak);
+    }
+}
+
 static gcry_err_code_t
 grub_crypto_pcbc_decrypt (grub_crypto_cipher_handle_t cipher,
 			 void *out, void *in, grub_size_t size,
@@ -331,31 +346,30 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 	  break;
 	case GRUB_CRYPTODISK_MODE_XTS:
 	  {
-	    unsigned j;
+	    grub_uint32_t tweak[(GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE + 3) / 4];
+
 	    err = grub_crypto_ecb_encrypt (dev->secondary_cipher, iv, iv,
 					   dev->cipher->cipher->blocksize);
 	    if (err)
 	      return err;
-	    
-	    for (j = 0; j < (1U << dev->log_sector_size);
-		 j += dev->cipher->cipher->blocksize)
-	      {
-		grub_crypto_xor (data + i + j, data + i + j, iv,
-				 dev->cipher->cipher->blocksize);
-		if (do_encrypt)
-		  err = grub_crypto_ecb_encrypt (dev->cipher, data + i + j, 
-						 data + i + j,
-						 dev->cipher->cipher->blocksize);
-		else
-		  err = grub_crypto_ecb_decrypt (dev->cipher, data + i + j, 
-						 data + i + j,
-						 dev->cipher->cipher->blocksize);
-		if (err)
-		  return err;
-		grub_crypto_xor (data + i + j, data + i + j, iv,
-				 dev->cipher->cipher->blocksize);
-		gf_mul_x ((grub_uint8_t *) iv);
-	      }
+
+	    /* The blocks of a sector only depend on each other through
+	       the tweak, so whiten the whole sector, run the cipher over
+	       it in one go and whiten it again.  Recomputing the tweaks is
+	       cheaper than storing them.  */
+	    grub_memcpy (tweak, iv, sizeof (tweak));
+	    xts_xor (dev, data + i, (grub_uint8_t *) tweak);
+	    if (do_encrypt)
+	      err = grub_crypto_ecb_encrypt (dev->cipher, data + i,
+					     data + i,
+					     (1U << dev->log_sector_size));
+	    else
+	      err = grub_crypto_ecb_decrypt (dev->cipher, data + i,
+					     data + i,
+					     (1U << dev->log_sector_size));
+	    if (err)
+	      return err;
+	    xts_xor (dev, data + i, (grub_uint8_t *) iv);
 	  }
 	  break;
 	case GRUB_CRYPTODISK_MODE_LRW:
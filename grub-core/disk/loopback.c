@@ -33,6 +33,8 @@ struct grub_loopback
   grub_file_t file;
   struct grub_loopback *next;
   unsigned long id;
+  /* Read through the disk cache even if the file is in memory.  */
+  int no_map;
 };
 
 static struct grub_loopback *loopback_list;
@@ -43,6 +45,9 @@ static const struct grub_arg_option options[] =
     /* TRANSLATORS: The disk is simply removed from the list of available ones,
        not wiped, avoid to scare user.  */
     {"delete", 'd', 0, N_("Delete the specified loopback drive."), 0, 0},
+    {"no-map", 'n', 0,
+     N_("Don't read a file that is in memory directly, go through the"
+	" disk cache like for any other disk."), 0, 0},
     {0, 0, 0, 0, 0, 0}
   };
 
@@ -106,6 +111,7 @@ grub_cmd_loopback (grub_extcmd_context_t ctxt, int argc, char **args)
     {
       grub_file_close (newdev->file);
       newdev->file = file;
+      newdev->no_map = state[1].set;
 
       return 0;
     }
@@ -124,6 +130,7 @@ grub_cmd_loopback (grub_extcmd_context_t ctxt, int argc, char **args)
 
   newdev->file = file;
   newdev->id = last_id++;
+  newdev->no_map = state[1].set;
 
   /* Add the new entry to the list.  */
   newdev->next = loopback_list;
@@ -179,6 +186,13 @@ grub_loopback_open (const char *name, grub_disk_t disk)
 
   disk->data = dev;
 
+  /* A file that is already in memory needs neither reads nor caching.  */
+  if (dev->file->mapped && ! dev->no_map)
+    {
+      disk->mapped = dev->file->mapped;
+      disk->mapped_size = dev->file->size;
+    }
+
   return 0;
 }
 
@@ -234,7 +248,7 @@ static grub_extcmd_t cmd;
 GRUB_MOD_INIT(loopback)
 {
   cmd = grub_register_extcmd ("loopback", grub_cmd_loopback, 0,
-			      N_("[-d] DEVICENAME FILE."),
+			      N_("[-d|-n] DEVICENAME FILE."),
 			      /* TRANSLATORS: The file itself is not destroyed
 				 or transformed into drive.  */
 			      N_("Make a virtual drive from a file."), options);
@@ -48,6 +48,8 @@ grub_memdisk_open (const char *name, grub_disk_t disk)
   disk->total_sectors = memdisk_size / GRUB_DISK_SECTOR_SIZE;
   disk->max_agglomerate = GRUB_DISK_MAX_MAX_AGGLOMERATE;
   disk->id = 0;
+  disk->mapped = memdisk_addr;
+  disk->mapped_size = memdisk_size;
 
   return GRUB_ERR_NONE;
 }
@@ -55,6 +55,19 @@ struct char_index_entry
 #define FONT_WEIGHT_BOLD 200
 #define ASCII_BITMAP_SIZE 16
 
+/* Fonts up to this size are read into memory in one go when loaded, and
+   their glyphs are then decoded from that copy without any further I/O.
+   Bigger fonts are read through a small buffer as glyphs are needed.  */
+#define FONT_PRELOAD_MAX_SIZE (16 << 20)
+
+/* Geometry of the two-level BMP index.  */
+#define FONT_BMP_PAGE_SHIFT 8
+#define FONT_BMP_PAGE_SIZE (1 << FONT_BMP_PAGE_SHIFT)
+#define FONT_BMP_NUM_PAGES (0x10000 >> FONT_BMP_PAGE_SHIFT)
+
+/* Size in bytes of the fixed glyph header preceding each bitmap.  */
+#define FONT_GLYPH_HEADER_SIZE (5 * 2)
+
 /* Definition of font registry.  */
 struct grub_font_node *grub_font_list;
 
@@ -65,8 +78,8 @@ static void remove_font (grub_font_t font);
 
 struct font_file_section
 {
-  /* The file this section is in.  */
-  grub_file_t file;
+  /* The font whose file this section is in.  */
+  grub_font_t font;
 
   /* FOURCC name of the section.  */
   char name[4];
@@ -206,6 +219,64 @@ font_init (grub_font_t font)
   font->num_chars = 0;
   font->char_index = 0;
   font->bmp_idx = 0;
+  font->data = 0;
+  font->data_size = 0;
+  font->data_offset = 0;
+}
+
+/* Read LEN bytes at the current position of FONT's file into BUF, either
+   from the preloaded copy or from the file itself.  */
+static grub_ssize_t
+font_read (grub_font_t font, void *buf, grub_size_t len)
+{
+  if (!font->data)
+    return grub_file_read (font->file, buf, len);
+
+  if (len > font->data_size - font->data_offset)
+    len = font->data_size - font->data_offset;
+  grub_memcpy (buf, font->data + font->data_offset, len);
+  font->data_offset += len;
+  return len;
+}
+
+/* Return a pointer to the next LEN bytes of the preloaded font file and
+   advance past them.  Returns NULL if the font is not preloaded or if
+   fewer than LEN bytes are left.  */
+static const grub_uint8_t *
+font_map (grub_font_t font, grub_size_t len)
+{
+  const grub_uint8_t *ptr;
+
+  if (!font->data || len > font->data_size - font->data_offset)
+    return NULL;
+
+  ptr = font->data + font->data_offset;
+  font->data_offset += len;
+  return ptr;
+}
+
+static grub_off_t
+font_tell (grub_font_t font)
+{
+  if (!font->data)
+    return grub_file_tell (font->file);
+  return font->data_offset;
+}
+
+static grub_off_t
+font_seek (grub_font_t font, grub_off_t offset)
+{
+  if (!font->data)
+    return grub_file_seek (font->file, offset);
+
+  if (offset > font->data_size)
+    {
+      grub_error (GRUB_ERR_OUT_OF_RANGE,
+		  N_("attempt to seek outside of the file"));
+      return -1;
+    }
+  font->data_offset = offset;
+  return offset;
 }
 
 /* Open the next section in the file.
@@ -217,16 +288,16 @@ font_init (grub_font_t font)
    If 1 is returned due to being at the end of the file, then section->eof is
    set to 1; otherwise, section->eof is set to 0.  */
 static int
-open_section (grub_file_t file, struct font_file_section *section)
+open_section (grub_font_t font, struct font_file_section *section)
 {
   grub_ssize_t retval;
   grub_uint32_t raw_length;
 
-  section->file = file;
+  section->font = font;
   section->eof = 0;
 
   /* Read the FOURCC section name.  */
-  retval = grub_file_read (file, section->name, 4);
+  retval = font_read (font, section->name, 4);
   if (retval >= 0 && retval < 4)
     {
       /* EOF encountered.  */
@@ -240,7 +311,7 @@ open_section (grub_file_t file, struct font_file_section *section)
     }
 
   /* Read the big-endian 32-bit section length.  */
-  retval = grub_file_read (file, &raw_length, 4);
+  retval = font_read (font, &raw_length, 4);
   if (retval >= 0 && retval < 4)
     {
       /* EOF encountered.  */
@@ -264,16 +335,19 @@ open_section (grub_file_t file, struct font_file_section *section)
 #define FONT_CHAR_INDEX_ENTRY_SIZE (4 + 1 + 4)
 
 /* Load the character index (CHIX) section contents from the font file.  This
-   presumes that the position of FILE is positioned immediately after the
-   section length for the CHIX section (i.e., at the start of the section
-   contents).  Returns 0 upon success, nonzero for failure (in which case
-   grub_errno is set appropriately).  */
+   presumes that the position of FONT's file is positioned immediately after
+   the section length for the CHIX section (i.e., at the start of the section
+   contents).  The whole section is fetched at once and then decoded.
+   Returns 0 upon success, nonzero for failure (in which case grub_errno is
+   set appropriately).  */
 static int
-load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
-		 grub_font *font)
+load_font_index (grub_font_t font, grub_uint32_t sect_length)
 {
   unsigned i;
   grub_uint32_t last_code;
+  const grub_uint8_t *ptr;
+  grub_uint8_t *buf = 0;
+  int ret = 1;
 
 #if FONT_DEBUG >= 2
   grub_dprintf ("font", "load_font_index(sect_length=%d)\n", sect_length);
@@ -297,11 +371,22 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 				  * sizeof (struct char_index_entry));
   if (!font->char_index)
     return 1;
-  font->bmp_idx = grub_malloc (0x10000 * sizeof (grub_uint16_t));
+  font->bmp_idx = grub_zalloc (FONT_BMP_NUM_PAGES
+			       * sizeof (font->bmp_idx[0]));
   if (!font->bmp_idx)
     return 1;
-  grub_memset (font->bmp_idx, 0xff, 0x10000 * sizeof (grub_uint16_t));
 
+  /* Get the raw index in one piece rather than reading it entry by entry.  */
+  ptr = font_map (font, sect_length);
+  if (!ptr)
+    {
+      buf = grub_malloc (sect_length);
+      if (!buf)
+	return 1;
+      if (font_read (font, buf, sect_length) != (grub_ssize_t) sect_length)
+	goto out;
+      ptr = buf;
+    }
 
 #if FONT_DEBUG >= 2
   grub_dprintf ("font", "num_chars=%d)\n", font->num_chars);
@@ -309,15 +394,15 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 
   last_code = 0;
 
-  /* Load the character index data from the file.  */
-  for (i = 0; i < font->num_chars; i++)
+  /* Decode the character index data.  */
+  for (i = 0; i < font->num_chars; i++, ptr += FONT_CHAR_INDEX_ENTRY_SIZE)
     {
       struct char_index_entry *entry = &font->char_index[i];
 
-      /* Read code point value; convert to native byte order.  */
-      if (grub_file_read (file, &entry->code, 4) != 4)
-	return 1;
-      entry->code = grub_be_to_cpu32 (entry->code);
+      /* Code point value, storage flags byte and glyph data offset.  */
+      entry->code = grub_be_to_cpu32 (grub_get_unaligned32 (ptr));
+      entry->storage_flags = ptr[4];
+      entry->offset = grub_be_to_cpu32 (grub_get_unaligned32 (ptr + 5));
 
       /* Verify that characters are in ascending order.  */
       if (i != 0 && entry->code <= last_code)
@@ -325,22 +410,26 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 	  grub_error (GRUB_ERR_BAD_FONT,
 		      "font characters not in ascending order: %u <= %u",
 		      entry->code, last_code);
-	  return 1;
+	  goto out;
 	}
 
       if (entry->code < 0x10000)
-	font->bmp_idx[entry->code] = i;
-
-      last_code = entry->code;
+	{
+	  grub_uint16_t **page;
 
-      /* Read storage flags byte.  */
-      if (grub_file_read (file, &entry->storage_flags, 1) != 1)
-	return 1;
+	  page = &font->bmp_idx[entry->code >> FONT_BMP_PAGE_SHIFT];
+	  if (!*page)
+	    {
+	      *page = grub_malloc (FONT_BMP_PAGE_SIZE * sizeof (grub_uint16_t));
+	      if (!*page)
+		goto out;
+	      grub_memset (*page, 0xff,
+			   FONT_BMP_PAGE_SIZE * sizeof (grub_uint16_t));
+	    }
+	  (*page)[entry->code & (FONT_BMP_PAGE_SIZE - 1)] = i;
+	}
 
-      /* Read glyph data offset; convert to native byte order.  */
-      if (grub_file_read (file, &entry->offset, 4) != 4)
-	return 1;
-      entry->offset = grub_be_to_cpu32 (entry->offset);
+      last_code = entry->code;
 
       /* No glyph loaded.  Will be loaded on demand and cached thereafter.  */
       entry->glyph = 0;
@@ -352,7 +441,11 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 #endif
     }
 
-  return 0;
+  ret = 0;
+
+ out:
+  grub_free (buf);
+  return ret;
 }
 
 /* Read the contents of the specified section as a string, which is
@@ -367,7 +460,7 @@ read_section_as_string (struct font_file_section *section)
   if (!str)
     return 0;
 
-  ret = grub_file_read (section->file, str, section->length);
+  ret = font_read (section->font, str, section->length);
   if (ret < 0 || ret != (grub_ssize_t) section->length)
     {
       grub_free (str);
@@ -396,7 +489,7 @@ read_section_as_short (struct font_file_section *section,
 		  section->name[2], section->name[3], section->length);
       return 1;
     }
-  if (grub_file_read (section->file, &raw_value, 2) != 2)
+  if (font_read (section->font, &raw_value, 2) != 2)
     return 1;
 
   *value = grub_be_to_cpu16 (raw_value);
@@ -418,7 +511,7 @@ grub_font_load (const char *filename)
 #endif
 
   if (filename[0] == '(' || filename[0] == '/' || filename[0] == '+')
-    file = grub_buffile_open (filename, GRUB_FILE_TYPE_FONT, 1024);
+    file = grub_file_open (filename, GRUB_FILE_TYPE_FONT);
   else
     {
       const char *prefix = grub_env_get ("prefix");
@@ -438,18 +531,55 @@ grub_font_load (const char *filename)
       ptr = grub_stpcpy (ptr, filename);
       ptr = grub_stpcpy (ptr, ".pf2");
       *ptr = 0;
-      file = grub_buffile_open (fullname, GRUB_FILE_TYPE_FONT, 1024);
+      file = grub_file_open (fullname, GRUB_FILE_TYPE_FONT);
       grub_free (fullname);
     }
   if (!file)
     goto fail;
 
+  /* Allocate the font object.  */
+  font = (grub_font_t) grub_zalloc (sizeof (struct grub_font));
+  if (!font)
+    goto fail;
+
+  font_init (font);
+
+  if (file->size != GRUB_FILE_SIZE_UNKNOWN
+      && file->size <= FONT_PRELOAD_MAX_SIZE)
+    {
+      /* Read the whole font with a single request.  If there isn't enough
+	 memory for that, fall back to reading glyphs on demand.  */
+      font->data = grub_malloc (file->size);
+      if (font->data)
+	{
+	  font->data_size = file->size;
+	  if (grub_file_read (file, font->data, font->data_size)
+	      != (grub_ssize_t) font->data_size)
+	    goto fail;
+	  grub_file_close (file);
+	  file = 0;
+	}
+      else
+	grub_errno = GRUB_ERR_NONE;
+    }
+
+  if (file)
+    {
+      grub_file_t buffile;
+
+      buffile = grub_bufio_open (file, 1024);
+      if (!buffile)
+	goto fail;
+      file = buffile;
+      font->file = file;
+    }
+
 #if FONT_DEBUG >= 3
   grub_dprintf ("font", "file opened\n");
 #endif
 
   /* Read the FILE section.  It indicates the file format.  */
-  if (open_section (file, &section) != 0)
+  if (open_section (font, &section) != 0)
     goto fail;
 
 #if FONT_DEBUG >= 3
@@ -478,7 +608,7 @@ grub_font_load (const char *filename)
   grub_dprintf ("font", "section length ok\n");
 #endif
   /* Check the file format type code.  */
-  if (grub_file_read (file, magic, 4) != 4)
+  if (font_read (font, magic, 4) != 4)
     goto fail;
 
 #if FONT_DEBUG >= 3
@@ -493,25 +623,13 @@ grub_font_load (const char *filename)
     }
 
 #if FONT_DEBUG >= 3
-  grub_dprintf ("font", "compare magic ok\n");
-#endif
-
-  /* Allocate the font object.  */
-  font = (grub_font_t) grub_zalloc (sizeof (struct grub_font));
-  if (!font)
-    goto fail;
-
-  font_init (font);
-  font->file = file;
-
-#if FONT_DEBUG >= 3
-  grub_dprintf ("font", "allocate font ok; loading font info\n");
+  grub_dprintf ("font", "compare magic ok; loading font info\n");
 #endif
 
   /* Load the font information.  */
   while (1)
     {
-      if (open_section (file, &section) != 0)
+      if (open_section (font, &section) != 0)
 	{
 	  if (section.eof)
 	    break;		/* Done reading the font file.  */
@@ -591,7 +709,7 @@ grub_font_load (const char *filename)
 			    sizeof (FONT_FORMAT_SECTION_NAMES_CHAR_INDEX) -
 			    1) == 0)
 	{
-	  if (load_font_index (file, section.length, font) != 0)
+	  if (load_font_index (font, section.length) != 0)
 	    goto fail;
 	}
       else if (grub_memcmp (section.name, FONT_FORMAT_SECTION_NAMES_DATA,
@@ -606,8 +724,8 @@ grub_font_load (const char *filename)
 #if FONT_DEBUG >= 3
 	  grub_dprintf ("font", "Unhandled section type, skipping.\n");
 #endif
-	  grub_off_t section_end = grub_file_tell (file) + section.length;
-	  if ((int) grub_file_seek (file, section_end) == -1)
+	  grub_off_t section_end = font_tell (font) + section.length;
+	  if ((int) font_seek (font, section_end) == -1)
 	    goto fail;
 	}
     }
@@ -652,25 +770,6 @@ fail:
   return 0;
 }
 
-/* Read a 16-bit big-endian integer from FILE, convert it to native byte
-   order, and store it in *VALUE.
-   Returns 0 on success, 1 on failure.  */
-static int
-read_be_uint16 (grub_file_t file, grub_uint16_t * value)
-{
-  if (grub_file_read (file, value, 2) != 2)
-    return 1;
-  *value = grub_be_to_cpu16 (*value);
-  return 0;
-}
-
-static int
-read_be_int16 (grub_file_t file, grub_int16_t * value)
-{
-  /* For the signed integer version, use the same code as for unsigned.  */
-  return read_be_uint16 (file, (grub_uint16_t *) value);
-}
-
 /* Return a pointer to the character index entry for the glyph corresponding to
    the codepoint CODE in the font FONT.  If not found, return zero.  */
 static inline struct char_index_entry *
@@ -686,9 +785,11 @@ find_glyph (const grub_font_t font, grub_uint32_t code)
   /* Use BMP index if possible.  */
   if (code < 0x10000 && font->bmp_idx)
     {
-      if (font->bmp_idx[code] == 0xffff)
+      grub_uint16_t *page = font->bmp_idx[code >> FONT_BMP_PAGE_SHIFT];
+
+      if (!page || page[code & (FONT_BMP_PAGE_SIZE - 1)] == 0xffff)
 	return 0;
-      return &table[font->bmp_idx[code]];
+      return &table[page[code & (FONT_BMP_PAGE_SIZE - 1)]];
     }
 
   /* Do a binary search in `char_index', which is ordered by code point.  */
@@ -729,13 +830,14 @@ grub_font_get_glyph_internal (grub_font_t font, grub_uint32_t code)
       grub_int16_t xoff;
       grub_int16_t yoff;
       grub_int16_t dwidth;
+      grub_uint8_t header[FONT_GLYPH_HEADER_SIZE];
       int len;
 
       if (index_entry->glyph)
 	/* Return cached glyph.  */
 	return index_entry->glyph;
 
-      if (!font->file)
+      if (!font->file && !font->data)
 	/* No open file, can't load any glyphs.  */
 	return 0;
 
@@ -743,19 +845,20 @@ grub_font_get_glyph_internal (grub_font_t font, grub_uint32_t code)
          error message to error stack and reset error message.  */
       grub_error_push ();
 
-      grub_file_seek (font->file, index_entry->offset);
-
-      /* Read the glyph width, height, and baseline.  */
-      if (read_be_uint16 (font->file, &width) != 0
-	  || read_be_uint16 (font->file, &height) != 0
-	  || read_be_int16 (font->file, &xoff) != 0
-	  || read_be_int16 (font->file, &yoff) != 0
-	  || read_be_int16 (font->file, &dwidth) != 0)
+      /* Read the glyph width, height, and baseline in one go.  */
+      if (font_seek (font, index_entry->offset) == (grub_off_t) -1
+	  || font_read (font, header, sizeof (header)) != sizeof (header))
 	{
 	  remove_font (font);
 	  return 0;
 	}
 
+      width = grub_be_to_cpu16 (grub_get_unaligned16 (header));
+      height = grub_be_to_cpu16 (grub_get_unaligned16 (header + 2));
+      xoff = grub_be_to_cpu16 (grub_get_unaligned16 (header + 4));
+      yoff = grub_be_to_cpu16 (grub_get_unaligned16 (header + 6));
+      dwidth = grub_be_to_cpu16 (grub_get_unaligned16 (header + 8));
+
       len = (width * height + 7) / 8;
       glyph = grub_malloc (sizeof (struct grub_font_glyph) + len);
       if (!glyph)
@@ -774,7 +877,7 @@ grub_font_get_glyph_internal (grub_font_t font, grub_uint32_t code)
       /* Don't try to read empty bitmaps (e.g., space characters).  */
       if (len != 0)
 	{
-	  if (grub_file_read (font->file, glyph->bitmap, len) != len)
+	  if (font_read (font, glyph->bitmap, len) != len)
 	    {
 	      remove_font (font);
 	      grub_free (glyph);
@@ -808,7 +911,15 @@ free_font (grub_font_t font)
       grub_free (font->name);
       grub_free (font->family);
       grub_free (font->char_index);
-      grub_free (font->bmp_idx);
+      if (font->bmp_idx)
+	{
+	  unsigned i;
+
+	  for (i = 0; i < FONT_BMP_NUM_PAGES; i++)
+	    grub_free (font->bmp_idx[i]);
+	  grub_free (font->bmp_idx);
+	}
+      grub_free (font->data);
       grub_free (font);
     }
 }
@@ -80,7 +80,10 @@ struct grub_btrfs_superblock
   grub_uint64_t chunk_tree;
   grub_uint8_t dummy2[0x20];
   grub_uint64_t root_dir_objectid;
-  grub_uint8_t dummy3[0x41];
+  grub_uint64_t num_devices;
+  grub_uint32_t sectorsize;
+  grub_uint32_t nodesize;
+  grub_uint8_t dummy3[0x31];
   struct grub_btrfs_device this_device;
   char label[0x100];
   grub_uint8_t dummy4[0x100];
@@ -92,7 +95,9 @@ struct btrfs_header
   grub_btrfs_checksum_t checksum;
   grub_btrfs_uuid_t uuid;
   grub_uint64_t bytenr;
-  grub_uint8_t dummy[0x28];
+  grub_uint8_t dummy[0x18];
+  grub_uint64_t generation;
+  grub_uint64_t owner;
   grub_uint32_t nitems;
   grub_uint8_t level;
 } GRUB_PACKED;
@@ -103,6 +108,45 @@ struct grub_btrfs_device_desc
   grub_uint64_t id;
 };
 
+struct grub_btrfs_leaf_descriptor
+{
+  unsigned depth;
+  unsigned allocated;
+  struct
+  {
+    grub_disk_addr_t addr;
+    unsigned iter;
+    unsigned maxiter;
+    int leaf;
+  } *data;
+};
+
+/* Number of tree nodes kept per mount.  */
+#define GRUB_BTRFS_NODE_CACHE_SIZE 32
+
+struct grub_btrfs_node_cache_entry
+{
+  grub_disk_addr_t addr;
+  grub_uint64_t generation;
+  grub_uint8_t *node;
+  grub_uint64_t last_use;
+};
+
+/* Memory budget for decompressed extents kept per mount.  */
+#define GRUB_BTRFS_EXTENT_CACHE_BUDGET (1024 * 1024)
+#define GRUB_BTRFS_EXTENT_CACHE_ENTRIES 16
+
+struct grub_btrfs_extent_cache_entry
+{
+  grub_uint64_t laddr;
+  grub_uint8_t compression;
+  /* Number of valid decompressed bytes in buf and its allocated size.  */
+  grub_size_t size;
+  grub_size_t alloc;
+  char *buf;
+  grub_uint64_t last_use;
+};
+
 struct grub_btrfs_data
 {
   struct grub_btrfs_superblock sblock;
@@ -113,6 +157,11 @@ struct grub_btrfs_data
   unsigned n_devices_attached;
   unsigned n_devices_allocated;
 
+  /* Recently read tree nodes, least recently used evicted.  */
+  grub_uint32_t nodesize;
+  struct grub_btrfs_node_cache_entry node_cache[GRUB_BTRFS_NODE_CACHE_SIZE];
+  grub_uint64_t node_cache_tick;
+
   /* Cached extent data.  */
   grub_uint64_t extstart;
   grub_uint64_t extend;
@@ -120,6 +169,14 @@ struct grub_btrfs_data
   grub_uint64_t exttree;
   grub_size_t extsize;
   struct grub_btrfs_extent_data *extent;
+  /* Position of the cached extent item, to step to the next one.  */
+  struct grub_btrfs_leaf_descriptor extdesc;
+
+  /* Fully decompressed regular extents, least recently used evicted.  */
+  struct grub_btrfs_extent_cache_entry
+    extent_cache[GRUB_BTRFS_EXTENT_CACHE_ENTRIES];
+  grub_size_t extent_cache_size;
+  grub_uint64_t extent_cache_tick;
 };
 
 struct grub_btrfs_chunk_item
@@ -159,7 +216,7 @@ struct grub_btrfs_internal_node
 {
   struct grub_btrfs_key key;
   grub_uint64_t addr;
-  grub_uint64_t dummy;
+  grub_uint64_t generation;
 } GRUB_PACKED;
 
 struct grub_btrfs_dir_item
@@ -175,19 +232,6 @@ struct grub_btrfs_dir_item
   char name[0];
 } GRUB_PACKED;
 
-struct grub_btrfs_leaf_descriptor
-{
-  unsigned depth;
-  unsigned allocated;
-  struct
-  {
-    grub_disk_addr_t addr;
-    unsigned iter;
-    unsigned maxiter;
-    int leaf;
-  } *data;
-};
-
 struct grub_btrfs_time
 {
   grub_int64_t sec;
@@ -321,6 +365,111 @@ check_btrfs_header (struct grub_btrfs_data *data, struct btrfs_header *header,
   return GRUB_ERR_NONE;
 }
 
+/* Copy [addr, addr + size) from a cached tree node, if there is one.  */
+static int
+grub_btrfs_node_cache_read (struct grub_btrfs_data *data,
+			    grub_disk_addr_t addr, void *buf, grub_size_t size)
+{
+  unsigned i;
+
+  for (i = 0; i < GRUB_BTRFS_NODE_CACHE_SIZE; i++)
+    {
+      struct grub_btrfs_node_cache_entry *entry = &data->node_cache[i];
+
+      if (entry->node && entry->addr <= addr
+	  && addr - entry->addr < data->nodesize
+	  && size <= data->nodesize - (addr - entry->addr))
+	{
+	  grub_memcpy (buf, entry->node + (addr - entry->addr), size);
+	  return 1;
+	}
+    }
+  return 0;
+}
+
+/*
+ * Get the whole tree node at logical address addr.  If generation isn't 0
+ * the node must have been written in that transaction.  The returned node
+ * stays valid until the next call.
+ */
+static grub_err_t
+grub_btrfs_get_node (struct grub_btrfs_data *data, grub_disk_addr_t addr,
+		     grub_uint64_t generation, struct btrfs_header **out,
+		     int recursion_depth)
+{
+  struct grub_btrfs_node_cache_entry *entry, *victim = NULL;
+  struct btrfs_header *head;
+  grub_err_t err;
+  unsigned i;
+
+  for (i = 0; i < GRUB_BTRFS_NODE_CACHE_SIZE; i++)
+    {
+      entry = &data->node_cache[i];
+      if (entry->node && entry->addr == addr
+	  && (!generation || entry->generation == generation))
+	{
+	  entry->last_use = ++data->node_cache_tick;
+	  *out = (struct btrfs_header *) entry->node;
+	  return GRUB_ERR_NONE;
+	}
+      if (entry->node && entry->addr == addr)
+	{
+	  /* Stale copy of this node.  */
+	  grub_free (entry->node);
+	  entry->node = NULL;
+	}
+    }
+
+  head = grub_malloc (data->nodesize);
+  if (!head)
+    return grub_errno;
+  /* This may recurse into the chunk tree and fill other cache slots.  */
+  err = grub_btrfs_read_logical (data, addr, head, data->nodesize,
+				 recursion_depth);
+  if (err)
+    {
+      grub_free (head);
+      return err;
+    }
+  /* Only nodes that passed every check may be cached.  */
+  err = check_btrfs_header (data, head, addr);
+  if (err)
+    {
+      grub_free (head);
+      return err;
+    }
+  if (generation && grub_le_to_cpu64 (head->generation) != generation)
+    {
+      grub_free (head);
+      return grub_error (GRUB_ERR_BAD_FS, "node generation mismatch");
+    }
+  if (grub_le_to_cpu32 (head->nitems)
+      > (data->nodesize - sizeof (*head))
+      / (head->level ? sizeof (struct grub_btrfs_internal_node)
+	 : sizeof (struct grub_btrfs_leaf_node)))
+    {
+      grub_free (head);
+      return grub_error (GRUB_ERR_BAD_FS, "too many items in node");
+    }
+
+  for (i = 0; i < GRUB_BTRFS_NODE_CACHE_SIZE; i++)
+    {
+      entry = &data->node_cache[i];
+      if (!victim || !entry->node
+	  || (victim->node && entry->last_use < victim->last_use))
+	victim = entry;
+    }
+  grub_free (victim->node);
+
+  victim->addr = addr;
+  victim->generation = grub_le_to_cpu64 (head->generation);
+  victim->node = (grub_uint8_t *) head;
+  victim->last_use = ++data->node_cache_tick;
+
+  *out = head;
+  return GRUB_ERR_NONE;
+}
+
 static grub_err_t
 save_ref (struct grub_btrfs_leaf_descriptor *desc,
 	  grub_disk_addr_t addr, unsigned i, unsigned m, int l)
@@ -351,6 +500,7 @@ next (struct grub_btrfs_data *data,
 {
   grub_err_t err;
   struct grub_btrfs_leaf_node leaf;
+  struct btrfs_header *head;
 
   for (; desc->depth > 0; desc->depth--)
     {
@@ -364,7 +514,6 @@ next (struct grub_btrfs_data *data,
   while (!desc->data[desc->depth - 1].leaf)
     {
       struct grub_btrfs_internal_node node;
-      struct btrfs_header head;
 
       err = grub_btrfs_read_logical (data, desc->data[desc->depth - 1].iter
 				     * sizeof (node)
@@ -374,14 +523,15 @@ next (struct grub_btrfs_data *data,
       if (err)
 	return -err;
 
-      err = grub_btrfs_read_logical (data, grub_le_to_cpu64 (node.addr),
-				     &head, sizeof (head), 0);
-      check_btrfs_header (data, &head, grub_le_to_cpu64 (node.addr));
+      err = grub_btrfs_get_node (data, grub_le_to_cpu64 (node.addr),
+				 grub_le_to_cpu64 (node.generation), &head, 0);
       if (err)
 	return -err;
 
-      save_ref (desc, grub_le_to_cpu64 (node.addr), 0,
-		grub_le_to_cpu32 (head.nitems), !head.level);
+      err = save_ref (desc, grub_le_to_cpu64 (node.addr), 0,
+		      grub_le_to_cpu32 (head->nitems), !head->level);
+      if (err)
+	return -err;
     }
   err = grub_btrfs_read_logical (data, desc->data[desc->depth - 1].iter
 				 * sizeof (leaf)
@@ -407,6 +557,7 @@ lower_bound (struct grub_btrfs_data *data,
 	     int recursion_depth)
 {
   grub_disk_addr_t addr = grub_le_to_cpu64 (root);
+  grub_uint64_t generation = 0;
   int depth = -1;
 
   if (desc)
@@ -431,30 +582,25 @@ lower_bound (struct grub_btrfs_data *data,
   while (1)
     {
       grub_err_t err;
-      struct btrfs_header head;
+      struct btrfs_header *head;
 
     reiter:
       depth++;
-      /* FIXME: preread few nodes into buffer. */
-      err = grub_btrfs_read_logical (data, addr, &head, sizeof (head),
-				     recursion_depth + 1);
-      check_btrfs_header (data, &head, addr);
+      err = grub_btrfs_get_node (data, addr, generation, &head,
+				 recursion_depth + 1);
       if (err)
 	return err;
-      addr += sizeof (head);
-      if (head.level)
+      addr += sizeof (*head);
+      if (head->level)
 	{
 	  unsigned i;
 	  struct grub_btrfs_internal_node node, node_last;
 	  int have_last = 0;
 	  grub_memset (&node_last, 0, sizeof (node_last));
-	  for (i = 0; i < grub_le_to_cpu32 (head.nitems); i++)
+	  for (i = 0; i < grub_le_to_cpu32 (head->nitems); i++)
 	    {
-	      err = grub_btrfs_read_logical (data, addr + i * sizeof (node),
-					     &node, sizeof (node),
-					     recursion_depth + 1);
-	      if (err)
-		return err;
+	      grub_memcpy (&node, (grub_uint8_t *) (head + 1)
+			   + i * sizeof (node), sizeof (node));
 
 	      grub_dprintf ("btrfs",
 			    "internal node (depth %d) %" PRIxGRUB_UINT64_T
@@ -466,11 +612,12 @@ lower_bound (struct grub_btrfs_data *data,
 		{
 		  err = GRUB_ERR_NONE;
 		  if (desc)
-		    err = save_ref (desc, addr - sizeof (head), i,
-				    grub_le_to_cpu32 (head.nitems), 0);
+		    err = save_ref (desc, addr - sizeof (*head), i,
+				    grub_le_to_cpu32 (head->nitems), 0);
 		  if (err)
 		    return err;
 		  addr = grub_le_to_cpu64 (node.addr);
+		  generation = grub_le_to_cpu64 (node.generation);
 		  goto reiter;
 		}
 	      if (key_cmp (&node.key, key_in) > 0)
@@ -482,32 +629,30 @@ lower_bound (struct grub_btrfs_data *data,
 	    {
 	      err = GRUB_ERR_NONE;
 	      if (desc)
-		err = save_ref (desc, addr - sizeof (head), i - 1,
-				grub_le_to_cpu32 (head.nitems), 0);
+		err = save_ref (desc, addr - sizeof (*head), i - 1,
+				grub_le_to_cpu32 (head->nitems), 0);
 	      if (err)
 		return err;
 	      addr = grub_le_to_cpu64 (node_last.addr);
+	      generation = grub_le_to_cpu64 (node_last.generation);
 	      goto reiter;
 	    }
 	  *outsize = 0;
 	  *outaddr = 0;
 	  grub_memset (key_out, 0, sizeof (*key_out));
 	  if (desc)
-	    return save_ref (desc, addr - sizeof (head), -1,
-			     grub_le_to_cpu32 (head.nitems), 0);
+	    return save_ref (desc, addr - sizeof (*head), -1,
+			     grub_le_to_cpu32 (head->nitems), 0);
 	  return GRUB_ERR_NONE;
 	}
       {
 	unsigned i;
 	struct grub_btrfs_leaf_node leaf, leaf_last;
 	int have_last = 0;
-	for (i = 0; i < grub_le_to_cpu32 (head.nitems); i++)
+	for (i = 0; i < grub_le_to_cpu32 (head->nitems); i++)
 	  {
-	    err = grub_btrfs_read_logical (data, addr + i * sizeof (leaf),
-					   &leaf, sizeof (leaf),
-					   recursion_depth + 1);
-	    if (err)
-	      return err;
+	    grub_memcpy (&leaf, (grub_uint8_t *) (head + 1)
+			 + i * sizeof (leaf), sizeof (leaf));
 
 	    grub_dprintf ("btrfs",
 			  "leaf (depth %d) %" PRIxGRUB_UINT64_T
@@ -520,8 +665,8 @@ lower_bound (struct grub_btrfs_data *data,
 		*outsize = grub_le_to_cpu32 (leaf.size);
 		*outaddr = addr + grub_le_to_cpu32 (leaf.offset);
 		if (desc)
-		  return save_ref (desc, addr - sizeof (head), i,
-				   grub_le_to_cpu32 (head.nitems), 1);
+		  return save_ref (desc, addr - sizeof (*head), i,
+				   grub_le_to_cpu32 (head->nitems), 1);
 		return GRUB_ERR_NONE;
 	      }
 
@@ -538,16 +683,16 @@ lower_bound (struct grub_btrfs_data *data,
 	    *outsize = grub_le_to_cpu32 (leaf_last.size);
 	    *outaddr = addr + grub_le_to_cpu32 (leaf_last.offset);
 	    if (desc)
-	      return save_ref (desc, addr - sizeof (head), i - 1,
-			       grub_le_to_cpu32 (head.nitems), 1);
+	      return save_ref (desc, addr - sizeof (*head), i - 1,
+			       grub_le_to_cpu32 (head->nitems), 1);
 	    return GRUB_ERR_NONE;
 	  }
 	*outsize = 0;
 	*outaddr = 0;
 	grub_memset (key_out, 0, sizeof (*key_out));
 	if (desc)
-	  return save_ref (desc, addr - sizeof (head), -1,
-			   grub_le_to_cpu32 (head.nitems), 1);
+	  return save_ref (desc, addr - sizeof (*head), -1,
+			   grub_le_to_cpu32 (head->nitems), 1);
 	return GRUB_ERR_NONE;
       }
     }
@@ -849,6 +994,10 @@ static grub_err_t
 grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 			 void *buf, grub_size_t size, int recursion_depth)
 {
+  /* Items are mostly read from nodes that lower_bound just went through.  */
+  if (grub_btrfs_node_cache_read (data, addr, buf, size))
+    return GRUB_ERR_NONE;
+
   while (size > 0)
     {
       grub_uint8_t *ptr;
@@ -1176,6 +1325,15 @@ grub_btrfs_mount (grub_device_t dev)
       return NULL;
     }
 
+  data->nodesize = grub_le_to_cpu32 (data->sblock.nodesize);
+  if (data->nodesize < sizeof (struct btrfs_header)
+      || data->nodesize > 65536)
+    {
+      grub_error (GRUB_ERR_BAD_FS, "invalid node size");
+      grub_free (data);
+      return NULL;
+    }
+
   data->n_devices_allocated = 16;
   data->devices_attached = grub_malloc (sizeof (data->devices_attached[0])
 					* data->n_devices_allocated);
@@ -1201,6 +1359,11 @@ grub_btrfs_unmount (struct grub_btrfs_data *data)
         grub_device_close (data->devices_attached[i].dev);
   grub_free (data->devices_attached);
   grub_free (data->extent);
+  free_iterator (&data->extdesc);
+  for (i = 0; i < GRUB_BTRFS_EXTENT_CACHE_ENTRIES; i++)
+    grub_free (data->extent_cache[i].buf);
+  for (i = 0; i < GRUB_BTRFS_NODE_CACHE_SIZE; i++)
+    grub_free (data->node_cache[i].node);
   grub_free (data);
 }
 
@@ -1412,6 +1575,163 @@ grub_btrfs_lzo_decompress(char *ibuf, grub_size_t isize, grub_off_t off,
   return ret;
 }
 
+static grub_ssize_t
+grub_btrfs_decompress (grub_uint8_t compression, char *ibuf, grub_size_t isize,
+		       grub_off_t off, char *obuf, grub_size_t osize)
+{
+  switch (compression)
+    {
+    case GRUB_BTRFS_COMPRESSION_ZLIB:
+      return grub_zlib_decompress (ibuf, isize, off, obuf, osize);
+    case GRUB_BTRFS_COMPRESSION_LZO:
+      return grub_btrfs_lzo_decompress (ibuf, isize, off, obuf, osize);
+    case GRUB_BTRFS_COMPRESSION_ZSTD:
+      return grub_btrfs_zstd_decompress (ibuf, isize, off, obuf, osize);
+    }
+  return -1;
+}
+
+/*
+ * Get the whole decompressed contents of the current regular extent,
+ * decompressing and caching it on first use.  *out is set to NULL if the
+ * extent is too big to be cached.
+ */
+static grub_err_t
+grub_btrfs_extent_cache_get (struct grub_btrfs_data *data, char **out,
+			     grub_size_t *size)
+{
+  struct grub_btrfs_extent_cache_entry *entry = NULL;
+  grub_uint64_t laddr = grub_le_to_cpu64 (data->extent->laddr);
+  grub_uint64_t zsize = grub_le_to_cpu64 (data->extent->compressed_size);
+  grub_uint64_t usize = grub_le_to_cpu64 (data->extent->size);
+  grub_ssize_t ret;
+  grub_err_t err;
+  char *tmp, *ubuf;
+  unsigned i;
+
+  for (i = 0; i < GRUB_BTRFS_EXTENT_CACHE_ENTRIES; i++)
+    if (data->extent_cache[i].buf
+	&& data->extent_cache[i].laddr == laddr
+	&& data->extent_cache[i].compression == data->extent->compression)
+      {
+	entry = &data->extent_cache[i];
+	entry->last_use = ++data->extent_cache_tick;
+	*out = entry->buf;
+	*size = entry->size;
+	return GRUB_ERR_NONE;
+      }
+
+  *out = NULL;
+  if (usize == 0 || usize > GRUB_BTRFS_EXTENT_CACHE_BUDGET / 4)
+    return GRUB_ERR_NONE;
+
+  tmp = grub_malloc (zsize);
+  if (!tmp)
+    return grub_errno;
+  err = grub_btrfs_read_logical (data, laddr, tmp, zsize, 0);
+  if (err)
+    {
+      grub_free (tmp);
+      return err;
+    }
+
+  ubuf = grub_malloc (usize);
+  if (!ubuf)
+    {
+      grub_free (tmp);
+      return grub_errno;
+    }
+
+  ret = grub_btrfs_decompress (data->extent->compression, tmp, zsize, 0,
+			       ubuf, usize);
+  grub_free (tmp);
+  if (ret <= 0)
+    {
+      grub_free (ubuf);
+      if (!grub_errno)
+	grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		    "premature end of compressed");
+      return grub_errno;
+    }
+
+  /* Make room: evict least recently used extents until we fit.  */
+  for (;;)
+    {
+      struct grub_btrfs_extent_cache_entry *victim = NULL;
+
+      entry = NULL;
+      for (i = 0; i < GRUB_BTRFS_EXTENT_CACHE_ENTRIES; i++)
+	if (!data->extent_cache[i].buf)
+	  entry = &data->extent_cache[i];
+	else if (!victim
+		 || data->extent_cache[i].last_use < victim->last_use)
+	  victim = &data->extent_cache[i];
+      if (entry && data->extent_cache_size + usize
+	  <= GRUB_BTRFS_EXTENT_CACHE_BUDGET)
+	break;
+      data->extent_cache_size -= victim->alloc;
+      grub_free (victim->buf);
+      victim->buf = NULL;
+    }
+
+  entry->laddr = laddr;
+  entry->compression = data->extent->compression;
+  entry->size = ret;
+  entry->alloc = usize;
+  entry->buf = ubuf;
+  entry->last_use = ++data->extent_cache_tick;
+  data->extent_cache_size += usize;
+
+  *out = entry->buf;
+  *size = entry->size;
+  return GRUB_ERR_NONE;
+}
+
+/* Read the extent item found at elemaddr into the extent cache.  */
+static grub_err_t
+grub_btrfs_load_extent (struct grub_btrfs_data *data,
+			grub_uint64_t ino, grub_uint64_t tree,
+			const struct grub_btrfs_key *key_out,
+			grub_disk_addr_t elemaddr, grub_size_t elemsize)
+{
+  grub_err_t err;
+
+  grub_free (data->extent);
+  data->extent = NULL;
+  if ((grub_ssize_t) elemsize < ((char *) &data->extent->inl
+				 - (char *) data->extent))
+    return grub_error (GRUB_ERR_BAD_FS, "extent descriptor is too short");
+  data->extstart = grub_le_to_cpu64 (key_out->offset);
+  data->extsize = elemsize;
+  data->extent = grub_malloc (elemsize);
+  data->extino = ino;
+  data->exttree = tree;
+  if (!data->extent)
+    return grub_errno;
+
+  err = grub_btrfs_read_logical (data, elemaddr, data->extent,
+				 elemsize, 0);
+  if (err)
+    {
+      grub_free (data->extent);
+      data->extent = NULL;
+      return err;
+    }
+
+  data->extend = data->extstart + grub_le_to_cpu64 (data->extent->size);
+  if (data->extent->type == GRUB_BTRFS_EXTENT_REGULAR
+      && (char *) data->extent + elemsize
+      >= (char *) &data->extent->filled + sizeof (data->extent->filled))
+    data->extend =
+      data->extstart + grub_le_to_cpu64 (data->extent->filled);
+
+  grub_dprintf ("btrfs", "regular extent 0x%" PRIxGRUB_UINT64_T "+0x%"
+		PRIxGRUB_UINT64_T "\n",
+		grub_le_to_cpu64 (key_out->offset),
+		grub_le_to_cpu64 (data->extent->size));
+  return GRUB_ERR_NONE;
+}
+
 static grub_ssize_t
 grub_btrfs_extent_read (struct grub_btrfs_data *data,
 			grub_uint64_t ino, grub_uint64_t tree,
@@ -1429,55 +1749,52 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
 	  struct grub_btrfs_key key_in, key_out;
 	  grub_disk_addr_t elemaddr;
 	  grub_size_t elemsize;
+	  int found = 0;
 
-	  grub_free (data->extent);
-	  key_in.object_id = ino;
-	  key_in.type = GRUB_BTRFS_ITEM_TYPE_EXTENT_ITEM;
-	  key_in.offset = grub_cpu_to_le64 (pos);
-	  err = lower_bound (data, &key_in, &key_out, tree,
-			     &elemaddr, &elemsize, NULL, 0);
-	  if (err)
-	    return -1;
-	  if (key_out.object_id != ino
-	      || key_out.type != GRUB_BTRFS_ITEM_TYPE_EXTENT_ITEM)
+	  /* Sequential reads usually continue with the next extent item.  */
+	  if (data->extent && data->extdesc.data && data->extino == ino
+	      && data->exttree == tree && data->extend <= pos)
 	    {
-	      grub_error (GRUB_ERR_BAD_FS, "extent not found");
-	      return -1;
-	    }
-	  if ((grub_ssize_t) elemsize < ((char *) &data->extent->inl
-					 - (char *) data->extent))
-	    {
-	      grub_error (GRUB_ERR_BAD_FS, "extent descriptor is too short");
-	      return -1;
+	      int r = next (data, &data->extdesc, &elemaddr, &elemsize,
+			    &key_out);
+	      if (r < 0)
+		return -1;
+	      if (r > 0 && key_out.object_id == ino
+		  && key_out.type == GRUB_BTRFS_ITEM_TYPE_EXTENT_ITEM
+		  && grub_le_to_cpu64 (key_out.offset) <= pos)
+		{
+		  if (grub_btrfs_load_extent (data, ino, tree, &key_out,
+					      elemaddr, elemsize))
+		    return -1;
+		  found = (data->extend > pos);
+		}
 	    }
-	  data->extstart = grub_le_to_cpu64 (key_out.offset);
-	  data->extsize = elemsize;
-	  data->extent = grub_malloc (elemsize);
-	  data->extino = ino;
-	  data->exttree = tree;
-	  if (!data->extent)
-	    return grub_errno;
-
-	  err = grub_btrfs_read_logical (data, elemaddr, data->extent,
-					 elemsize, 0);
-	  if (err)
-	    return err;
-
-	  data->extend = data->extstart + grub_le_to_cpu64 (data->extent->size);
-	  if (data->extent->type == GRUB_BTRFS_EXTENT_REGULAR
-	      && (char *) data->extent + elemsize
-	      >= (char *) &data->extent->filled + sizeof (data->extent->filled))
-	    data->extend =
-	      data->extstart + grub_le_to_cpu64 (data->extent->filled);
-
-	  grub_dprintf ("btrfs", "regular extent 0x%" PRIxGRUB_UINT64_T "+0x%"
-			PRIxGRUB_UINT64_T "\n",
-			grub_le_to_cpu64 (key_out.offset),
-			grub_le_to_cpu64 (data->extent->size));
-	  if (data->extend <= pos)
+
+	  if (!found)
 	    {
-	      grub_error (GRUB_ERR_BAD_FS, "extent not found");
-	      return -1;
+	      free_iterator (&data->extdesc);
+	      data->extdesc.data = NULL;
+	      key_in.object_id = ino;
+	      key_in.type = GRUB_BTRFS_ITEM_TYPE_EXTENT_ITEM;
+	      key_in.offset = grub_cpu_to_le64 (pos);
+	      err = lower_bound (data, &key_in, &key_out, tree,
+				 &elemaddr, &elemsize, &data->extdesc, 0);
+	      if (err)
+		return -1;
+	      if (key_out.object_id != ino
+		  || key_out.type != GRUB_BTRFS_ITEM_TYPE_EXTENT_ITEM)
+		{
+		  grub_error (GRUB_ERR_BAD_FS, "extent not found");
+		  return -1;
+		}
+	      if (grub_btrfs_load_extent (data, ino, tree, &key_out,
+					  elemaddr, elemsize))
+		return -1;
+	      if (data->extend <= pos)
+		{
+		  grub_error (GRUB_ERR_BAD_FS, "extent not found");
+		  return -1;
+		}
 	    }
 	}
       csize = data->extend - pos;
@@ -1559,6 +1876,29 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
 	      char *tmp;
 	      grub_uint64_t zsize;
 	      grub_ssize_t ret;
+	      grub_size_t usize;
+
+	      /*
+	       * Small reads would otherwise decompress the extent from its
+	       * start over and over again.
+	       */
+	      err = grub_btrfs_extent_cache_get (data, &tmp, &usize);
+	      if (err)
+		return -1;
+	      if (tmp)
+		{
+		  grub_off_t off = extoff
+		    + grub_le_to_cpu64 (data->extent->offset);
+
+		  if (off > usize || usize - off < csize)
+		    {
+		      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+				  "premature end of compressed");
+		      return -1;
+		    }
+		  grub_memcpy (buf, tmp + off, csize);
+		  break;
+		}
 
 	      zsize = grub_le_to_cpu64 (data->extent->compressed_size);
 	      tmp = grub_malloc (zsize);
@@ -1573,20 +1913,10 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
 		  return -1;
 		}
 
-	      if (data->extent->compression == GRUB_BTRFS_COMPRESSION_ZLIB)
-		ret = grub_zlib_decompress (tmp, zsize, extoff
-				    + grub_le_to_cpu64 (data->extent->offset),
-				    buf, csize);
-	      else if (data->extent->compression == GRUB_BTRFS_COMPRESSION_LZO)
-		ret = grub_btrfs_lzo_decompress (tmp, zsize, extoff
-				    + grub_le_to_cpu64 (data->extent->offset),
-				    buf, csize);
-	      else if (data->extent->compression == GRUB_BTRFS_COMPRESSION_ZSTD)
-		ret = grub_btrfs_zstd_decompress (tmp, zsize, extoff
-				    + grub_le_to_cpu64 (data->extent->offset),
-				    buf, csize);
-	      else
-		ret = -1;
+	      ret = grub_btrfs_decompress (data->extent->compression,
+					   tmp, zsize, extoff
+					   + grub_le_to_cpu64 (data->extent->offset),
+					   buf, csize);
 
 	      grub_free (tmp);
 
@@ -70,6 +70,11 @@ typedef struct grub_exfat_bpb grub_current_fat_bpb_t;
 typedef struct grub_fat_bpb grub_current_fat_bpb_t;
 #endif
 
+/* Bytes of the FAT read at once when following a cluster chain.  */
+#define GRUB_FAT_WINDOW_SIZE	4096
+/* Clusters mapped ahead of the one being read.  */
+#define GRUB_FAT_MAP_AHEAD	4096
+
 #ifdef MODE_EXFAT
 enum
   {
@@ -182,6 +187,21 @@ struct grub_fat_data
   grub_uint32_t num_clusters;
 
   grub_uint32_t uuid;
+
+  /* A window of the FAT, so that following a chain doesn't need a disk
+     read per cluster.  */
+  grub_uint64_t fat_window_start;
+  grub_uint32_t fat_window_size;
+  grub_uint8_t fat_window[GRUB_FAT_WINDOW_SIZE];
+};
+
+/* LENGTH clusters starting at CLUSTER hold the file data starting at
+   cluster LOGICAL of the file.  */
+struct grub_fat_run
+{
+  grub_uint32_t logical;
+  grub_uint32_t cluster;
+  grub_uint32_t length;
 };
 
 struct grub_fshelp_node {
@@ -201,6 +221,13 @@ struct grub_fshelp_node {
 #ifdef MODE_EXFAT
   int is_contiguous;
 #endif
+
+  /* Map of the cluster chain, only built for opened files.  */
+  int use_map;
+  int map_complete;
+  struct grub_fat_run *runs;
+  grub_uint32_t num_runs;
+  grub_uint32_t alloc_runs;
 };
 
 static grub_dl_t my_mod;
@@ -237,6 +264,7 @@ grub_fat_mount (grub_disk_t disk)
   data = (struct grub_fat_data *) grub_malloc (sizeof (*data));
   if (! data)
     goto fail;
+  data->fat_window_size = 0;
 
   /* Read the BPB.  */
   if (grub_disk_read (disk, 0, 0, sizeof (bpb), &bpb))
@@ -448,6 +476,198 @@ grub_fat_mount (grub_disk_t disk)
   return 0;
 }
 
+/* Find the cluster following CLUSTER in the chain.  */
+static grub_err_t
+grub_fat_next_cluster (grub_disk_t disk, struct grub_fat_data *data,
+		       grub_uint32_t cluster, grub_uint32_t *next)
+{
+  grub_uint64_t fat_offset, fat_bytes;
+  grub_uint32_t next_cluster = 0;
+  unsigned entry_size = (data->fat_size + 7) >> 3;
+
+  switch (data->fat_size)
+    {
+    case 32:
+      fat_offset = (grub_uint64_t) cluster << 2;
+      break;
+    case 16:
+      fat_offset = (grub_uint64_t) cluster << 1;
+      break;
+    default:
+      /* case 12: */
+      fat_offset = cluster + (cluster >> 1);
+      break;
+    }
+
+  if (fat_offset < data->fat_window_start
+      || fat_offset + entry_size > (data->fat_window_start
+				    + data->fat_window_size))
+    {
+      /* Read the part of the FAT around the entry.  A FAT12 entry may
+	 straddle the window, so start on the sector holding it.  */
+      fat_bytes = (grub_uint64_t) data->sectors_per_fat << GRUB_DISK_SECTOR_BITS;
+      data->fat_window_start = fat_offset & ~(GRUB_FAT_WINDOW_SIZE - 1);
+      if (fat_offset + entry_size > data->fat_window_start + GRUB_FAT_WINDOW_SIZE)
+	data->fat_window_start = fat_offset & ~(GRUB_DISK_SECTOR_SIZE - 1);
+      data->fat_window_size = GRUB_FAT_WINDOW_SIZE;
+      if (data->fat_window_start + data->fat_window_size > fat_bytes
+	  && fat_offset + entry_size <= fat_bytes)
+	data->fat_window_size = fat_bytes - data->fat_window_start;
+
+      if (grub_disk_read (disk, data->fat_sector, data->fat_window_start,
+			  data->fat_window_size, data->fat_window))
+	{
+	  data->fat_window_size = 0;
+	  return grub_errno;
+	}
+    }
+
+  grub_memcpy (&next_cluster,
+	       data->fat_window + (fat_offset - data->fat_window_start),
+	       entry_size);
+  next_cluster = grub_le_to_cpu32 (next_cluster);
+  switch (data->fat_size)
+    {
+    case 16:
+      next_cluster &= 0xFFFF;
+      break;
+    case 12:
+      if (cluster & 1)
+	next_cluster >>= 4;
+
+      next_cluster &= 0x0FFF;
+      break;
+    }
+
+  grub_dprintf ("fat", "fat_size=%d, next_cluster=%u\n",
+		data->fat_size, next_cluster);
+
+  *next = next_cluster;
+  return GRUB_ERR_NONE;
+}
+
+/* Extend the map of NODE until it covers LOGICAL_CLUSTER and a bit more,
+   or reaches the end of the chain.  */
+static grub_err_t
+grub_fat_extend_map (grub_disk_t disk, grub_fshelp_node_t node,
+		     grub_uint32_t logical_cluster)
+{
+  struct grub_fat_run *last;
+  grub_uint32_t target, last_cluster, next_cluster;
+  unsigned logical_cluster_bits = (node->data->cluster_bits
+				   + GRUB_DISK_SECTOR_BITS);
+
+  /* Don't map past the file size, in case the chain is longer.  */
+  last_cluster = 0;
+  if (node->file_size)
+    last_cluster = (node->file_size - 1) >> logical_cluster_bits;
+  target = logical_cluster + GRUB_FAT_MAP_AHEAD;
+  if (target < logical_cluster || target > last_cluster)
+    target = last_cluster;
+
+  if (node->num_runs == 0)
+    {
+      if (node->file_cluster < 2
+	  || node->file_cluster >= node->data->num_clusters)
+	return grub_error (GRUB_ERR_BAD_FS, "invalid cluster %u",
+			   node->file_cluster);
+      node->runs = grub_malloc (16 * sizeof (node->runs[0]));
+      if (!node->runs)
+	return grub_errno;
+      node->alloc_runs = 16;
+      node->runs[0].logical = 0;
+      node->runs[0].cluster = node->file_cluster;
+      node->runs[0].length = 1;
+      node->num_runs = 1;
+    }
+
+  last = &node->runs[node->num_runs - 1];
+  while (!node->map_complete && last->logical + last->length <= target)
+    {
+      if (grub_fat_next_cluster (disk, node->data,
+				 last->cluster + last->length - 1,
+				 &next_cluster))
+	return grub_errno;
+
+      /* Check the end.  */
+      if (next_cluster >= node->data->cluster_eof_mark)
+	{
+	  node->map_complete = 1;
+	  break;
+	}
+
+      if (next_cluster < 2 || next_cluster >= node->data->num_clusters)
+	return grub_error (GRUB_ERR_BAD_FS, "invalid cluster %u",
+			   next_cluster);
+
+      if (next_cluster == last->cluster + last->length)
+	{
+	  last->length++;
+	  continue;
+	}
+
+      if (node->num_runs == node->alloc_runs)
+	{
+	  struct grub_fat_run *runs;
+
+	  runs = grub_realloc (node->runs, 2 * node->alloc_runs
+			       * sizeof (node->runs[0]));
+	  if (!runs)
+	    return grub_errno;
+	  node->runs = runs;
+	  node->alloc_runs *= 2;
+	}
+      node->runs[node->num_runs].logical = last->logical + last->length;
+      node->runs[node->num_runs].cluster = next_cluster;
+      node->runs[node->num_runs].length = 1;
+      last = &node->runs[node->num_runs++];
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+/* Return the run holding LOGICAL_CLUSTER, or NULL if the file ends before
+   it.  */
+static struct grub_fat_run *
+grub_fat_find_run (grub_disk_t disk, grub_fshelp_node_t node,
+		   grub_uint32_t logical_cluster)
+{
+  struct grub_fat_run *last;
+  grub_uint32_t lo = 0, hi;
+
+  if (node->num_runs == 0
+      || (last = &node->runs[node->num_runs - 1],
+	  logical_cluster >= last->logical + last->length))
+    {
+      if (grub_fat_extend_map (disk, node, logical_cluster))
+	return NULL;
+      last = &node->runs[node->num_runs - 1];
+      if (logical_cluster >= last->logical + last->length)
+	return NULL;
+    }
+
+  hi = node->num_runs;
+  while (hi - lo > 1)
+    {
+      grub_uint32_t mid = lo + (hi - lo) / 2;
+      if (node->runs[mid].logical <= logical_cluster)
+	lo = mid;
+      else
+	hi = mid;
+    }
+
+  return &node->runs[lo];
+}
+
+static void
+grub_fat_free_map (grub_fshelp_node_t node)
+{
+  grub_free (node->runs);
+  node->runs = NULL;
+  node->num_runs = node->alloc_runs = 0;
+  node->map_complete = 0;
+}
+
 static grub_ssize_t
 grub_fat_read_data (grub_disk_t disk, grub_fshelp_node_t node,
 		    grub_disk_read_hook_t read_hook, void *read_hook_data,
@@ -501,6 +721,46 @@ grub_fat_read_data (grub_disk_t disk, grub_fshelp_node_t node,
   logical_cluster = offset >> logical_cluster_bits;
   offset &= (1ULL << logical_cluster_bits) - 1;
 
+  if (node->use_map)
+    {
+      while (len)
+	{
+	  struct grub_fat_run *run;
+	  grub_uint64_t avail;
+
+	  run = grub_fat_find_run (disk, node, logical_cluster);
+	  if (!run)
+	    return grub_errno ? -1 : ret;
+
+	  /* Read as much of the run as wanted in one go.  */
+	  sector = (node->data->cluster_sector
+		    + ((run->cluster + (logical_cluster - run->logical) - 2)
+		       << node->data->cluster_bits));
+	  avail = ((grub_uint64_t) (run->length
+				    - (logical_cluster - run->logical))
+		   << logical_cluster_bits) - offset;
+	  size = len;
+	  if (size > avail)
+	    size = avail;
+
+	  disk->read_hook = read_hook;
+	  disk->read_hook_data = read_hook_data;
+	  grub_disk_read (disk, sector, offset, size, buf);
+	  disk->read_hook = 0;
+	  if (grub_errno)
+	    return -1;
+
+	  len -= size;
+	  buf += size;
+	  ret += size;
+	  offset += size;
+	  logical_cluster += offset >> logical_cluster_bits;
+	  offset &= (1ULL << logical_cluster_bits) - 1;
+	}
+
+      return ret;
+    }
+
   if (logical_cluster < node->cur_cluster_num)
     {
       node->cur_cluster_num = 0;
@@ -513,45 +773,11 @@ grub_fat_read_data (grub_disk_t disk, grub_fshelp_node_t node,
 	{
 	  /* Find next cluster.  */
 	  grub_uint32_t next_cluster;
-	  grub_uint32_t fat_offset;
-
-	  switch (node->data->fat_size)
-	    {
-	    case 32:
-	      fat_offset = node->cur_cluster << 2;
-	      break;
-	    case 16:
-	      fat_offset = node->cur_cluster << 1;
-	      break;
-	    default:
-	      /* case 12: */
-	      fat_offset = node->cur_cluster + (node->cur_cluster >> 1);
-	      break;
-	    }
 
-	  /* Read the FAT.  */
-	  if (grub_disk_read (disk, node->data->fat_sector, fat_offset,
-			      (node->data->fat_size + 7) >> 3,
-			      (char *) &next_cluster))
+	  if (grub_fat_next_cluster (disk, node->data, node->cur_cluster,
+				     &next_cluster))
 	    return -1;
 
-	  next_cluster = grub_le_to_cpu32 (next_cluster);
-	  switch (node->data->fat_size)
-	    {
-	    case 16:
-	      next_cluster &= 0xFFFF;
-	      break;
-	    case 12:
-	      if (node->cur_cluster & 1)
-		next_cluster >>= 4;
-
-	      next_cluster &= 0x0FFF;
-	      break;
-	    }
-
-	  grub_dprintf ("fat", "fat_size=%d, next_cluster=%u\n",
-			node->data->fat_size, next_cluster);
-
 	  /* Check the end.  */
 	  if (next_cluster >= node->data->cluster_eof_mark)
 	    return ret;
@@ -900,6 +1126,11 @@ static grub_err_t lookup_file (grub_fshelp_node_t node,
 	    (*foundnode)->file_cluster = node->data->root_cluster;
 #endif
 	  (*foundnode)->cur_cluster_num = ~0U;
+	  (*foundnode)->use_map = 0;
+	  (*foundnode)->map_complete = 0;
+	  (*foundnode)->runs = NULL;
+	  (*foundnode)->num_runs = 0;
+	  (*foundnode)->alloc_runs = 0;
 	  (*foundnode)->data = node->data;
 	  (*foundnode)->disk = node->disk;
 
@@ -1019,6 +1250,7 @@ grub_fat_open (grub_file_t file, const char *name)
   if (err)
     goto fail;
 
+  found->use_map = 1;
   file->data = found;
   file->size = found->file_size;
 
@@ -1049,6 +1281,7 @@ grub_fat_close (grub_file_t file)
 {
   grub_fshelp_node_t node = file->data;
 
+  grub_fat_free_map (node);
   grub_free (node->data);
   grub_free (node);
 
@@ -17,6 +17,9 @@
  *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+/* Needed for ZSTD_createDCtx_advanced, see btrfs.c.  */
+#define ZSTD_STATIC_LINKING_ONLY
+
 #include <grub/err.h>
 #include <grub/file.h>
 #include <grub/mm.h>
@@ -26,7 +29,11 @@
 #include <grub/types.h>
 #include <grub/fshelp.h>
 #include <grub/deflate.h>
+#include <grub/lz4.h>
+#include <grub/env.h>
+#include <grub/partition.h>
 #include <minilzo.h>
+#include <zstd.h>
 
 #include "xz.h"
 #include "xz_stream.h"
@@ -183,12 +190,19 @@ enum
     COMPRESSION_ZLIB = 1,
     COMPRESSION_LZO = 3,
     COMPRESSION_XZ = 4,
+    COMPRESSION_LZ4 = 5,
+    COMPRESSION_ZSTD = 6,
   };
 
 
 #define SQUASH_CHUNK_SIZE 0x2000
 #define XZBUFSIZ 0x2000
 
+/* Default size of the decompressed block cache in KiB, can be changed
+   through $squash4_cache_size.  */
+#define SQUASH_CACHE_DEFAULT_SIZE 8192
+#define SQUASH_CACHE_HASH_SIZE 64
+
 struct grub_squash_data
 {
   grub_disk_t disk;
@@ -202,6 +216,11 @@ struct grub_squash_data
 			      struct grub_squash_data *data);
   struct xz_dec *xzdec;
   char *xzbuf;
+  ZSTD_DCtx *zstdctx;
+  /* Whole decompressed block, for decoders that can't start at an
+     offset.  */
+  char *ubuf;
+  grub_size_t ubufsize;
 };
 
 struct grub_fshelp_node
@@ -216,6 +235,196 @@ struct grub_fshelp_node
   } stack[1];
 };
 
+/* Cache of decompressed metadata and fragment blocks.  A new mount is made
+   for every open, so it is shared between all of them and keyed by the
+   device and the position of the compressed block.  */
+struct squash_cache_entry
+{
+  struct squash_cache_entry *hash_next;
+  struct squash_cache_entry *lru_prev;
+  struct squash_cache_entry *lru_next;
+  unsigned long dev_id;
+  unsigned long disk_id;
+  grub_disk_addr_t part_start;
+  grub_uint32_t creation_time;
+  grub_uint64_t pos;
+  int cached;
+  /* Decompressed length, and the memory held, counted against the
+     limit.  */
+  grub_size_t size;
+  grub_size_t alloc;
+  char data[0];
+};
+
+static struct squash_cache_entry *squash_cache_hash[SQUASH_CACHE_HASH_SIZE];
+static struct squash_cache_entry *squash_cache_head, *squash_cache_tail;
+static grub_size_t squash_cache_used;
+static grub_size_t squash_cache_max = SQUASH_CACHE_DEFAULT_SIZE * 1024;
+static unsigned long squash_cache_hits, squash_cache_misses;
+
+static unsigned
+squash_cache_index (unsigned long disk_id, grub_uint64_t pos)
+{
+  return (disk_id * 31 + (pos >> 4)) % SQUASH_CACHE_HASH_SIZE;
+}
+
+static void
+squash_cache_unlink (struct squash_cache_entry *e)
+{
+  struct squash_cache_entry **p;
+
+  for (p = &squash_cache_hash[squash_cache_index (e->disk_id, e->pos)];
+       *p; p = &(*p)->hash_next)
+    if (*p == e)
+      {
+	*p = e->hash_next;
+	break;
+      }
+
+  if (e->lru_prev)
+    e->lru_prev->lru_next = e->lru_next;
+  else
+    squash_cache_head = e->lru_next;
+  if (e->lru_next)
+    e->lru_next->lru_prev = e->lru_prev;
+  else
+    squash_cache_tail = e->lru_prev;
+
+  squash_cache_used -= e->alloc;
+  e->cached = 0;
+}
+
+/* Drop the least recently used blocks until the cache fits in LIMIT.  */
+static void
+squash_cache_trim (grub_size_t limit)
+{
+  while (squash_cache_tail && squash_cache_used > limit)
+    {
+      struct squash_cache_entry *e = squash_cache_tail;
+
+      squash_cache_unlink (e);
+      grub_free (e);
+    }
+}
+
+/* Return the decompressed contents of the block of CSIZE bytes at POS,
+   which decompresses to at most MAXSIZE bytes.  Release it with
+   squash_cache_put.  */
+static struct squash_cache_entry *
+squash_cache_get (struct grub_squash_data *data, grub_uint64_t pos,
+		  grub_size_t csize, grub_size_t maxsize)
+{
+  struct squash_cache_entry *e;
+  grub_disk_addr_t part_start = grub_partition_get_start (data->disk->partition);
+  unsigned idx = squash_cache_index (data->disk->id, pos);
+  grub_ssize_t size;
+  char *tmp;
+
+  for (e = squash_cache_hash[idx]; e; e = e->hash_next)
+    if (e->pos == pos && e->disk_id == data->disk->id
+	&& e->dev_id == data->disk->dev->id && e->part_start == part_start
+	&& e->creation_time == data->sb.creation_time)
+      break;
+
+  if (e)
+    {
+      squash_cache_hits++;
+      /* Move to the front of the LRU list.  */
+      if (e->lru_prev)
+	{
+	  e->lru_prev->lru_next = e->lru_next;
+	  if (e->lru_next)
+	    e->lru_next->lru_prev = e->lru_prev;
+	  else
+	    squash_cache_tail = e->lru_prev;
+	  e->lru_prev = NULL;
+	  e->lru_next = squash_cache_head;
+	  squash_cache_head->lru_prev = e;
+	  squash_cache_head = e;
+	}
+      return e;
+    }
+
+  squash_cache_misses++;
+
+  tmp = grub_malloc (csize);
+  if (!tmp)
+    return NULL;
+  if (grub_disk_read (data->disk, pos >> GRUB_DISK_SECTOR_BITS,
+		      pos & (GRUB_DISK_SECTOR_SIZE - 1), csize, tmp))
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+
+  e = grub_malloc (sizeof (*e) + maxsize);
+  if (!e)
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+
+  size = data->decompress (tmp, csize, 0, e->data, maxsize, data);
+  grub_free (tmp);
+  if (size < 0)
+    {
+      grub_free (e);
+      return NULL;
+    }
+
+  e->dev_id = data->disk->dev->id;
+  e->disk_id = data->disk->id;
+  e->part_start = part_start;
+  e->creation_time = data->sb.creation_time;
+  e->pos = pos;
+  e->size = size;
+  e->alloc = sizeof (*e) + maxsize;
+  e->cached = 0;
+
+  if (e->alloc > squash_cache_max)
+    return e;
+
+  squash_cache_trim (squash_cache_max - e->alloc);
+  e->hash_next = squash_cache_hash[idx];
+  squash_cache_hash[idx] = e;
+  e->lru_prev = NULL;
+  e->lru_next = squash_cache_head;
+  if (squash_cache_head)
+    squash_cache_head->lru_prev = e;
+  else
+    squash_cache_tail = e;
+  squash_cache_head = e;
+  squash_cache_used += e->alloc;
+  e->cached = 1;
+
+  return e;
+}
+
+static void
+squash_cache_put (struct squash_cache_entry *e)
+{
+  if (!e->cached)
+    grub_free (e);
+}
+
+static char *
+squash_cache_write_size (struct grub_env_var *var __attribute__ ((unused)),
+			 const char *val)
+{
+  char *end;
+  unsigned long size;
+
+  size = grub_strtoul (val, &end, 0);
+  if (grub_errno || *end)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return grub_strdup (val);
+    }
+  squash_cache_max = (grub_size_t) size * 1024;
+  squash_cache_trim (squash_cache_max);
+  return grub_strdup (val);
+}
+
 static grub_err_t
 read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
 	    grub_uint64_t chunk_start, grub_off_t offset)
@@ -254,29 +463,20 @@ read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
 	}
       else
 	{
-	  char *tmp;
-	  grub_size_t bsize = grub_le_to_cpu16 (d) & ~SQUASH_CHUNK_FLAGS; 
-	  grub_disk_addr_t a = chunk_start + 2;
-	  tmp = grub_malloc (bsize);
-	  if (!tmp)
-	    return grub_errno;
-	  /* FIXME: buffer uncompressed data.  */
-	  err = grub_disk_read (data->disk, (a >> GRUB_DISK_SECTOR_BITS),
-				a & (GRUB_DISK_SECTOR_SIZE - 1),
-				bsize, tmp);
-	  if (err)
-	    {
-	      grub_free (tmp);
-	      return err;
-	    }
+	  struct squash_cache_entry *e;
+	  grub_size_t bsize = grub_le_to_cpu16 (d) & ~SQUASH_CHUNK_FLAGS;
 
-	  if (data->decompress (tmp, bsize, offset,
-				buf, csize, data) < 0)
+	  e = squash_cache_get (data, chunk_start + 2, bsize,
+				SQUASH_CHUNK_SIZE);
+	  if (!e)
+	    return grub_errno;
+	  if (e->size < offset + csize)
 	    {
-	      grub_free (tmp);
-	      return grub_errno;
+	      squash_cache_put (e);
+	      return grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
 	    }
-	  grub_free (tmp);
+	  grub_memcpy (buf, e->data + offset, csize);
+	  squash_cache_put (e);
 	}
       len -= csize;
       offset += csize;
@@ -285,6 +485,35 @@ read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
   return GRUB_ERR_NONE;
 }
 
+/* Decompress a whole block into OUTBUF when it fits and no offset is
+   wanted, otherwise through data->ubuf.  */
+static char *
+squash_block_buffer (grub_off_t off, char *outbuf, grub_size_t len,
+		     struct grub_squash_data *data, grub_size_t *size)
+{
+  if (off == 0 && len >= data->ubufsize)
+    {
+      *size = len;
+      return outbuf;
+    }
+  *size = data->ubufsize;
+  return data->ubuf;
+}
+
+static grub_ssize_t
+squash_block_copy (grub_size_t ret, grub_off_t off, char *outbuf,
+		   grub_size_t len, char *udata)
+{
+  if (udata == outbuf)
+    return ret;
+  if (ret <= off)
+    return 0;
+  if (len > ret - off)
+    len = ret - off;
+  grub_memcpy (outbuf, udata + off, len);
+  return len;
+}
+
 static grub_ssize_t
 zlib_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
 		 char *outbuf, grub_size_t outsize,
@@ -299,6 +528,7 @@ lzo_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
 {
   lzo_uint usize = data->blksz;
   grub_uint8_t *udata;
+  grub_ssize_t ret;
 
   if (usize < 8192)
     usize = 8192;
@@ -314,9 +544,9 @@ lzo_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
       grub_free (udata);
       return -1;
     }
-  grub_memcpy (outbuf, udata + off, len);
+  ret = squash_block_copy (usize, off, outbuf, len, (char *) udata);
   grub_free (udata);
-  return len;
+  return ret;
 }
 
 static grub_ssize_t
@@ -377,6 +607,50 @@ xz_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
   return ret;
 }
 
+static grub_ssize_t
+lz4_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
+		char *outbuf, grub_size_t len, struct grub_squash_data *data)
+{
+  grub_size_t usize;
+  grub_ssize_t ret;
+  char *udata;
+
+  udata = squash_block_buffer (off, outbuf, len, data, &usize);
+  ret = grub_lz4_decompress (inbuf, insize, udata, usize);
+  if (ret < 0)
+    return -1;
+  return squash_block_copy (ret, off, outbuf, len, udata);
+}
+
+static void *
+squash_zstd_malloc (void *state __attribute__ ((unused)), size_t size)
+{
+  return grub_malloc (size);
+}
+
+static void
+squash_zstd_free (void *state __attribute__ ((unused)), void *address)
+{
+  grub_free (address);
+}
+
+static grub_ssize_t
+zstd_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
+		 char *outbuf, grub_size_t len, struct grub_squash_data *data)
+{
+  grub_size_t usize, ret;
+  char *udata;
+
+  udata = squash_block_buffer (off, outbuf, len, data, &usize);
+  ret = ZSTD_decompressDCtx (data->zstdctx, udata, usize, inbuf, insize);
+  if (ZSTD_isError (ret))
+    {
+      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "zstd data corrupted");
+      return -1;
+    }
+  return squash_block_copy (ret, off, outbuf, len, udata);
+}
+
 static struct grub_squash_data *
 squash_mount (grub_disk_t disk)
 {
@@ -439,6 +713,27 @@ squash_mount (grub_disk_t disk)
 	  return NULL;
 	}
       break;
+    case grub_cpu_to_le16_compile_time (COMPRESSION_LZ4):
+      data->decompress = lz4_decompress;
+      break;
+    case grub_cpu_to_le16_compile_time (COMPRESSION_ZSTD):
+      {
+	ZSTD_customMem allocator;
+
+	allocator.customAlloc = squash_zstd_malloc;
+	allocator.customFree = squash_zstd_free;
+	allocator.opaque = NULL;
+	data->decompress = zstd_decompress;
+	data->zstdctx = ZSTD_createDCtx_advanced (allocator);
+	if (!data->zstdctx)
+	  {
+	    grub_free (data);
+	    grub_error (GRUB_ERR_OUT_OF_MEMORY,
+			"failed to create a zstd context");
+	    return NULL;
+	  }
+	break;
+      }
     default:
       grub_free (data);
       grub_error (GRUB_ERR_BAD_FS, "unsupported compression %d",
@@ -451,6 +746,22 @@ squash_mount (grub_disk_t disk)
        (1U << data->log2_blksz) < data->blksz;
        data->log2_blksz++);
 
+  if (data->decompress == lz4_decompress
+      || data->decompress == zstd_decompress)
+    {
+      data->ubufsize = data->blksz;
+      if (data->ubufsize < SQUASH_CHUNK_SIZE)
+	data->ubufsize = SQUASH_CHUNK_SIZE;
+      data->ubuf = grub_malloc (data->ubufsize);
+      if (!data->ubuf)
+	{
+	  if (data->zstdctx)
+	    ZSTD_freeDCtx (data->zstdctx);
+	  grub_free (data);
+	  return NULL;
+	}
+    }
+
   return data;
 }
 
@@ -628,9 +939,15 @@ make_root_node (struct grub_squash_data *data, struct grub_fshelp_node *root)
 static void
 squash_unmount (struct grub_squash_data *data)
 {
+  grub_dprintf ("squash4", "block cache: %lu hits, %lu misses, %"
+		PRIuGRUB_SIZE " bytes used\n", squash_cache_hits,
+		squash_cache_misses, squash_cache_used);
   if (data->xzdec)
     xz_dec_end (data->xzdec);
   grub_free (data->xzbuf);
+  if (data->zstdctx)
+    ZSTD_freeDCtx (data->zstdctx);
+  grub_free (data->ubuf);
   grub_free (data->ino.cumulated_block_sizes);
   grub_free (data->ino.block_sizes);
   grub_free (data);
@@ -935,32 +1252,24 @@ grub_squash_read (grub_file_t file, char *buf, grub_size_t len)
   else
     b = grub_le_to_cpu32 (ino->ino.file.offset) + off;
   
-  /* FIXME: cache uncompressed chunks.  */
   if (compressed)
     {
-      char *block;
-      block = grub_malloc (grub_le_to_cpu32 (frag.size));
-      if (!block)
+      struct squash_cache_entry *e;
+
+      /* Several small files usually share a fragment block, keep it
+	 decompressed.  */
+      e = squash_cache_get (data, a, grub_le_to_cpu32 (frag.size),
+			    data->blksz);
+      if (!e)
 	return -1;
-      err = grub_disk_read (data->disk,
-			    a >> GRUB_DISK_SECTOR_BITS,
-			    a & (GRUB_DISK_SECTOR_SIZE - 1),
-			    grub_le_to_cpu32 (frag.size), block);
-      if (err)
-	{
-	  grub_free (block);
-	  return -1;
-	}
-      if (data->decompress (block, grub_le_to_cpu32 (frag.size),
-			    b, buf, len, data)
-	  != (grub_ssize_t) len)
+      if (e->size < b + len)
 	{
-	  grub_free (block);
-	  if (!grub_errno)
-	    grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
+	  squash_cache_put (e);
+	  grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
 	  return -1;
 	}
-      grub_free (block);
+      grub_memcpy (buf, e->data + b, len);
+      squash_cache_put (e);
     }
   else
     {
@@ -1009,11 +1318,22 @@ static struct grub_fs grub_squash_fs =
 
 GRUB_MOD_INIT(squash4)
 {
+  const char *val;
+
   grub_fs_register (&grub_squash_fs);
+
+  /* The variable may have been set before the module got loaded.  */
+  val = grub_env_get ("squash4_cache_size");
+  if (val && *val)
+    grub_free (squash_cache_write_size (NULL, val));
+  grub_register_variable_hook ("squash4_cache_size", 0,
+			       squash_cache_write_size);
 }
 
 GRUB_MOD_FINI(squash4)
 {
+  grub_register_variable_hook ("squash4_cache_size", 0, 0);
+  squash_cache_trim (0);
   grub_fs_unregister (&grub_squash_fs);
 }
 
@@ -53,6 +53,7 @@
 #include <grub/zfs/dsl_dir.h>
 #include <grub/zfs/dsl_dataset.h>
 #include <grub/deflate.h>
+#include <grub/lz4.h>
 #include <grub/crypto.h>
 #include <grub/i18n.h>
 
@@ -159,8 +160,6 @@ ZAP_LEAF_ENTRY(zap_leaf_phys_t *l, int bs, int idx)
 
 extern grub_err_t lzjb_decompress (void *, void *, grub_size_t, grub_size_t);
 
-extern grub_err_t lz4_decompress (void *, void *, grub_size_t, grub_size_t);
-
 typedef grub_err_t zfs_decomp_func_t (void *s_start, void *d_start,
 				      grub_size_t s_len, grub_size_t d_len);
 typedef struct decomp_entry
@@ -227,6 +226,21 @@ struct subvolume
   } *keyring;
 };
 
+/* Number of decompressed indirect blocks kept per mount.  */
+#define ZFS_INDIRECT_CACHE_SIZE 16
+
+/* Upper bound on the size of one multi-block read.  */
+#define ZFS_MAX_RUN_SIZE (1 << 20)
+
+struct zfs_indirect_cache_entry
+{
+  dva_t dva;
+  grub_uint64_t birth;
+  blkptr_t *bps;
+  grub_size_t size;
+  grub_uint64_t last_use;
+};
+
 struct grub_zfs_data
 {
   /* cache for a file block of the currently zfs_open()-ed file */
@@ -234,6 +248,10 @@ struct grub_zfs_data
   grub_uint64_t file_start;
   grub_uint64_t file_end;
 
+  /* LRU cache of decompressed indirect blocks, keyed by their first DVA */
+  struct zfs_indirect_cache_entry indirect_cache[ZFS_INDIRECT_CACHE_SIZE];
+  grub_uint64_t indirect_cache_tick;
+
   /* cache for a dnode block */
   dnode_phys_t *dnode_buf;
   dnode_phys_t *dnode_mdn;
@@ -306,6 +324,25 @@ zlib_decompress (void *s, void *d,
   return grub_errno;
 }
 
+/* ZFS stores the length of the LZ4 block in front of it.  */
+static grub_err_t
+lz4_decompress (void *s, void *d, grub_size_t slen, grub_size_t dlen)
+{
+  const grub_uint8_t *src = s;
+  grub_uint32_t bufsiz;
+
+  /* invalid compressed buffer size encoded at start */
+  if (slen < 4)
+    return grub_error (GRUB_ERR_BAD_FS, "lz4 decompression failed.");
+  bufsiz = grub_be_to_cpu32 (grub_get_unaligned32 (src));
+  if (bufsiz > slen - 4)
+    return grub_error (GRUB_ERR_BAD_FS, "lz4 decompression failed.");
+
+  if (grub_lz4_decompress ((const char *) src + 4, bufsiz, d, dlen) < 0)
+    return grub_error (GRUB_ERR_BAD_FS, "lz4 decompression failed.");
+  return GRUB_ERR_NONE;
+}
+
 static grub_err_t 
 zle_decompress (void *s, void *d,
 		grub_size_t slen, grub_size_t dlen)
@@ -1838,6 +1875,85 @@ decode_embedded_bp_compressed(const blkptr_t *bp, void *buf)
   return GRUB_ERR_NONE;
 }
 
+/*
+ * Verify the checksum of the raw block in compbuf, decrypt it in place if
+ * needed and put the uncompressed data in dest.  dest may be compbuf for
+ * uncompressed blocks.
+ */
+static grub_err_t
+zio_decode (blkptr_t *bp, grub_zfs_endian_t endian, char *compbuf,
+	    grub_size_t psize, void *dest, grub_size_t lsize,
+	    struct grub_zfs_data *data)
+{
+  unsigned int comp, encrypted;
+  grub_err_t err = GRUB_ERR_NONE;
+  zio_cksum_t zc = bp->blk_cksum;
+  grub_uint32_t checksum;
+
+  checksum = (grub_zfs_to_cpu64((bp)->blk_prop, endian) >> 40) & 0xff;
+  comp = (grub_zfs_to_cpu64((bp)->blk_prop, endian)>>32) & 0x7f;
+  encrypted = ((grub_zfs_to_cpu64((bp)->blk_prop, endian) >> 60) & 3);
+
+  if (!BP_IS_EMBEDDED(bp))
+    {
+      err = zio_checksum_verify (zc, checksum, endian,
+			         compbuf, psize);
+      if (err)
+        {
+          grub_dprintf ("zfs", "incorrect checksum\n");
+          return err;
+        }
+    }
+
+  if (encrypted)
+    {
+      if (!grub_zfs_decrypt)
+	err = grub_error (GRUB_ERR_BAD_FS, 
+			  N_("module `%s' isn't loaded"),
+			  "zfscrypt");
+      else
+	{
+	  unsigned i, besti = 0;
+	  grub_uint64_t bestval = 0;
+	  for (i = 0; i < data->subvol.nkeys; i++)
+	    if (data->subvol.keyring[i].txg <= grub_zfs_to_cpu64 (bp->blk_birth,
+								  endian)
+		&& data->subvol.keyring[i].txg > bestval)
+	      {
+		besti = i;
+		bestval = data->subvol.keyring[i].txg;
+	      }
+	  if (bestval == 0)
+	    {
+	      grub_dprintf ("zfs", "no key for txg %" PRIxGRUB_UINT64_T "\n",
+			    grub_zfs_to_cpu64 (bp->blk_birth,
+					       endian));
+	      return grub_error (GRUB_ERR_BAD_FS, "no key found in keychain");
+	    }
+	  grub_dprintf ("zfs", "using key %u (%" PRIxGRUB_UINT64_T 
+			", %p) for txg %" PRIxGRUB_UINT64_T "\n",
+			besti, data->subvol.keyring[besti].txg,
+			data->subvol.keyring[besti].cipher,
+			grub_zfs_to_cpu64 (bp->blk_birth,
+					   endian));
+	  err = grub_zfs_decrypt (data->subvol.keyring[besti].cipher,
+				  data->subvol.keyring[besti].algo,
+				  &(bp)->blk_dva[encrypted],
+				  compbuf, psize, zc.zc_mac,
+				  endian);
+	}
+      if (err)
+	return err;
+    }
+
+  if (comp != ZIO_COMPRESS_OFF)
+    return decomp_table[comp].decomp_func (compbuf, dest, psize, lsize);
+
+  if (dest != compbuf)
+    grub_memcpy (dest, compbuf, lsize);
+  return GRUB_ERR_NONE;
+}
+
 /*
  * Read in a block of data, verify its checksum, decompress if needed,
  * and put the uncompressed data in buf.
@@ -1847,17 +1963,13 @@ zio_read (blkptr_t *bp, grub_zfs_endian_t endian, void **buf,
 	  grub_size_t *size, struct grub_zfs_data *data)
 {
   grub_size_t lsize, psize;
-  unsigned int comp, encrypted;
+  unsigned int comp;
   char *compbuf = NULL;
   grub_err_t err;
-  zio_cksum_t zc = bp->blk_cksum;
-  grub_uint32_t checksum;
 
   *buf = NULL;
 
-  checksum = (grub_zfs_to_cpu64((bp)->blk_prop, endian) >> 40) & 0xff;
   comp = (grub_zfs_to_cpu64((bp)->blk_prop, endian)>>32) & 0x7f;
-  encrypted = ((grub_zfs_to_cpu64((bp)->blk_prop, endian) >> 60) & 3);
   if (BP_IS_EMBEDDED(bp))
     {
       if (BPE_GET_ETYPE(bp) != BP_EMBEDDED_TYPE_DATA)
@@ -1913,85 +2025,124 @@ zio_read (blkptr_t *bp, grub_zfs_endian_t endian, void **buf,
       return err;
     }
 
-  if (!BP_IS_EMBEDDED(bp))
-    {
-      err = zio_checksum_verify (zc, checksum, endian,
-			         compbuf, psize);
-      if (err)
-        {
-          grub_dprintf ("zfs", "incorrect checksum\n");
-          grub_free (compbuf);
-          *buf = NULL;
-          return err;
-        }
-    }
-
-  if (encrypted)
+  if (comp != ZIO_COMPRESS_OFF)
     {
-      if (!grub_zfs_decrypt)
-	err = grub_error (GRUB_ERR_BAD_FS, 
-			  N_("module `%s' isn't loaded"),
-			  "zfscrypt");
-      else
-	{
-	  unsigned i, besti = 0;
-	  grub_uint64_t bestval = 0;
-	  for (i = 0; i < data->subvol.nkeys; i++)
-	    if (data->subvol.keyring[i].txg <= grub_zfs_to_cpu64 (bp->blk_birth,
-								  endian)
-		&& data->subvol.keyring[i].txg > bestval)
-	      {
-		besti = i;
-		bestval = data->subvol.keyring[i].txg;
-	      }
-	  if (bestval == 0)
-	    {
-	      grub_free (compbuf);
-	      *buf = NULL;
-	      grub_dprintf ("zfs", "no key for txg %" PRIxGRUB_UINT64_T "\n",
-			    grub_zfs_to_cpu64 (bp->blk_birth,
-					       endian));
-	      return grub_error (GRUB_ERR_BAD_FS, "no key found in keychain");
-	    }
-	  grub_dprintf ("zfs", "using key %u (%" PRIxGRUB_UINT64_T 
-			", %p) for txg %" PRIxGRUB_UINT64_T "\n",
-			besti, data->subvol.keyring[besti].txg,
-			data->subvol.keyring[besti].cipher,
-			grub_zfs_to_cpu64 (bp->blk_birth,
-					   endian));
-	  err = grub_zfs_decrypt (data->subvol.keyring[besti].cipher,
-				  data->subvol.keyring[besti].algo,
-				  &(bp)->blk_dva[encrypted],
-				  compbuf, psize, zc.zc_mac,
-				  endian);
-	}
-      if (err)
+      *buf = grub_malloc (lsize);
+      if (!*buf)
 	{
 	  grub_free (compbuf);
-	  *buf = NULL;
-	  return err;
+	  return grub_errno;
 	}
     }
 
+  err = zio_decode (bp, endian, compbuf, psize, *buf, lsize, data);
   if (comp != ZIO_COMPRESS_OFF)
+    grub_free (compbuf);
+  if (err)
     {
-      *buf = grub_malloc (lsize);
-      if (!*buf)
+      grub_free (*buf);
+      *buf = NULL;
+      return err;
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+/*
+ * Read the indirect block bp points to, going through the per-mount cache.
+ * The returned array is owned by the cache and stays valid until the next
+ * call.
+ */
+static grub_err_t
+zio_read_indirect (blkptr_t *bp, grub_zfs_endian_t endian,
+		   blkptr_t **bps, grub_size_t *nbps,
+		   struct grub_zfs_data *data)
+{
+  struct zfs_indirect_cache_entry *entry, *victim = NULL;
+  unsigned i;
+  void *buf;
+  grub_size_t size;
+  grub_err_t err;
+
+  for (i = 0; i < ZFS_INDIRECT_CACHE_SIZE; i++)
+    {
+      entry = &data->indirect_cache[i];
+      if (entry->bps
+	  && entry->dva.dva_word[0] == bp->blk_dva[0].dva_word[0]
+	  && entry->dva.dva_word[1] == bp->blk_dva[0].dva_word[1]
+	  && entry->birth == bp->blk_birth)
 	{
-	  grub_free (compbuf);
-	  return grub_errno;
+	  entry->last_use = ++data->indirect_cache_tick;
+	  *bps = entry->bps;
+	  *nbps = entry->size / sizeof (blkptr_t);
+	  return GRUB_ERR_NONE;
 	}
+      if (!victim || !entry->bps
+	  || (victim->bps && entry->last_use < victim->last_use))
+	victim = entry;
+    }
 
-      err = decomp_table[comp].decomp_func (compbuf, *buf, psize, lsize);
-      grub_free (compbuf);
-      if (err)
+  err = zio_read (bp, endian, &buf, &size, data);
+  if (err)
+    return err;
+
+  grub_free (victim->bps);
+  victim->dva = bp->blk_dva[0];
+  victim->birth = bp->blk_birth;
+  victim->bps = buf;
+  victim->size = size;
+  victim->last_use = ++data->indirect_cache_tick;
+
+  *bps = victim->bps;
+  *nbps = size / sizeof (blkptr_t);
+  return GRUB_ERR_NONE;
+}
+
+/*
+ * Walk down from the top-level block pointers of the dnode to the array of
+ * level-0 block pointers covering blkid and set *idx to the position of
+ * blkid in it.  If an indirect block on the way is a hole, *bps is set to
+ * NULL and *endian to the endianness of the hole.
+ */
+static grub_err_t
+dmu_get_level0 (dnode_end_t * dn, grub_uint64_t blkid, blkptr_t **bps,
+		grub_size_t *nbps, grub_size_t *idx,
+		grub_zfs_endian_t *endian, struct grub_zfs_data *data)
+{
+  int level;
+  int epbs = dn->dn.dn_indblkshift - SPA_BLKPTRSHIFT;
+  blkptr_t *bp_array = dn->dn.dn_blkptr;
+  grub_size_t n = dn->dn.dn_nblkptr;
+  grub_zfs_endian_t cur_endian = dn->endian;
+  blkptr_t bp;
+  grub_err_t err;
+
+  for (level = dn->dn.dn_nlevels - 1; level > 0; level--)
+    {
+      grub_size_t i = (blkid >> (epbs * level)) & ((1 << epbs) - 1);
+
+      if (bp_array != dn->dn.dn_blkptr && i >= n)
+	return grub_error (GRUB_ERR_BAD_FS, "indirect block too small");
+      bp = bp_array[i];
+      if (BP_IS_HOLE (&bp))
 	{
-	  grub_free (*buf);
-	  *buf = NULL;
-	  return err;
+	  *bps = NULL;
+	  *endian = (grub_zfs_to_cpu64 (bp.blk_prop, cur_endian) >> 63) & 1;
+	  return GRUB_ERR_NONE;
 	}
+      grub_dprintf ("zfs", "endian = %d\n", cur_endian);
+      err = zio_read_indirect (&bp, cur_endian, &bp_array, &n, data);
+      if (err)
+	return err;
+      cur_endian = (grub_zfs_to_cpu64 (bp.blk_prop, cur_endian) >> 63) & 1;
     }
 
+  *idx = blkid & ((1 << epbs) - 1);
+  if (bp_array != dn->dn.dn_blkptr && *idx >= n)
+    return grub_error (GRUB_ERR_BAD_FS, "indirect block too small");
+  *bps = bp_array;
+  *nbps = n;
+  *endian = cur_endian;
   return GRUB_ERR_NONE;
 }
 
@@ -2004,67 +2155,177 @@ static grub_err_t
 dmu_read (dnode_end_t * dn, grub_uint64_t blkid, void **buf, 
 	  grub_zfs_endian_t *endian_out, struct grub_zfs_data *data)
 {
-  int level;
-  grub_off_t idx;
-  blkptr_t *bp_array = dn->dn.dn_blkptr;
-  int epbs = dn->dn.dn_indblkshift - SPA_BLKPTRSHIFT;
-  blkptr_t *bp;
-  void *tmpbuf = 0;
+  blkptr_t *bp_array;
+  blkptr_t bp;
+  grub_size_t nbps, idx;
   grub_zfs_endian_t endian;
-  grub_err_t err = GRUB_ERR_NONE;
+  grub_err_t err;
 
-  bp = grub_malloc (sizeof (blkptr_t));
-  if (!bp)
-    return grub_errno;
+  err = dmu_get_level0 (dn, blkid, &bp_array, &nbps, &idx, &endian, data);
+  if (err)
+    return err;
 
-  endian = dn->endian;
-  for (level = dn->dn.dn_nlevels - 1; level >= 0; level--)
+  if (bp_array)
+    bp = bp_array[idx];
+  else
+    grub_memset (&bp, 0, sizeof (bp));
+  if (!bp_array || BP_IS_HOLE (&bp))
+    {
+      grub_size_t size = grub_zfs_to_cpu16 (dn->dn.dn_datablkszsec, 
+					    dn->endian) 
+	<< SPA_MINBLOCKSHIFT;
+      *buf = grub_malloc (size);
+      if (!*buf)
+	return grub_errno;
+      grub_memset (*buf, 0, size);
+      if (bp_array)
+	endian = (grub_zfs_to_cpu64 (bp.blk_prop, endian) >> 63) & 1;
+    }
+  else
     {
       grub_dprintf ("zfs", "endian = %d\n", endian);
-      idx = (blkid >> (epbs * level)) & ((1 << epbs) - 1);
-      *bp = bp_array[idx];
-      if (bp_array != dn->dn.dn_blkptr)
-	{
-	  grub_free (bp_array);
-	  bp_array = 0;
-	}
+      err = zio_read (&bp, endian, buf, 0, data);
+      endian = (grub_zfs_to_cpu64 (bp.blk_prop, endian) >> 63) & 1;
+    }
+  if (endian_out)
+    *endian_out = endian;
 
-      if (BP_IS_HOLE (bp))
-	{
-	  grub_size_t size = grub_zfs_to_cpu16 (dn->dn.dn_datablkszsec, 
-						dn->endian) 
-	    << SPA_MINBLOCKSHIFT;
-	  *buf = grub_malloc (size);
-	  if (!*buf)
-	    {
-	      err = grub_errno;
-	      break;
-	    }
-	  grub_memset (*buf, 0, size);
-	  endian = (grub_zfs_to_cpu64 (bp->blk_prop, endian) >> 63) & 1;
-	  break;
-	}
-      if (level == 0)
+  return err;
+}
+
+/*
+ * Whether bp can be part of a multi-block read of blocks of size blksz.
+ * *asize is set to the space the block takes on disk, which is larger
+ * than its physical size when the pool pads blocks to 1 << ashift.
+ */
+static int
+dmu_run_eligible (blkptr_t *bp, grub_zfs_endian_t endian, grub_size_t blksz,
+		  grub_uint64_t *asize)
+{
+  grub_uint64_t prop = grub_zfs_to_cpu64 (bp->blk_prop, endian);
+  unsigned int comp = (prop >> 32) & 0x7f;
+  grub_size_t lsize = ((prop & 0xffff) + 1) << SPA_MINBLOCKSHIFT;
+  grub_size_t psize = get_psize (bp, endian);
+
+  if (BP_IS_HOLE (bp) || BP_IS_EMBEDDED (bp) || lsize != blksz)
+    return 0;
+  if (comp >= ZIO_COMPRESS_FUNCTIONS
+      || (comp != ZIO_COMPRESS_OFF && decomp_table[comp].decomp_func == NULL)
+      || (comp == ZIO_COMPRESS_OFF && psize != lsize))
+    return 0;
+  if ((grub_zfs_to_cpu64 (bp->blk_dva[0].dva_word[1], endian) >> 63) & 1)
+    return 0;
+  *asize = (grub_zfs_to_cpu64 (bp->blk_dva[0].dva_word[0], endian)
+	    & 0xffffff) << SPA_MINBLOCKSHIFT;
+  return *asize >= psize;
+}
+
+/* Whether top-level vdev VDEV stores blocks as plain byte ranges, so that
+   neighbouring blocks can be read together.  RAID-Z interleaves parity.  */
+static int
+dmu_run_vdev_linear (struct grub_zfs_data *data, grub_uint64_t vdev)
+{
+  unsigned i;
+
+  for (i = 0; i < data->n_devices_attached; i++)
+    if (data->devices_attached[i].id == vdev)
+      return data->devices_attached[i].type != DEVICE_RAIDZ;
+  return 0;
+}
+
+/*
+ * Read up to nblks consecutive level-0 blocks starting at blkid straight
+ * into buf.  Blocks referenced by the same indirect block that are stored
+ * back to back on disk are fetched with a single device read and then
+ * verified and decompressed one by one.  *nread is the number of blocks
+ * read; it is 0 if blkid can't start such a run, in which case the caller
+ * should fall back to dmu_read.
+ */
+static grub_err_t
+dmu_read_run (dnode_end_t * dn, grub_uint64_t blkid, grub_uint64_t nblks,
+	      grub_size_t blksz, char *buf, grub_uint64_t *nread,
+	      struct grub_zfs_data *data)
+{
+  blkptr_t *bp_array;
+  grub_size_t nbps, idx, n, i, total, off;
+  grub_zfs_endian_t endian;
+  grub_uint64_t vdev, start, next, asize;
+  char *compbuf;
+  grub_err_t err;
+
+  *nread = 0;
+
+  err = dmu_get_level0 (dn, blkid, &bp_array, &nbps, &idx, &endian, data);
+  if (err || !bp_array)
+    return err;
+
+  if (!dmu_run_eligible (&bp_array[idx], endian, blksz, &asize))
+    return GRUB_ERR_NONE;
+
+  vdev = grub_zfs_to_cpu64 (bp_array[idx].blk_dva[0].dva_word[0],
+			    endian) >> 32;
+  if (!dmu_run_vdev_linear (data, vdev))
+    return GRUB_ERR_NONE;
+
+  /* Blocks follow each other at their allocated size.  The padding after
+     each one is read along and skipped.  */
+  start = dva_get_offset (&bp_array[idx].blk_dva[0], endian);
+  total = get_psize (&bp_array[idx], endian);
+  next = start + asize;
+  for (n = 1; n < nblks && idx + n < nbps; n++)
+    {
+      blkptr_t *bp = &bp_array[idx + n];
+
+      if (!dmu_run_eligible (bp, endian, blksz, &asize)
+	  || (grub_zfs_to_cpu64 (bp->blk_dva[0].dva_word[0], endian) >> 32)
+	  != vdev
+	  || dva_get_offset (&bp->blk_dva[0], endian) != next
+	  || next - start + get_psize (bp, endian) > ZFS_MAX_RUN_SIZE)
+	break;
+      total = next - start + get_psize (bp, endian);
+      next += asize;
+    }
+
+  if (n < 2)
+    return GRUB_ERR_NONE;
+
+  grub_dprintf ("zfs", "reading %" PRIuGRUB_SIZE " blocks at %"
+		PRIuGRUB_UINT64_T " in one go\n", n, blkid);
+
+  /* Padded like in zio_read.  Physical sizes are whole sectors, so only
+     the end of the run needs it.  */
+  compbuf = grub_malloc (ALIGN_UP (total, 16));
+  if (!compbuf)
+    return grub_errno;
+
+  /* On failure leave it to dmu_read, which can try the other DVAs.  */
+  err = read_dva (&bp_array[idx].blk_dva[0], endian, data, compbuf, total);
+  if (err)
+    {
+      grub_free (compbuf);
+      grub_errno = GRUB_ERR_NONE;
+      return GRUB_ERR_NONE;
+    }
+  grub_memset (compbuf + total, 0, ALIGN_UP (total, 16) - total);
+
+  for (i = 0; i < n; i++)
+    {
+      blkptr_t bp = bp_array[idx + i];
+      grub_size_t psize = get_psize (&bp, endian);
+
+      off = dva_get_offset (&bp.blk_dva[0], endian) - start;
+      err = zio_decode (&bp, endian, compbuf + off, psize, buf + i * blksz,
+			blksz, data);
+      if (err)
 	{
-	  grub_dprintf ("zfs", "endian = %d\n", endian);
-	  err = zio_read (bp, endian, buf, 0, data);
-	  endian = (grub_zfs_to_cpu64 (bp->blk_prop, endian) >> 63) & 1;
+	  grub_errno = GRUB_ERR_NONE;
 	  break;
 	}
-      grub_dprintf ("zfs", "endian = %d\n", endian);
-      err = zio_read (bp, endian, &tmpbuf, 0, data);
-      endian = (grub_zfs_to_cpu64 (bp->blk_prop, endian) >> 63) & 1;
-      if (err)
-	break;
-      bp_array = tmpbuf;
     }
-  if (bp_array != dn->dn.dn_blkptr)
-    grub_free (bp_array);
-  if (endian_out)
-    *endian_out = endian;
+  grub_free (compbuf);
 
-  grub_free (bp);
-  return err;
+  *nread = i;
+  return GRUB_ERR_NONE;
 }
 
 /*
@@ -3597,6 +3858,8 @@ zfs_unmount (struct grub_zfs_data *data)
   grub_free (data->dnode_buf);
   grub_free (data->dnode_mdn);
   grub_free (data->file_buf);
+  for (i = 0; i < ZFS_INDIRECT_CACHE_SIZE; i++)
+    grub_free (data->indirect_cache[i].bps);
   for (i = 0; i < data->subvol.nkeys; i++)
     grub_crypto_cipher_close (data->subvol.keyring[i].cipher);
   grub_free (data->subvol.keyring);
@@ -3881,19 +4144,40 @@ grub_zfs_read (grub_file_t file, char *buf, grub_size_t len)
 
   /*
    * Entire Dnode is too big to fit into the space available.  We
-   * will need to read it in chunks.  This could be optimized to
-   * read in as large a chunk as there is space available, but for
-   * now, this only reads in one data block at a time.
+   * will need to read it in chunks.  Whole blocks are read straight
+   * into the caller's buffer, several at a time where they are
+   * contiguous on disk; partial blocks go through file_buf.
    */
   length = len;
   read = 0;
   while (length)
     {
       void *t;
+      grub_uint64_t blkoff;
       /*
        * Find requested blkid and the offset within that block.
        */
-      grub_uint64_t blkid = grub_divmod64 (file->offset + read, blksz, 0);
+      grub_uint64_t blkid = grub_divmod64 (file->offset + read, blksz,
+					   &blkoff);
+
+      if (blkoff == 0 && length >= 2 * blksz)
+	{
+	  grub_uint64_t nblks;
+
+	  err = dmu_read_run (&(data->dnode), blkid,
+			      grub_divmod64 (length, blksz, 0), blksz,
+			      buf, &nblks, data);
+	  if (err)
+	    return -1;
+	  if (nblks)
+	    {
+	      buf += nblks * blksz;
+	      length -= nblks * blksz;
+	      read += nblks * blksz;
+	      continue;
+	    }
+	}
+
       grub_free (data->file_buf);
       data->file_buf = 0;
 
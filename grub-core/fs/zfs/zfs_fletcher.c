@@ -60,17 +60,63 @@ fletcher_2(const void *buf, grub_uint64_t size, grub_zfs_endian_t endian,
   zcp->zc_word[3] = grub_cpu_to_zfs64 (b1, endian);
 }
 
+/*
+ * Fletcher-4 is a chain of four dependent sums, so a straightforward loop
+ * does one addition at a time.  Instead, run four independent Fletcher-4
+ * lanes over words 4m, 4m+1, 4m+2 and 4m+3, which keeps the CPU's adders
+ * busy, and combine the lanes at the end.  For a word that lane j sees k
+ * steps before the end, the sequential sums weight it by 4k-j,
+ * C(4k-j+1,2) and C(4k-j+2,3); rewriting these in terms of the lane
+ * weights k, C(k+1,2) and C(k+2,3) gives the coefficients below.
+ */
+#define FLETCHER_4_STEP(load, w, a, b, c, d)			\
+  do								\
+    {								\
+      a += load (w);						\
+      b += a;							\
+      c += b;							\
+      d += c;							\
+    }								\
+  while (0)
+
+#define FLETCHER_4_LANES(load)					\
+  for (; ip + 4 <= ipend; ip += 4)				\
+    {								\
+      FLETCHER_4_STEP (load, ip[0], a0, b0, c0, d0);		\
+      FLETCHER_4_STEP (load, ip[1], a1, b1, c1, d1);		\
+      FLETCHER_4_STEP (load, ip[2], a2, b2, c2, d2);		\
+      FLETCHER_4_STEP (load, ip[3], a3, b3, c3, d3);		\
+    }
+
 void
 fletcher_4 (const void *buf, grub_uint64_t size, grub_zfs_endian_t endian, 
 	    zio_cksum_t *zcp)
 {
   const grub_uint32_t *ip = buf;
   const grub_uint32_t *ipend = ip + (size / sizeof (grub_uint32_t));
+  grub_uint64_t a0 = 0, b0 = 0, c0 = 0, d0 = 0;
+  grub_uint64_t a1 = 0, b1 = 0, c1 = 0, d1 = 0;
+  grub_uint64_t a2 = 0, b2 = 0, c2 = 0, d2 = 0;
+  grub_uint64_t a3 = 0, b3 = 0, c3 = 0, d3 = 0;
   grub_uint64_t a, b, c, d;
-  
-  for (a = b = c = d = 0; ip < ipend; ip++) 
+
+  /* Keep the byte order test out of the inner loop.  */
+  if (endian == GRUB_ZFS_BIG_ENDIAN)
+    FLETCHER_4_LANES (grub_be_to_cpu32)
+  else
+    FLETCHER_4_LANES (grub_le_to_cpu32)
+
+  a = a0 + a1 + a2 + a3;
+  b = 4 * (b0 + b1 + b2 + b3) - a1 - 2 * a2 - 3 * a3;
+  c = 16 * (c0 + c1 + c2 + c3) - 6 * b0 - 10 * b1 - 14 * b2 - 18 * b3
+    + a2 + 3 * a3;
+  d = 64 * (d0 + d1 + d2 + d3) - 48 * c0 - 64 * c1 - 80 * c2 - 96 * c3
+    + 4 * b0 + 10 * b1 + 20 * b2 + 34 * b3 - a3;
+
+  /* Up to three words remain.  */
+  for (; ip < ipend; ip++) 
     {
-      a += grub_zfs_to_cpu32 (ip[0], endian);;
+      a += grub_zfs_to_cpu32 (ip[0], endian);
       b += a;
       c += b;
       d += c;
@@ -81,4 +127,3 @@ fletcher_4 (const void *buf, grub_uint64_t size, grub_zfs_endian_t endian,
   zcp->zc_word[2] = grub_cpu_to_zfs64 (c, endian);
   zcp->zc_word[3] = grub_cpu_to_zfs64 (d, endian);
 }
-
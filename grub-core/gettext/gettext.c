@@ -36,12 +36,6 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 static const char *(*grub_gettext_original) (const char *s);
 
-struct grub_gettext_msg
-{
-  char *name;
-  char *translated;
-};
-
 struct header
 {
   grub_uint32_t magic;
@@ -49,6 +43,8 @@ struct header
   grub_uint32_t number_of_strings;
   grub_uint32_t offset_original;
   grub_uint32_t offset_translation;
+  grub_uint32_t hash_size;
+  grub_uint32_t offset_hash;
 };
 
 struct string_descriptor 
@@ -57,191 +53,165 @@ struct string_descriptor
   grub_uint32_t offset;
 };
 
+/* The whole catalog is read into memory once, lookups then use the hash
+   table stored in the file, or bisection of the sorted original strings
+   when the file has none.  */
 struct grub_gettext_context
 {
-  grub_file_t fd_mo;
-  grub_off_t grub_gettext_offset_original;
-  grub_off_t grub_gettext_offset_translation;
+  char *mo;
+  grub_size_t mo_size;
   grub_size_t grub_gettext_max;
-  int grub_gettext_max_log;
-  struct grub_gettext_msg *grub_gettext_msg_list;
+  grub_uint32_t grub_gettext_offset_original;
+  grub_uint32_t grub_gettext_offset_translation;
+  grub_uint32_t hash_size;
+  grub_uint32_t offset_hash;
+  /* Translations handed out so far.  They are copied out of the catalog
+     and never freed, callers may hold on to them across a language
+     change.  */
+  char **translated;
 };
 
 static struct grub_gettext_context main_context, secondary_context;
 
 #define MO_MAGIC_NUMBER 		0x950412de
 
-static grub_err_t
-grub_gettext_pread (grub_file_t file, void *buf, grub_size_t len,
-		    grub_off_t offset)
+static grub_uint32_t
+grub_gettext_read32 (struct grub_gettext_context *ctx, grub_size_t offset)
 {
-  if (len == 0)
-    return GRUB_ERR_NONE;
-  if (grub_file_seek (file, offset) == (grub_off_t) - 1)
-    return grub_errno;
-  if (grub_file_read (file, buf, len) != (grub_ssize_t) len)
-    {
-      if (!grub_errno)
-	grub_error (GRUB_ERR_READ_ERROR, N_("premature end of file"));
-      return grub_errno;
-    }
-  return GRUB_ERR_NONE;
+  return grub_le_to_cpu32 (grub_get_unaligned32 (ctx->mo + offset));
 }
 
-static char *
+/* Return the string at POSITION in the descriptor table at OFF.  The
+   descriptors were checked when the catalog was loaded.  */
+static const char *
 grub_gettext_getstr_from_position (struct grub_gettext_context *ctx,
-				   grub_off_t off,
+				   grub_uint32_t off,
 				   grub_size_t position)
 {
-  grub_off_t internal_position;
-  grub_size_t length;
-  grub_off_t offset;
-  char *translation;
-  struct string_descriptor desc;
-  grub_err_t err;
-
-  internal_position = (off + position * sizeof (desc));
-
-  err = grub_gettext_pread (ctx->fd_mo, (char *) &desc,
-			    sizeof (desc), internal_position);
-  if (err)
-    return NULL;
-  length = grub_cpu_to_le32 (desc.length);
-  offset = grub_cpu_to_le32 (desc.offset);
-
-  translation = grub_malloc (length + 1);
-  if (!translation)
-    return NULL;
-
-  err = grub_gettext_pread (ctx->fd_mo, translation, length, offset);
-  if (err)
-    {
-      grub_free (translation);
-      return NULL;
-    }
-  translation[length] = '\0';
-
-  return translation;
+  return ctx->mo + grub_gettext_read32 (ctx, off + position
+					* sizeof (struct string_descriptor)
+					+ 4);
 }
 
 static const char *
 grub_gettext_gettranslation_from_position (struct grub_gettext_context *ctx,
 					   grub_size_t position)
 {
-  if (!ctx->grub_gettext_msg_list[position].translated)
-    ctx->grub_gettext_msg_list[position].translated
-      = grub_gettext_getstr_from_position (ctx,
-					   ctx->grub_gettext_offset_translation,
-					   position);
-  return ctx->grub_gettext_msg_list[position].translated;
+  if (!ctx->translated[position])
+    ctx->translated[position]
+      = grub_strdup (grub_gettext_getstr_from_position (ctx,
+							 ctx->grub_gettext_offset_translation,
+							 position));
+  return ctx->translated[position];
 }
 
 static const char *
 grub_gettext_getstring_from_position (struct grub_gettext_context *ctx,
 				      grub_size_t position)
 {
-  if (!ctx->grub_gettext_msg_list[position].name)
-    ctx->grub_gettext_msg_list[position].name
-      = grub_gettext_getstr_from_position (ctx,
-					   ctx->grub_gettext_offset_original,
-					   position);
-  return ctx->grub_gettext_msg_list[position].name;
+  return grub_gettext_getstr_from_position (ctx,
+					    ctx->grub_gettext_offset_original,
+					    position);
 }
 
-static const char *
-grub_gettext_translate_real (struct grub_gettext_context *ctx,
-			     const char *orig)
+/* The hash function used by GNU gettext for the table in .mo files.  */
+static grub_uint32_t
+grub_gettext_hash (const char *str)
 {
-  grub_size_t current = 0;
-  int i;
-  const char *current_string;
-  static int depth = 0;
+  grub_uint32_t hval = 0, g;
 
-  if (!ctx->grub_gettext_msg_list || !ctx->fd_mo)
-    return NULL;
+  while (*str)
+    {
+      hval = (hval << 4) + (grub_uint8_t) *str++;
+      g = hval & 0xf0000000;
+      if (g)
+	{
+	  hval ^= g >> 24;
+	  hval ^= g;
+	}
+    }
+  return hval;
+}
 
-  /* Shouldn't happen. Just a precaution if our own code
-     calls gettext somehow.  */
-  if (depth > 2)
-    return NULL;
-  depth++;
+/* Return the position of ORIG, or -1 if it isn't in the catalog.  */
+static grub_ssize_t
+grub_gettext_find (struct grub_gettext_context *ctx, const char *orig)
+{
+  grub_size_t current = 0;
+  int i;
 
-  /* Make sure we can use grub_gettext_translate for error messages.  Push
-     active error message to error stack and reset error message.  */
-  grub_error_push ();
+  if (ctx->hash_size > 2)
+    {
+      grub_uint32_t hash = grub_gettext_hash (orig);
+      grub_uint32_t idx = hash % ctx->hash_size;
+      grub_uint32_t incr = 1 + (hash % (ctx->hash_size - 2));
+      grub_uint32_t n, probes;
+
+      /* Every slot is visited at most once.  A table without an empty
+	 slot would otherwise be probed forever, leave it to bisection.  */
+      for (probes = 0; probes < ctx->hash_size; probes++)
+	{
+	  n = grub_gettext_read32 (ctx, ctx->offset_hash + idx * 4);
+	  if (n == 0 || n > ctx->grub_gettext_max)
+	    return -1;
+	  if (grub_strcmp (grub_gettext_getstring_from_position (ctx, n - 1),
+			   orig) == 0)
+	    return n - 1;
+	  if (idx >= ctx->hash_size - incr)
+	    idx -= ctx->hash_size - incr;
+	  else
+	    idx += incr;
+	}
+    }
 
-  for (i = ctx->grub_gettext_max_log; i >= 0; i--)
+  /* Search by bisection.  */
+  for (i = sizeof (grub_size_t) * 8 - 1; i >= 0; i--)
     {
       grub_size_t test;
       int cmp;
 
-      test = current | (1 << i);
+      test = current | ((grub_size_t) 1 << i);
       if (test >= ctx->grub_gettext_max)
 	continue;
 
-      current_string = grub_gettext_getstring_from_position (ctx, test);
-
-      if (!current_string)
-	{
-	  grub_errno = GRUB_ERR_NONE;
-	  grub_error_pop ();
-	  depth--;
-	  return NULL;
-	}
-
-      /* Search by bisection.  */
-      cmp = grub_strcmp (current_string, orig);
+      cmp = grub_strcmp (grub_gettext_getstring_from_position (ctx, test),
+			 orig);
       if (cmp <= 0)
 	current = test;
       if (cmp == 0)
-	{
-	  const char *ret = 0;
-	  ret = grub_gettext_gettranslation_from_position (ctx, current);
-	  if (!ret)
-	    {
-	      grub_errno = GRUB_ERR_NONE;
-	      grub_error_pop ();
-	      depth--;
-	      return NULL;
-	    }
-	  grub_error_pop ();
-	  depth--;
-	  return ret;      
-	}
+	return current;
     }
 
-  if (current == 0 && ctx->grub_gettext_max != 0)
-    {
-      current_string = grub_gettext_getstring_from_position (ctx, 0);
+  if (ctx->grub_gettext_max != 0
+      && grub_strcmp (grub_gettext_getstring_from_position (ctx, 0),
+		      orig) == 0)
+    return 0;
 
-      if (!current_string)
-	{
-	  grub_errno = GRUB_ERR_NONE;
-	  grub_error_pop ();
-	  depth--;
-	  return NULL;
-	}
+  return -1;
+}
 
-      if (grub_strcmp (current_string, orig) == 0)
-	{
-	  const char *ret = 0;
-	  ret = grub_gettext_gettranslation_from_position (ctx, current);
-	  if (!ret)
-	    {
-	      grub_errno = GRUB_ERR_NONE;
-	      grub_error_pop ();
-	      depth--;
-	      return NULL;
-	    }
-	  grub_error_pop ();
-	  depth--;
-	  return ret;      
-	}
-    }
+static const char *
+grub_gettext_translate_real (struct grub_gettext_context *ctx,
+			     const char *orig)
+{
+  grub_ssize_t position;
+  const char *ret;
+  grub_err_t saved_errno;
+
+  if (!ctx->mo)
+    return NULL;
+
+  position = grub_gettext_find (ctx, orig);
+  if (position < 0)
+    return NULL;
 
-  grub_error_pop ();
-  depth--;
-  return NULL;
+  /* Messages are often translated while an error is pending.  Failing to
+     copy the translation must not replace that error.  */
+  saved_errno = grub_errno;
+  ret = grub_gettext_gettranslation_from_position (ctx, position);
+  if (!ret)
+    grub_errno = saved_errno;
+  return ret;
 }
 
 static const char *
@@ -263,20 +233,83 @@ grub_gettext_translate (const char *orig)
 static void
 grub_gettext_delete_list (struct grub_gettext_context *ctx)
 {
-  struct grub_gettext_msg *l = ctx->grub_gettext_msg_list;
+  /* Don't delete the translated messages because they could be in use.  */
+  grub_free (ctx->translated);
+  grub_free (ctx->mo);
+  grub_memset (ctx, 0, sizeof (*ctx));
+}
+
+/* Read all of FD into memory.  Compressed catalogs may not know their
+   size up front.  */
+static char *
+grub_mofile_read (grub_file_t fd, grub_size_t *size)
+{
+  grub_size_t alloc = 65536, len = 0;
+  grub_off_t file_size;
+  grub_ssize_t r;
+  char *buf = NULL, *n;
+
+  file_size = grub_file_size (fd);
+  if (file_size != GRUB_FILE_SIZE_UNKNOWN && file_size != 0)
+    {
+      if (file_size >= GRUB_SIZE_MAX / 2)
+	{
+	  grub_error (GRUB_ERR_OUT_OF_MEMORY, N_("out of memory"));
+	  return NULL;
+	}
+      /* One spare byte so that a single read finds the end.  */
+      alloc = file_size + 1;
+    }
+
+  while (1)
+    {
+      n = grub_realloc (buf, alloc);
+      if (!n)
+	{
+	  grub_free (buf);
+	  return NULL;
+	}
+      buf = n;
+      r = grub_file_read (fd, buf + len, alloc - len);
+      if (r < 0)
+	{
+	  grub_free (buf);
+	  return NULL;
+	}
+      len += r;
+      if (len < alloc)
+	break;
+      alloc *= 2;
+    }
+
+  *size = len;
+  return buf;
+}
+
+/* Check that every string descriptor in the table at OFF points inside the
+   catalog to a NUL-terminated string.  */
+static int
+grub_mofile_check_table (struct grub_gettext_context *ctx, grub_uint32_t off)
+{
   grub_size_t i;
+  grub_uint32_t length, offset;
+
+  if (off > ctx->mo_size
+      || ctx->grub_gettext_max > (ctx->mo_size - off)
+	 / sizeof (struct string_descriptor))
+    return 0;
 
-  if (!l)
-    return;
-  ctx->grub_gettext_msg_list = 0;
   for (i = 0; i < ctx->grub_gettext_max; i++)
-    grub_free (l[i].name);
-  /* Don't delete the translated message because could be in use.  */
-  grub_free (l);
-  if (ctx->fd_mo)
-    grub_file_close (ctx->fd_mo);
-  ctx->fd_mo = 0;
-  grub_memset (ctx, 0, sizeof (*ctx));
+    {
+      length = grub_gettext_read32 (ctx, off + i
+				    * sizeof (struct string_descriptor));
+      offset = grub_gettext_read32 (ctx, off + i
+				    * sizeof (struct string_descriptor) + 4);
+      if (offset >= ctx->mo_size || length >= ctx->mo_size - offset
+	  || ctx->mo[offset + length] != '\0')
+	return 0;
+    }
+  return 1;
 }
 
 /* This is similar to grub_file_open. */
@@ -285,52 +318,72 @@ grub_mofile_open (struct grub_gettext_context *ctx,
 		  const char *filename)
 {
   struct header head;
-  grub_err_t err;
   grub_file_t fd;
-
-  /* Using fd_mo and not another variable because
-     it's needed for grub_gettext_get_info.  */
+  char *mo;
+  grub_size_t size;
 
   fd = grub_file_open (filename, GRUB_FILE_TYPE_GETTEXT_CATALOG);
 
   if (!fd)
     return grub_errno;
 
-  err = grub_gettext_pread (fd, &head, sizeof (head), 0);
-  if (err)
+  mo = grub_mofile_read (fd, &size);
+  grub_file_close (fd);
+  if (!mo)
+    return grub_errno;
+
+  if (size < sizeof (head))
     {
-      grub_file_close (fd);
-      return err;
+      grub_free (mo);
+      return grub_error (GRUB_ERR_BAD_FILE_TYPE,
+			 "mo: premature end of file: %s", filename);
     }
+  grub_memcpy (&head, mo, sizeof (head));
 
   if (head.magic != grub_cpu_to_le32_compile_time (MO_MAGIC_NUMBER))
     {
-      grub_file_close (fd);
+      grub_free (mo);
       return grub_error (GRUB_ERR_BAD_FILE_TYPE,
 			 "mo: invalid mo magic in file: %s", filename);
     }
 
   if (head.version != 0)
     {
-      grub_file_close (fd);
+      grub_free (mo);
       return grub_error (GRUB_ERR_BAD_FILE_TYPE,
 			 "mo: invalid mo version in file: %s", filename);
     }
 
+  ctx->mo = mo;
+  ctx->mo_size = size;
   ctx->grub_gettext_offset_original = grub_le_to_cpu32 (head.offset_original);
   ctx->grub_gettext_offset_translation = grub_le_to_cpu32 (head.offset_translation);
   ctx->grub_gettext_max = grub_le_to_cpu32 (head.number_of_strings);
-  for (ctx->grub_gettext_max_log = 0; ctx->grub_gettext_max >> ctx->grub_gettext_max_log;
-       ctx->grub_gettext_max_log++);
+  ctx->hash_size = grub_le_to_cpu32 (head.hash_size);
+  ctx->offset_hash = grub_le_to_cpu32 (head.offset_hash);
+
+  if (!grub_mofile_check_table (ctx, ctx->grub_gettext_offset_original)
+      || !grub_mofile_check_table (ctx, ctx->grub_gettext_offset_translation))
+    {
+      grub_memset (ctx, 0, sizeof (*ctx));
+      grub_free (mo);
+      return grub_error (GRUB_ERR_BAD_FILE_TYPE,
+			 "mo: invalid string table in file: %s", filename);
+    }
+
+  /* A hash table that doesn't fit is ignored, bisection still works.  */
+  if (ctx->offset_hash > size
+      || ctx->hash_size > (size - ctx->offset_hash) / 4)
+    ctx->hash_size = 0;
 
-  ctx->grub_gettext_msg_list = grub_zalloc (ctx->grub_gettext_max
-					    * sizeof (ctx->grub_gettext_msg_list[0]));
-  if (!ctx->grub_gettext_msg_list)
+  ctx->translated = grub_zalloc (ctx->grub_gettext_max
+				 * sizeof (ctx->translated[0]));
+  if (!ctx->translated)
     {
-      grub_file_close (fd);
+      grub_memset (ctx, 0, sizeof (*ctx));
+      grub_free (mo);
       return grub_errno;
     }
-  ctx->fd_mo = fd;
   if (grub_gettext != grub_gettext_translate)
     {
       grub_gettext_original = grub_gettext;
@@ -339,8 +392,8 @@ grub_mofile_open (struct grub_gettext_context *ctx,
   return 0;
 }
 
-/* Returning grub_file_t would be more natural, but grub_mofile_open assigns
-   to fd_mo anyway ...  */
+/* Returning the catalog would be more natural, but grub_mofile_open fills
+   CTX anyway ...  */
 static grub_err_t
 grub_mofile_open_lang (struct grub_gettext_context *ctx,
 		       const char *part1, const char *part2, const char *locale)
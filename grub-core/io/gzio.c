@@ -1306,7 +1306,10 @@ static grub_ssize_t
 grub_gzio_read (grub_file_t file, char *buf, grub_size_t len)
 {
   grub_ssize_t ret;
+
+  grub_boot_time_begin ("gunzip %s", file->name);
   ret = grub_gzio_read_real (file->data, file->offset, buf, len);
+  grub_boot_time_end ();
 
   if (!grub_errno && ret != (grub_ssize_t) len)
     {
@@ -451,7 +451,7 @@ grub_lzopio_open (grub_file_t io, enum grub_file_type type)
 }
 
 static grub_ssize_t
-grub_lzopio_read (grub_file_t file, char *buf, grub_size_t len)
+grub_lzopio_read_real (grub_file_t file, char *buf, grub_size_t len)
 {
   grub_lzopio_t lzopio = file->data;
   grub_ssize_t ret = 0;
@@ -512,6 +512,17 @@ CORRUPTED:
   return -1;
 }
 
+static grub_ssize_t
+grub_lzopio_read (grub_file_t file, char *buf, grub_size_t len)
+{
+  grub_ssize_t ret;
+
+  grub_boot_time_begin ("unlzop %s", file->name);
+  ret = grub_lzopio_read_real (file, buf, len);
+  grub_boot_time_end ();
+  return ret;
+}
+
 /* Release everything, including the underlying file object.  */
 static grub_err_t
 grub_lzopio_close (grub_file_t file)
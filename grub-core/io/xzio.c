@@ -229,7 +229,7 @@ grub_xzio_open (grub_file_t io, enum grub_file_type type)
 }
 
 static grub_ssize_t
-grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
+grub_xzio_read_real (grub_file_t file, char *buf, grub_size_t len)
 {
   grub_ssize_t ret = 0;
   grub_ssize_t readret;
@@ -308,6 +308,17 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
   return ret;
 }
 
+static grub_ssize_t
+grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
+{
+  grub_ssize_t ret;
+
+  grub_boot_time_begin ("unxz %s", file->name);
+  ret = grub_xzio_read_real (file, buf, len);
+  grub_boot_time_end ();
+  return ret;
+}
+
 /* Release everything, including the underlying file object.  */
 static grub_err_t
 grub_xzio_close (grub_file_t file)
@@ -36,9 +36,11 @@ struct grub_disk_cache grub_disk_cache_table[GRUB_DISK_CACHE_NUM];
 void (*grub_disk_firmware_fini) (void);
 int grub_disk_firmware_is_tainted;
 
-#if DISK_CACHE_STATS
+#if GRUB_DISK_STATS
 static unsigned long grub_disk_cache_hits;
 static unsigned long grub_disk_cache_misses;
+static unsigned long grub_disk_device_reads;
+static grub_uint64_t grub_disk_device_bytes;
 
 void
 grub_disk_cache_get_performance (unsigned long *hits, unsigned long *misses)
@@ -46,6 +48,13 @@ grub_disk_cache_get_performance (unsigned long *hits, unsigned long *misses)
   *hits = grub_disk_cache_hits;
   *misses = grub_disk_cache_misses;
 }
+
+void
+grub_disk_get_device_stats (unsigned long *reads, grub_uint64_t *bytes)
+{
+  *reads = grub_disk_device_reads;
+  *bytes = grub_disk_device_bytes;
+}
 #endif
 
 grub_err_t (*grub_disk_write_weak) (grub_disk_t disk,
@@ -86,13 +95,13 @@ grub_disk_cache_fetch (unsigned long dev_id, unsigned long disk_id,
       && cache->sector == sector)
     {
       cache->lock = 1;
-#if DISK_CACHE_STATS
+#if GRUB_DISK_STATS
       grub_disk_cache_hits++;
 #endif
       return cache->data;
     }
 
-#if DISK_CACHE_STATS
+#if GRUB_DISK_STATS
   grub_disk_cache_misses++;
 #endif
 
@@ -310,6 +319,27 @@ grub_disk_close (grub_disk_t disk)
   grub_free (disk);
 }
 
+/* Read N sectors at SECTOR from the device itself, bypassing the cache.
+   Every such read is traced as a boot time span and, with GRUB_DISK_STATS,
+   counted.  */
+static grub_err_t
+grub_disk_read_device (grub_disk_t disk, grub_disk_addr_t sector,
+		       grub_size_t n, char *buf)
+{
+  grub_err_t err;
+
+  grub_boot_time_begin_disk ("Disk read %s %llu+%llu", disk->name,
+			     (unsigned long long) sector, (unsigned long long) n);
+  err = (disk->dev->disk_read) (disk, transform_sector (disk, sector),
+				n, buf);
+  grub_boot_time_end ();
+#if GRUB_DISK_STATS
+  grub_disk_device_reads++;
+  grub_disk_device_bytes += (grub_uint64_t) n << disk->log_sector_size;
+#endif
+  return err;
+}
+
 /* Small read (less than cache size and not pass across cache unit boundaries).
    sector is already adjusted and is divisible by cache unit size.
  */
@@ -341,10 +371,10 @@ grub_disk_read_small_real (grub_disk_t disk, grub_disk_addr_t sector,
       < (disk->total_sectors << (disk->log_sector_size - GRUB_DISK_SECTOR_BITS)))
     {
       grub_err_t err;
-      err = (disk->dev->disk_read) (disk, transform_sector (disk, sector),
-				    1U << (GRUB_DISK_CACHE_BITS
-					   + GRUB_DISK_SECTOR_BITS
-					   - disk->log_sector_size), tmp_buf);
+      err = grub_disk_read_device (disk, sector,
+				   1U << (GRUB_DISK_CACHE_BITS
+					  + GRUB_DISK_SECTOR_BITS
+					  - disk->log_sector_size), tmp_buf);
       if (!err)
 	{
 	  /* Copy it and store it in the disk cache.  */
@@ -377,8 +407,7 @@ grub_disk_read_small_real (grub_disk_t disk, grub_disk_addr_t sector,
     if (!tmp_buf)
       return grub_errno;
     
-    if ((disk->dev->disk_read) (disk, transform_sector (disk, aligned_sector),
-				num, tmp_buf))
+    if (grub_disk_read_device (disk, aligned_sector, num, tmp_buf))
       {
 	grub_error_push ();
 	grub_dprintf ("disk", "%s read failed\n", disk->name);
@@ -392,6 +421,27 @@ grub_disk_read_small_real (grub_disk_t disk, grub_disk_addr_t sector,
   }
 }
 
+/* Read from a disk that is mapped into memory.  The cache would only
+   add a copy.  */
+static grub_err_t
+grub_disk_read_mapped (grub_disk_t disk, grub_disk_addr_t sector,
+		       grub_off_t offset, grub_size_t size, void *buf)
+{
+  grub_uint64_t pos = (sector << GRUB_DISK_SECTOR_BITS) + offset;
+  grub_size_t avail = 0;
+
+  if (pos < disk->mapped_size)
+    avail = (disk->mapped_size - pos < size) ? disk->mapped_size - pos : size;
+  grub_memcpy (buf, disk->mapped + pos, avail);
+  grub_memset ((char *) buf + avail, 0, size - avail);
+
+  if (disk->read_hook)
+    (disk->read_hook) (sector + (offset >> GRUB_DISK_SECTOR_BITS),
+		       offset & (GRUB_DISK_SECTOR_SIZE - 1),
+		       size, disk->read_hook_data);
+  return GRUB_ERR_NONE;
+}
+
 static grub_err_t
 grub_disk_read_small (grub_disk_t disk, grub_disk_addr_t sector,
 		      grub_off_t offset, grub_size_t size, void *buf)
@@ -423,6 +473,9 @@ grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
       return grub_errno;
     }
 
+  if (disk->mapped)
+    return grub_disk_read_mapped (disk, sector, offset, size, buf);
+
   /* First read until first cache boundary.   */
   if (offset || (sector & (GRUB_DISK_CACHE_SIZE - 1)))
     {
@@ -483,15 +536,15 @@ grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
 	{
 	  grub_disk_addr_t i;
 
-	  err = (disk->dev->disk_read) (disk, transform_sector (disk, sector),
-					agglomerate << (GRUB_DISK_CACHE_BITS
-							+ GRUB_DISK_SECTOR_BITS
-							- disk->log_sector_size),
-					buf);
+	  err = grub_disk_read_device (disk, sector,
+				       agglomerate << (GRUB_DISK_CACHE_BITS
+						       + GRUB_DISK_SECTOR_BITS
+						       - disk->log_sector_size),
+				       buf);
 	  if (err)
 	    return err;
 	  
-	  for (i = 0; i < agglomerate; i ++)
+	  for (i = 0; i < agglomerate && !disk->cache_bypass; i ++)
 	    grub_disk_cache_store (disk->dev->id, disk->id,
 				   sector + (i << GRUB_DISK_CACHE_BITS),
 				   (char *) buf
@@ -32,6 +32,7 @@
 #include <grub/env.h>
 #include <grub/cache.h>
 #include <grub/i18n.h>
+#include <grub/dl_pack.h>
 
 /* Platforms where modules are in a readonly area of memory.  */
 #if defined(GRUB_MACHINE_QEMU)
@@ -721,17 +722,234 @@ grub_dl_load_file (const char *filename)
   return mod;
 }
 
-/* Load a module using a symbolic name.  */
-grub_dl_t
-grub_dl_load (const char *name)
+/* The directory whose module pack index is loaded, the pack kept open,
+   and its index, or NULL if the directory has no usable pack.  The file
+   stays open so that it is opened, and verified, only once.  */
+static char *grub_dl_pack_dir;
+static grub_file_t grub_dl_pack_file;
+static char *grub_dl_pack_index;
+static grub_uint32_t grub_dl_pack_nmodules;
+
+static const struct grub_dl_pack_entry *
+grub_dl_pack_entry (grub_uint32_t i)
 {
-  char *filename;
+  return (const struct grub_dl_pack_entry *) grub_dl_pack_index + i;
+}
+
+static const char *
+grub_dl_pack_name (grub_uint32_t i)
+{
+  return grub_dl_pack_index + grub_le_to_cpu32 (grub_dl_pack_entry (i)->name);
+}
+
+static const grub_uint32_t *
+grub_dl_pack_deps (grub_uint32_t i)
+{
+  return (const grub_uint32_t *) (grub_dl_pack_index
+				  + grub_le_to_cpu32 (grub_dl_pack_entry (i)->deps));
+}
+
+/* Read the index of the module pack FILE and check it.  */
+static grub_err_t
+grub_dl_pack_read_index (grub_file_t file)
+{
+  struct grub_dl_pack_header head;
+  const struct grub_dl_pack_entry *ent;
+  const grub_uint32_t *deps;
+  grub_uint32_t n, size, i, j;
+  grub_off_t file_size = grub_file_size (file);
+  char *index;
+
+  if (grub_file_read (file, &head, sizeof (head)) != sizeof (head)
+      || grub_memcmp (head.magic, GRUB_DL_PACK_MAGIC, sizeof (head.magic)) != 0)
+    return grub_error (GRUB_ERR_BAD_MODULE, "invalid module pack");
+
+  n = grub_le_to_cpu32 (head.nmodules);
+  size = grub_le_to_cpu32 (head.index_size);
+  if (size == 0 || n > size / sizeof (*ent))
+    return grub_error (GRUB_ERR_BAD_MODULE, "invalid module pack");
+
+  index = grub_malloc (size);
+  if (!index)
+    return grub_errno;
+  if (grub_file_read (file, index, size) != (grub_ssize_t) size
+      || index[size - 1] != '\0')
+    goto fail;
+
+  for (i = 0; i < n; i++)
+    {
+      grub_uint32_t off, len, ndeps, deps_off;
+
+      ent = (const struct grub_dl_pack_entry *) index + i;
+      off = grub_le_to_cpu32 (ent->offset);
+      len = grub_le_to_cpu32 (ent->size);
+      ndeps = grub_le_to_cpu32 (ent->ndeps);
+      deps_off = grub_le_to_cpu32 (ent->deps);
+      if (grub_le_to_cpu32 (ent->name) >= size
+	  || off % GRUB_DL_PACK_ALIGN != 0
+	  || (file_size != GRUB_FILE_SIZE_UNKNOWN
+	      && (off > file_size || len > file_size - off))
+	  || deps_off % sizeof (*deps) != 0 || deps_off > size
+	  || ndeps > (size - deps_off) / sizeof (*deps))
+	goto fail;
+
+      /* Dependencies must come first.  */
+      deps = (const grub_uint32_t *) (index + deps_off);
+      for (j = 0; j < ndeps; j++)
+	if (grub_le_to_cpu32 (deps[j]) >= i)
+	  goto fail;
+    }
+
+  grub_dl_pack_index = index;
+  grub_dl_pack_nmodules = n;
+  return GRUB_ERR_NONE;
+
+ fail:
+  grub_free (index);
+  if (!grub_errno)
+    grub_error (GRUB_ERR_BAD_MODULE, "invalid module pack");
+  return grub_errno;
+}
+
+/* Mark module I and those of its dependencies which aren't loaded yet.  */
+static void
+grub_dl_pack_mark (grub_uint32_t i, char *needed)
+{
+  const grub_uint32_t *deps;
+  grub_uint32_t j, ndeps;
+
+  if (needed[i] || grub_dl_get (grub_dl_pack_name (i)))
+    return;
+  needed[i] = 1;
+
+  deps = grub_dl_pack_deps (i);
+  ndeps = grub_le_to_cpu32 (grub_dl_pack_entry (i)->ndeps);
+  for (j = 0; j < ndeps; j++)
+    grub_dl_pack_mark (grub_le_to_cpu32 (deps[j]), needed);
+}
+
+/* Forget the pack of the previous directory.  */
+static void
+grub_dl_pack_close (void)
+{
+  if (grub_dl_pack_file)
+    grub_file_close (grub_dl_pack_file);
+  grub_dl_pack_file = NULL;
+  grub_free (grub_dl_pack_index);
+  grub_dl_pack_index = NULL;
+  grub_dl_pack_nmodules = 0;
+  grub_free (grub_dl_pack_dir);
+  grub_dl_pack_dir = NULL;
+}
+
+/* Read module I from the pack and link it.  */
+static grub_dl_t
+grub_dl_pack_load_one (grub_uint32_t i)
+{
+  const struct grub_dl_pack_entry *ent = grub_dl_pack_entry (i);
+  grub_uint32_t size = grub_le_to_cpu32 (ent->size);
   grub_dl_t mod;
-  const char *grub_dl_dir = grub_env_get ("prefix");
+  char *buf;
 
-  mod = grub_dl_get (name);
+  buf = grub_malloc (size);
+  if (!buf)
+    return NULL;
+  grub_file_seek (grub_dl_pack_file, grub_le_to_cpu32 (ent->offset));
+  if (grub_errno)
+    {
+      grub_free (buf);
+      return NULL;
+    }
+  if (grub_file_read (grub_dl_pack_file, buf, size) != (grub_ssize_t) size)
+    {
+      if (!grub_errno)
+	grub_error (GRUB_ERR_BAD_MODULE, "premature end of module pack");
+      grub_free (buf);
+      return NULL;
+    }
+
+  mod = grub_dl_load_core (buf, size);
+  grub_free (buf);
   if (mod)
-    return mod;
+    mod->ref_count--;
+  return mod;
+}
+
+/* Load the module NAME and the dependencies it needs from the module pack
+   in DIR.  *MOD is set to NULL without an error if there is no pack or
+   NAME isn't in it.  */
+static grub_err_t
+grub_dl_load_pack (const char *dir, const char *name, grub_dl_t *mod)
+{
+  char *filename, *needed;
+  grub_uint32_t i, target;
+
+  *mod = NULL;
+
+  if (!grub_dl_pack_dir || grub_strcmp (grub_dl_pack_dir, dir) != 0)
+    {
+      grub_dl_pack_close ();
+      grub_dl_pack_dir = grub_strdup (dir);
+      if (!grub_dl_pack_dir)
+	return grub_errno;
+
+      filename = grub_xasprintf ("%s/" GRUB_TARGET_CPU "-" GRUB_PLATFORM "/"
+				 GRUB_DL_PACK_NAME, dir);
+      if (!filename)
+	return grub_errno;
+      grub_dl_pack_file = grub_file_open (filename, GRUB_FILE_TYPE_GRUB_MODULE);
+      grub_free (filename);
+      if (!grub_dl_pack_file)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  return GRUB_ERR_NONE;
+	}
+      if (grub_dl_pack_read_index (grub_dl_pack_file))
+	{
+	  grub_dprintf ("modules", "ignoring module pack: %s\n", grub_errmsg);
+	  grub_errno = GRUB_ERR_NONE;
+	  grub_file_close (grub_dl_pack_file);
+	  grub_dl_pack_file = NULL;
+	  return GRUB_ERR_NONE;
+	}
+    }
+
+  if (!grub_dl_pack_file)
+    return GRUB_ERR_NONE;
+
+  for (target = 0; target < grub_dl_pack_nmodules; target++)
+    if (grub_strcmp (grub_dl_pack_name (target), name) == 0)
+      break;
+  if (target == grub_dl_pack_nmodules)
+    return GRUB_ERR_NONE;
+
+  grub_boot_time ("Loading module %s from pack", name);
+
+  needed = grub_zalloc (grub_dl_pack_nmodules);
+  if (!needed)
+    return grub_errno;
+  grub_dl_pack_mark (target, needed);
+
+  /* Dependencies come first, so each module finds them already loaded.
+     Only the modules needed are read, each from its own range.  */
+  for (i = 0; i <= target; i++)
+    if (needed[i])
+      {
+	*mod = grub_dl_pack_load_one (i);
+	if (!*mod)
+	  break;
+      }
+
+  grub_free (needed);
+  return grub_errno;
+}
+
+static grub_dl_t
+grub_dl_load_real (const char *name)
+{
+  char *filename;
+  grub_dl_t mod;
+  const char *grub_dl_dir = grub_env_get ("prefix");
 
   if (grub_no_modules)
     return 0;
@@ -741,6 +959,22 @@ grub_dl_load (const char *name)
     return 0;
   }
 
+  /* The pack is only a faster way to get the same modules.  If anything
+     about it is wrong, try the separate file.  */
+  if (grub_dl_load_pack (grub_dl_dir, name, &mod) != GRUB_ERR_NONE)
+    {
+      grub_dprintf ("modules", "loading %s from the module pack failed: %s\n",
+		    name, grub_errmsg);
+      grub_errno = GRUB_ERR_NONE;
+      mod = NULL;
+    }
+  if (mod)
+    {
+      if (grub_strcmp (mod->name, name) != 0)
+	grub_error (GRUB_ERR_BAD_MODULE, "mismatched names");
+      return mod;
+    }
+
   filename = grub_xasprintf ("%s/" GRUB_TARGET_CPU "-" GRUB_PLATFORM "/%s.mod",
 			     grub_dl_dir, name);
   if (! filename)
@@ -758,6 +992,22 @@ grub_dl_load (const char *name)
   return mod;
 }
 
+/* Load a module using a symbolic name.  */
+grub_dl_t
+grub_dl_load (const char *name)
+{
+  grub_dl_t mod;
+
+  mod = grub_dl_get (name);
+  if (mod)
+    return mod;
+
+  grub_boot_time_begin ("Module %s", name);
+  mod = grub_dl_load_real (name);
+  grub_boot_time_end ();
+  return mod;
+}
+
 /* Unload the module MOD.  */
 int
 grub_dl_unload (grub_dl_t mod)
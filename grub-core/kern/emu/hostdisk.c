@@ -228,7 +228,9 @@ grub_util_fd_open_device (const grub_disk_t disk, grub_disk_addr_t sector, int f
 
   *max = ~0ULL;
 
-  flags |= GRUB_UTIL_FD_O_SYNC;
+  /* Only writes need to reach the disk before we return.  */
+  if ((flags & O_ACCMODE) != O_RDONLY)
+    flags |= GRUB_UTIL_FD_O_SYNC;
 
   if (data->dev && strcmp (data->dev, map[disk->id].device) == 0 &&
       data->access_mode == (flags & O_ACCMODE))
@@ -264,14 +266,7 @@ grub_util_fd_open_device (const grub_disk_t disk, grub_disk_addr_t sector, int f
       return GRUB_UTIL_FD_INVALID;
     }
 
-  if (grub_util_fd_seek (fd, sector << disk->log_sector_size))
-    {
-      grub_util_fd_close (fd);
-      grub_error (GRUB_ERR_BAD_DEVICE, N_("cannot seek `%s': %s"),
-		  map[disk->id].device, grub_util_fd_strerror ());
-
-      return GRUB_UTIL_FD_INVALID;
-    }
+  data->offset = sector << disk->log_sector_size;
 
   return fd;
 }
@@ -282,6 +277,8 @@ static grub_err_t
 grub_util_biosdisk_read (grub_disk_t disk, grub_disk_addr_t sector,
 			 grub_size_t size, char *buf)
 {
+  struct grub_util_hostdisk_data *data = disk->data;
+
   while (size)
     {
       grub_util_fd_t fd;
@@ -302,7 +299,8 @@ grub_util_biosdisk_read (grub_disk_t disk, grub_disk_addr_t sector,
       if (max > size)
 	max = size;
 
-      if (grub_util_fd_read (fd, buf, max << disk->log_sector_size)
+      if (grub_util_fd_pread (fd, buf, max << disk->log_sector_size,
+			      data->offset)
 	  != (ssize_t) (max << disk->log_sector_size))
 	return grub_error (GRUB_ERR_READ_ERROR, N_("cannot read `%s': %s"),
 			   map[disk->id].device, grub_util_fd_strerror ());
@@ -317,6 +315,8 @@ static grub_err_t
 grub_util_biosdisk_write (grub_disk_t disk, grub_disk_addr_t sector,
 			  grub_size_t size, const char *buf)
 {
+  struct grub_util_hostdisk_data *data = disk->data;
+
   while (size)
     {
       grub_util_fd_t fd;
@@ -337,12 +337,17 @@ grub_util_biosdisk_write (grub_disk_t disk, grub_disk_addr_t sector,
       if (max > size)
 	max = size;
 
+      if (grub_util_fd_seek (fd, data->offset))
+	return grub_error (GRUB_ERR_BAD_DEVICE, N_("cannot seek `%s': %s"),
+			   map[disk->id].device, grub_util_fd_strerror ());
+
       if (grub_util_fd_write (fd, buf, max << disk->log_sector_size)
 	  != (ssize_t) (max << disk->log_sector_size))
 	return grub_error (GRUB_ERR_WRITE_ERROR, N_("cannot write to `%s': %s"),
 			   map[disk->id].device, grub_util_fd_strerror ());
       size -= max;
       buf += (max << disk->log_sector_size);
+      sector += max;
     }
   return GRUB_ERR_NONE;
 }
@@ -58,6 +58,8 @@ struct grub_hostfs_data
 {
   char *filename;
   grub_util_fd_t f;
+  /* Read-only mapping of the whole file, or NULL.  */
+  char *map;
 };
 
 static grub_err_t
@@ -128,6 +130,14 @@ grub_hostfs_open (struct grub_file *file, const char *name)
 
   file->size = grub_util_get_fd_size (f, name, NULL);
 
+  /* Disk images are mapped so that reads are plain copies and loopback
+     devices on top can skip the disk cache.  Devices and pipes fail to
+     map and are read as before.  */
+  data->map = NULL;
+  if (grub_util_is_regular (name))
+    data->map = grub_util_fd_map (f, file->size);
+  file->mapped = data->map;
+
   return GRUB_ERR_NONE;
 }
 
@@ -137,14 +147,13 @@ grub_hostfs_read (grub_file_t file, char *buf, grub_size_t len)
   struct grub_hostfs_data *data;
 
   data = file->data;
-  if (grub_util_fd_seek (data->f, file->offset) != 0)
+  if (data->map)
     {
-      grub_error (GRUB_ERR_OUT_OF_RANGE, N_("cannot seek `%s': %s"),
-		  data->filename, grub_util_fd_strerror ());
-      return -1;
+      grub_memcpy (buf, data->map + file->offset, len);
+      return len;
     }
 
-  unsigned int s = grub_util_fd_read (data->f, buf, len);
+  unsigned int s = grub_util_fd_pread (data->f, buf, len, file->offset);
   if (s != len)
     grub_error (GRUB_ERR_FILE_READ_ERROR, N_("cannot read `%s': %s"),
 		data->filename, grub_util_fd_strerror ());
@@ -158,6 +167,8 @@ grub_hostfs_close (grub_file_t file)
   struct grub_hostfs_data *data;
 
   data = file->data;
+  if (data->map)
+    grub_util_fd_unmap (data->map, file->size);
   grub_util_fd_close (data->f);
   grub_free (data->filename);
   grub_free (data);
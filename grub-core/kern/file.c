@@ -66,6 +66,8 @@ grub_file_open (const char *name, enum grub_file_type type)
   const char *file_name;
   grub_file_filter_id_t filter;
 
+  grub_boot_time_begin ("Open %s", name);
+
   device_name = grub_file_get_device_name (name);
   if (grub_errno)
     goto fail;
@@ -110,6 +112,9 @@ grub_file_open (const char *name, enum grub_file_type type)
   if ((file->fs->fs_open) (file, file_name) != GRUB_ERR_NONE)
     goto fail;
 
+  if ((type & GRUB_FILE_TYPE_NO_DISK_CACHE) && device->disk)
+    device->disk->cache_bypass = 1;
+
   file->name = grub_strdup (name);
   grub_errno = GRUB_ERR_NONE;
 
@@ -128,6 +133,7 @@ grub_file_open (const char *name, enum grub_file_type type)
   if (!file)
     grub_file_close (last_file);
 
+  grub_boot_time_end ();
   return file;
 
  fail:
@@ -138,6 +144,7 @@ grub_file_open (const char *name, enum grub_file_type type)
 
   grub_free (file);
 
+  grub_boot_time_end ();
   return 0;
 }
 
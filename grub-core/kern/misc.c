@@ -74,24 +74,125 @@ grub_gettext_dummy (const char *s)
 
 const char* (*grub_gettext) (const char *s) = grub_gettext_dummy;
 
-void *
-grub_memmove (void *dest, const void *src, grub_size_t n)
+/* clang detects that we're implementing here a memset so it decides to
+   optimise and calls memset resulting in infinite recursion. With volatile
+   we make it not optimise in this way.  */
+#ifdef __clang__
+#define VOLATILE_CLANG volatile
+#else
+#define VOLATILE_CLANG
+#endif
+
+/* The memory functions work a word at a time when both pointers have the
+   same alignment, the word type may alias anything.  It is pointer sized,
+   unlike long on LLP64 targets such as x86_64 EFI.  */
+typedef grub_addr_t __attribute__ ((may_alias)) grub_mem_word_t;
+#define MEM_WORD_SIZE	sizeof (grub_mem_word_t)
+#define MEM_WORD_MASK	(MEM_WORD_SIZE - 1)
+/* Below this the alignment prologue costs more than it saves.  */
+#define MEM_WORDWISE_MIN	(3 * MEM_WORD_SIZE)
+
+#if defined (__i386__) || defined (__x86_64__)
+/* The string instructions are the fastest way to move and fill memory on
+   every x86 since the P6, whatever the alignment, but their startup cost
+   only pays off for larger blocks.  */
+#define MEM_STRING_MIN	64
+#if GRUB_CPU_SIZEOF_VOID_P == 8
+#define REP_MOVS_WORD	"rep movsq"
+#define REP_STOS_WORD	"rep stosq"
+#else
+#define REP_MOVS_WORD	"rep movsl"
+#define REP_STOS_WORD	"rep stosl"
+#endif
+#endif
+
+static inline int
+mem_coaligned (const void *a, const void *b)
 {
-  char *d = (char *) dest;
-  const char *s = (const char *) src;
+  return (((grub_addr_t) a ^ (grub_addr_t) b) & MEM_WORD_MASK) == 0;
+}
 
-  if (d < s)
-    while (n--)
-      *d++ = *s++;
-  else
+/* Copy N bytes from S to D going up.  Overlap is fine if D is below S.  */
+static inline void
+copy_forward (grub_uint8_t *d, const grub_uint8_t *s, grub_size_t n)
+{
+#ifdef MEM_STRING_MIN
+  if (n >= MEM_STRING_MIN)
+    {
+      grub_size_t words = n / MEM_WORD_SIZE;
+
+      /* Architecturally these copy one element after another, so the
+	 overlap case is handled too.  */
+      asm volatile (REP_MOVS_WORD
+		    : "+D" (d), "+S" (s), "+c" (words) : : "memory");
+      n &= MEM_WORD_MASK;
+      asm volatile ("rep movsb"
+		    : "+D" (d), "+S" (s), "+c" (n) : : "memory");
+      return;
+    }
+#endif
+
+  if (n >= MEM_WORDWISE_MIN && mem_coaligned (d, s))
     {
-      d += n;
-      s += n;
+      while ((grub_addr_t) d & MEM_WORD_MASK)
+	{
+	  *(VOLATILE_CLANG grub_uint8_t *) d++ = *s++;
+	  n--;
+	}
+      while (n >= MEM_WORD_SIZE)
+	{
+	  *(VOLATILE_CLANG grub_mem_word_t *) d = *(const grub_mem_word_t *) s;
+	  d += MEM_WORD_SIZE;
+	  s += MEM_WORD_SIZE;
+	  n -= MEM_WORD_SIZE;
+	}
+    }
+
+  while (n--)
+    *(VOLATILE_CLANG grub_uint8_t *) d++ = *s++;
+}
 
-      while (n--)
-	*--d = *--s;
+/* Copy the N bytes ending at S to the N bytes ending at D going down.
+   Overlap is fine if D is above S.  Backwards string instructions are
+   slow on current x86, so this is plain C everywhere.  */
+static inline void
+copy_backward (grub_uint8_t *d, const grub_uint8_t *s, grub_size_t n)
+{
+  if (n >= MEM_WORDWISE_MIN && mem_coaligned (d, s))
+    {
+      while ((grub_addr_t) d & MEM_WORD_MASK)
+	{
+	  *(VOLATILE_CLANG grub_uint8_t *) --d = *--s;
+	  n--;
+	}
+      while (n >= MEM_WORD_SIZE)
+	{
+	  d -= MEM_WORD_SIZE;
+	  s -= MEM_WORD_SIZE;
+	  n -= MEM_WORD_SIZE;
+	  *(VOLATILE_CLANG grub_mem_word_t *) d = *(const grub_mem_word_t *) s;
+	}
     }
 
+  while (n--)
+    *(VOLATILE_CLANG grub_uint8_t *) --d = *--s;
+}
+
+void *
+grub_memmove (void *dest, const void *src, grub_size_t n)
+{
+  grub_uint8_t *d = dest;
+  const grub_uint8_t *s = src;
+
+  if (d == s)
+    return dest;
+
+  /* Going up is only wrong if DEST starts inside SRC.  */
+  if ((grub_addr_t) d - (grub_addr_t) s >= n)
+    copy_forward (d, s, n);
+  else
+    copy_backward (d + n, s + n, n);
+
   return dest;
 }
 
@@ -223,6 +324,27 @@ grub_memcmp (const void *s1, const void *s2, grub_size_t n)
   const grub_uint8_t *t1 = s1;
   const grub_uint8_t *t2 = s2;
 
+  /* Skip the equal words, the bytes of the first different word are
+     compared below to get the sign right on either endianness.  */
+  if (n >= MEM_WORDWISE_MIN && mem_coaligned (t1, t2))
+    {
+      while ((grub_addr_t) t1 & MEM_WORD_MASK)
+	{
+	  if (*t1 != *t2)
+	    return (int) *t1 - (int) *t2;
+	  t1++;
+	  t2++;
+	  n--;
+	}
+      while (n >= MEM_WORD_SIZE
+	     && *(const grub_mem_word_t *) t1 == *(const grub_mem_word_t *) t2)
+	{
+	  t1 += MEM_WORD_SIZE;
+	  t2 += MEM_WORD_SIZE;
+	  n -= MEM_WORD_SIZE;
+	}
+    }
+
   while (n--)
     {
       if (*t1 != *t2)
@@ -458,40 +580,45 @@ grub_strndup (const char *s, grub_size_t n)
   return p;
 }
 
-/* clang detects that we're implementing here a memset so it decides to
-   optimise and calls memset resulting in infinite recursion. With volatile
-   we make it not optimise in this way.  */
-#ifdef __clang__
-#define VOLATILE_CLANG volatile
-#else
-#define VOLATILE_CLANG
-#endif
-
 void *
 grub_memset (void *s, int c, grub_size_t len)
 {
   void *p = s;
   grub_uint8_t pattern8 = c;
 
-  if (len >= 3 * sizeof (unsigned long))
+  if (len >= MEM_WORDWISE_MIN)
     {
-      unsigned long patternl = 0;
+      grub_mem_word_t patternl = 0;
       grub_size_t i;
 
-      for (i = 0; i < sizeof (unsigned long); i++)
-	patternl |= ((unsigned long) pattern8) << (8 * i);
+      for (i = 0; i < MEM_WORD_SIZE; i++)
+	patternl |= ((grub_mem_word_t) pattern8) << (8 * i);
+
+#ifdef MEM_STRING_MIN
+      if (len >= MEM_STRING_MIN)
+	{
+	  grub_size_t words = len / MEM_WORD_SIZE;
+
+	  asm volatile (REP_STOS_WORD
+			: "+D" (p), "+c" (words) : "a" (patternl) : "memory");
+	  len &= MEM_WORD_MASK;
+	  asm volatile ("rep stosb"
+			: "+D" (p), "+c" (len) : "a" (patternl) : "memory");
+	  return s;
+	}
+#endif
 
-      while (len > 0 && (((grub_addr_t) p) & (sizeof (unsigned long) - 1)))
+      while (len > 0 && (((grub_addr_t) p) & MEM_WORD_MASK))
 	{
 	  *(VOLATILE_CLANG grub_uint8_t *) p = pattern8;
 	  p = (grub_uint8_t *) p + 1;
 	  len--;
 	}
-      while (len >= sizeof (unsigned long))
+      while (len >= MEM_WORD_SIZE)
 	{
-	  *(VOLATILE_CLANG unsigned long *) p = patternl;
-	  p = (unsigned long *) p + 1;
-	  len -= sizeof (unsigned long);
+	  *(VOLATILE_CLANG grub_mem_word_t *) p = patternl;
+	  p = (grub_mem_word_t *) p + 1;
+	  len -= MEM_WORD_SIZE;
 	}
     }
 
@@ -1119,13 +1246,25 @@ grub_fatal (const char *fmt, ...)
 struct grub_boot_time *grub_boot_time_head;
 static struct grub_boot_time **boot_time_last = &grub_boot_time_head;
 
-void
-grub_real_boot_time (const char *file,
-		     const int line,
-		     const char *fmt, ...)
+/* Spans nested deeper than this are counted but not recorded, and at most
+   BOOT_TIME_MAX_SPANS are kept so that tracing can't eat all memory.
+   Device reads are far more numerous than anything else and have their
+   own, separate limit, so they can't crowd out the kernel and initrd
+   spans recorded after them.  */
+#define BOOT_TIME_MAX_DEPTH 32
+#define BOOT_TIME_MAX_SPANS 16384
+#define BOOT_TIME_MAX_DISK_SPANS 8192
+
+static struct grub_boot_time *boot_time_open[BOOT_TIME_MAX_DEPTH];
+static int boot_time_depth;
+static unsigned boot_time_nspans;
+static unsigned boot_time_ndisk_spans;
+
+static struct grub_boot_time *
+boot_time_add (const char *file, const int line, const char *fmt,
+	       va_list args)
 {
   struct grub_boot_time *n;
-  va_list args;
 
   grub_error_push ();
   n = grub_malloc (sizeof (*n));
@@ -1133,21 +1272,99 @@ grub_real_boot_time (const char *file,
     {
       grub_errno = 0;
       grub_error_pop ();
-      return;
+      return NULL;
     }
   n->file = file;
   n->line = line;
   n->tp = grub_get_time_ms ();
+  n->end = 0;
+  n->depth = boot_time_depth;
+  n->is_span = 0;
   n->next = 0;
 
-  va_start (args, fmt);
-  n->msg = grub_xvasprintf (fmt, args);    
-  va_end (args);
+  n->msg = grub_xvasprintf (fmt, args);
 
   *boot_time_last = n;
   boot_time_last = &n->next;
 
   grub_errno = 0;
   grub_error_pop ();
+  return n;
+}
+
+void
+grub_real_boot_time (const char *file,
+		     const int line,
+		     const char *fmt, ...)
+{
+  va_list args;
+
+  va_start (args, fmt);
+  boot_time_add (file, line, fmt, args);
+  va_end (args);
+}
+
+static void
+boot_time_begin (const char *file, const int line, unsigned *nspans,
+		 unsigned max_spans, const char *fmt, va_list args)
+{
+  struct grub_boot_time *n = NULL;
+
+  if (boot_time_depth < BOOT_TIME_MAX_DEPTH && *nspans < max_spans)
+    n = boot_time_add (file, line, fmt, args);
+  if (n)
+    {
+      n->is_span = 1;
+      (*nspans)++;
+    }
+  if (boot_time_depth < BOOT_TIME_MAX_DEPTH)
+    boot_time_open[boot_time_depth] = n;
+  boot_time_depth++;
+}
+
+void
+grub_real_boot_time_begin (const char *file,
+			   const int line,
+			   const char *fmt, ...)
+{
+  va_list args;
+
+  va_start (args, fmt);
+  boot_time_begin (file, line, &boot_time_nspans, BOOT_TIME_MAX_SPANS,
+		   fmt, args);
+  va_end (args);
+}
+
+void
+grub_real_boot_time_begin_disk (const char *file,
+				const int line,
+				const char *fmt, ...)
+{
+  va_list args;
+
+  va_start (args, fmt);
+  boot_time_begin (file, line, &boot_time_ndisk_spans,
+		   BOOT_TIME_MAX_DISK_SPANS, fmt, args);
+  va_end (args);
+}
+
+void
+grub_real_boot_time_end (void)
+{
+  struct grub_boot_time *n;
+
+  if (boot_time_depth == 0)
+    return;
+  boot_time_depth--;
+  if (boot_time_depth >= BOOT_TIME_MAX_DEPTH)
+    return;
+  n = boot_time_open[boot_time_depth];
+  if (n)
+    {
+      n->end = grub_get_time_ms ();
+      /* A zero end marks a span that is still open.  */
+      if (n->end == 0)
+	n->end = 1;
+    }
 }
 #endif
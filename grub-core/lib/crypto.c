@@ -212,6 +212,13 @@ grub_crypto_ecb_decrypt (grub_crypto_cipher_handle_t cipher,
   if (blocksize == 0 || (((blocksize - 1) & blocksize) != 0)
       || ((size & (blocksize - 1)) != 0))
     return GPG_ERR_INV_ARG;
+  if (cipher->cipher->decrypt_blocks)
+    {
+      if (size)
+	cipher->cipher->decrypt_blocks (cipher->ctx, out, in,
+					size / blocksize);
+      return GPG_ERR_NO_ERROR;
+    }
   end = (const grub_uint8_t *) in + size;
   for (inptr = in, outptr = out; inptr < end;
        inptr += blocksize, outptr += blocksize)
@@ -232,6 +239,13 @@ grub_crypto_ecb_encrypt (grub_crypto_cipher_handle_t cipher,
   if (blocksize == 0 || (((blocksize - 1) & blocksize) != 0)
       || ((size & (blocksize - 1)) != 0))
     return GPG_ERR_INV_ARG;
+  if (cipher->cipher->encrypt_blocks)
+    {
+      if (size)
+	cipher->cipher->encrypt_blocks (cipher->ctx, out, in,
+					size / blocksize);
+      return GPG_ERR_NO_ERROR;
+    }
   end = (const grub_uint8_t *) in + size;
   for (inptr = in, outptr = out; inptr < end;
        inptr += blocksize, outptr += blocksize)
@@ -285,6 +299,32 @@ grub_crypto_cbc_decrypt (grub_crypto_cipher_handle_t cipher,
   if (blocksize > GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE)
     return GPG_ERR_INV_ARG;
   end = (const grub_uint8_t *) in + size;
+  if (cipher->cipher->decrypt_blocks)
+    {
+      /* Unlike encryption, CBC decryption of different blocks is
+	 independent: decrypt a batch at once and apply the chaining
+	 afterwards.  The ciphertext is copied first so that IN and OUT
+	 may overlap.  */
+      grub_uint8_t ct[GRUB_CRYPTO_BULK_BLOCKS
+		      * GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE];
+      grub_size_t n, j;
+
+      for (inptr = in, outptr = out; inptr < end;
+	   inptr += n * blocksize, outptr += n * blocksize)
+	{
+	  n = (end - inptr) / blocksize;
+	  if (n > GRUB_CRYPTO_BULK_BLOCKS)
+	    n = GRUB_CRYPTO_BULK_BLOCKS;
+	  grub_memcpy (ct, inptr, n * blocksize);
+	  cipher->cipher->decrypt_blocks (cipher->ctx, outptr, ct, n);
+	  grub_crypto_xor (outptr, outptr, iv, blocksize);
+	  for (j = 1; j < n; j++)
+	    grub_crypto_xor (outptr + j * blocksize, outptr + j * blocksize,
+			     ct + (j - 1) * blocksize, blocksize);
+	  grub_memcpy (iv, ct + (n - 1) * blocksize, blocksize);
+	}
+      return GPG_ERR_NO_ERROR;
+    }
   for (inptr = in, outptr = out; inptr < end;
        inptr += blocksize, outptr += blocksize)
     {
@@ -132,6 +132,40 @@ camellia_decrypt(void *c, byte *outbuf, const byte *inbuf)
     );
 }
 
+static void
+camellia_encrypt_blocks(void *c, byte *outbuf, const byte *inbuf,
+			unsigned int nblocks)
+{
+  CAMELLIA_context *ctx=c;
+
+  for (; nblocks; nblocks--, inbuf+=CAMELLIA_BLOCK_SIZE,
+	 outbuf+=CAMELLIA_BLOCK_SIZE)
+    Camellia_EncryptBlock(ctx->keybitlength,inbuf,ctx->keytable,outbuf);
+  _gcry_burn_stack
+    (sizeof(int)+2*sizeof(unsigned char *)+sizeof(KEY_TABLE_TYPE)
+     +4*sizeof(u32)
+     +2*sizeof(u32*)+4*sizeof(u32)
+     +2*2*sizeof(void*) /* Function calls.  */
+    );
+}
+
+static void
+camellia_decrypt_blocks(void *c, byte *outbuf, const byte *inbuf,
+			unsigned int nblocks)
+{
+  CAMELLIA_context *ctx=c;
+
+  for (; nblocks; nblocks--, inbuf+=CAMELLIA_BLOCK_SIZE,
+	 outbuf+=CAMELLIA_BLOCK_SIZE)
+    Camellia_DecryptBlock(ctx->keybitlength,inbuf,ctx->keytable,outbuf);
+  _gcry_burn_stack
+    (sizeof(int)+2*sizeof(unsigned char *)+sizeof(KEY_TABLE_TYPE)
+     +4*sizeof(u32)
+     +2*sizeof(u32*)+4*sizeof(u32)
+     +2*2*sizeof(void*) /* Function calls.  */
+    );
+}
+
 static const char *
 selftest(void)
 {
@@ -237,17 +271,20 @@ static gcry_cipher_oid_spec_t camellia256_oids[] =
 gcry_cipher_spec_t _gcry_cipher_spec_camellia128 =
   {
     "CAMELLIA128",NULL,camellia128_oids,CAMELLIA_BLOCK_SIZE,128,
-    sizeof(CAMELLIA_context),camellia_setkey,camellia_encrypt,camellia_decrypt
+    sizeof(CAMELLIA_context),camellia_setkey,camellia_encrypt,camellia_decrypt,
+    NULL,NULL,camellia_encrypt_blocks,camellia_decrypt_blocks
   };
 
 gcry_cipher_spec_t _gcry_cipher_spec_camellia192 =
   {
     "CAMELLIA192",NULL,camellia192_oids,CAMELLIA_BLOCK_SIZE,192,
-    sizeof(CAMELLIA_context),camellia_setkey,camellia_encrypt,camellia_decrypt
+    sizeof(CAMELLIA_context),camellia_setkey,camellia_encrypt,camellia_decrypt,
+    NULL,NULL,camellia_encrypt_blocks,camellia_decrypt_blocks
   };
 
 gcry_cipher_spec_t _gcry_cipher_spec_camellia256 =
   {
     "CAMELLIA256",NULL,camellia256_oids,CAMELLIA_BLOCK_SIZE,256,
-    sizeof(CAMELLIA_context),camellia_setkey,camellia_encrypt,camellia_decrypt
+    sizeof(CAMELLIA_context),camellia_setkey,camellia_encrypt,camellia_decrypt,
+    NULL,NULL,camellia_encrypt_blocks,camellia_decrypt_blocks
   };
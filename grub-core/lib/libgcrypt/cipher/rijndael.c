@@ -1159,6 +1159,41 @@ rijndael_encrypt (void *context, byte *b, const byte *a)
 }
 
 
+/* Encrypt NBLOCKS consecutive blocks, burning the stack only once.  */
+static void
+rijndael_encrypt_blocks (void *context, byte *b, const byte *a,
+                         unsigned int nblocks)
+{
+  RIJNDAEL_context *ctx = context;
+
+  if (0)
+    ;
+#ifdef USE_PADLOCK
+  else if (ctx->use_padlock)
+    {
+      for (; nblocks; nblocks--, b += BLOCKSIZE, a += BLOCKSIZE)
+        do_padlock (ctx, 0, b, a);
+      _gcry_burn_stack (48 + 15 /* possible padding for alignment */);
+    }
+#endif /*USE_PADLOCK*/
+#ifdef USE_AESNI
+  else if (ctx->use_aesni)
+    {
+      aesni_prepare ();
+      for (; nblocks; nblocks--, b += BLOCKSIZE, a += BLOCKSIZE)
+        do_aesni (ctx, 0, b, a);
+      aesni_cleanup ();
+    }
+#endif /*USE_AESNI*/
+  else
+    {
+      for (; nblocks; nblocks--, b += BLOCKSIZE, a += BLOCKSIZE)
+        do_encrypt (ctx, b, a);
+      _gcry_burn_stack (56 + 2*sizeof(int));
+    }
+}
+
+
 /* Bulk encryption of complete blocks in CFB mode.  Caller needs to
    make sure that IV is aligned on an unsigned long boundary.  This
    function is only intended for the bulk encryption feature of
@@ -1497,6 +1532,41 @@ rijndael_decrypt (void *context, byte *b, const byte *a)
 }
 
 
+/* Decrypt NBLOCKS consecutive blocks, burning the stack only once.  */
+static void
+rijndael_decrypt_blocks (void *context, byte *b, const byte *a,
+                         unsigned int nblocks)
+{
+  RIJNDAEL_context *ctx = context;
+
+  if (0)
+    ;
+#ifdef USE_PADLOCK
+  else if (ctx->use_padlock)
+    {
+      for (; nblocks; nblocks--, b += BLOCKSIZE, a += BLOCKSIZE)
+        do_padlock (ctx, 1, b, a);
+      _gcry_burn_stack (48 + 2*sizeof(int) /* FIXME */);
+    }
+#endif /*USE_PADLOCK*/
+#ifdef USE_AESNI
+  else if (ctx->use_aesni)
+    {
+      aesni_prepare ();
+      for (; nblocks; nblocks--, b += BLOCKSIZE, a += BLOCKSIZE)
+        do_aesni (ctx, 1, b, a);
+      aesni_cleanup ();
+    }
+#endif /*USE_AESNI*/
+  else
+    {
+      for (; nblocks; nblocks--, b += BLOCKSIZE, a += BLOCKSIZE)
+        do_decrypt (ctx, b, a);
+      _gcry_burn_stack (56+2*sizeof(int));
+    }
+}
+
+
 /* Bulk decryption of complete blocks in CFB mode.  Caller needs to
    make sure that IV is aligned on an unisgned lonhg boundary.  This
    function is only intended for the bulk encryption feature of
@@ -2030,7 +2100,8 @@ static gcry_cipher_oid_spec_t rijndael_oids[] =
 gcry_cipher_spec_t _gcry_cipher_spec_aes =
   {
     "AES", rijndael_names, rijndael_oids, 16, 128, sizeof (RIJNDAEL_context),
-    rijndael_setkey, rijndael_encrypt, rijndael_decrypt
+    rijndael_setkey, rijndael_encrypt, rijndael_decrypt,
+    NULL, NULL, rijndael_encrypt_blocks, rijndael_decrypt_blocks
   };
 cipher_extra_spec_t _gcry_cipher_extraspec_aes =
   {
@@ -2056,7 +2127,8 @@ static gcry_cipher_oid_spec_t rijndael192_oids[] =
 gcry_cipher_spec_t _gcry_cipher_spec_aes192 =
   {
     "AES192", rijndael192_names, rijndael192_oids, 16, 192, sizeof (RIJNDAEL_context),
-    rijndael_setkey, rijndael_encrypt, rijndael_decrypt
+    rijndael_setkey, rijndael_encrypt, rijndael_decrypt,
+    NULL, NULL, rijndael_encrypt_blocks, rijndael_decrypt_blocks
   };
 cipher_extra_spec_t _gcry_cipher_extraspec_aes192 =
   {
@@ -2083,7 +2155,8 @@ gcry_cipher_spec_t _gcry_cipher_spec_aes256 =
   {
     "AES256", rijndael256_names, rijndael256_oids, 16, 256,
     sizeof (RIJNDAEL_context),
-    rijndael_setkey, rijndael_encrypt, rijndael_decrypt
+    rijndael_setkey, rijndael_encrypt, rijndael_decrypt,
+    NULL, NULL, rijndael_encrypt_blocks, rijndael_decrypt_blocks
   };
 
 cipher_extra_spec_t _gcry_cipher_extraspec_aes256 =
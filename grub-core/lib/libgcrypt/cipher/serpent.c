@@ -838,6 +838,28 @@ serpent_decrypt (void *ctx, byte *buffer_out, const byte *buffer_in)
   _gcry_burn_stack (2 * sizeof (serpent_block_t));
 }
 
+static void
+serpent_encrypt_blocks (void *ctx, byte *buffer_out, const byte *buffer_in,
+			unsigned int nblocks)
+{
+  serpent_context_t *context = ctx;
+
+  for (; nblocks; nblocks--, buffer_in += 16, buffer_out += 16)
+    serpent_encrypt_internal (context, buffer_in, buffer_out);
+  _gcry_burn_stack (2 * sizeof (serpent_block_t));
+}
+
+static void
+serpent_decrypt_blocks (void *ctx, byte *buffer_out, const byte *buffer_in,
+			unsigned int nblocks)
+{
+  serpent_context_t *context = ctx;
+
+  for (; nblocks; nblocks--, buffer_in += 16, buffer_out += 16)
+    serpent_decrypt_internal (context, buffer_in, buffer_out);
+  _gcry_burn_stack (2 * sizeof (serpent_block_t));
+}
+
 
 
 /* Serpent test.  */
@@ -935,19 +957,22 @@ gcry_cipher_spec_t _gcry_cipher_spec_serpent128 =
   {
     "SERPENT128", cipher_spec_serpent128_aliases, NULL, 16, 128,
     sizeof (serpent_context_t),
-    serpent_setkey, serpent_encrypt, serpent_decrypt
+    serpent_setkey, serpent_encrypt, serpent_decrypt,
+    NULL, NULL, serpent_encrypt_blocks, serpent_decrypt_blocks
   };
 
 gcry_cipher_spec_t _gcry_cipher_spec_serpent192 =
   {
     "SERPENT192", NULL, NULL, 16, 192,
     sizeof (serpent_context_t),
-    serpent_setkey, serpent_encrypt, serpent_decrypt
+    serpent_setkey, serpent_encrypt, serpent_decrypt,
+    NULL, NULL, serpent_encrypt_blocks, serpent_decrypt_blocks
   };
 
 gcry_cipher_spec_t _gcry_cipher_spec_serpent256 =
   {
     "SERPENT256", NULL, NULL, 16, 256,
     sizeof (serpent_context_t),
-    serpent_setkey, serpent_encrypt, serpent_decrypt
+    serpent_setkey, serpent_encrypt, serpent_decrypt,
+    NULL, NULL, serpent_encrypt_blocks, serpent_decrypt_blocks
   };
@@ -858,6 +858,28 @@ twofish_decrypt (void *context, byte *out, const byte *in)
   _gcry_burn_stack (24+3*sizeof (void*));
 }
 
+static void
+twofish_encrypt_blocks (void *context, byte *out, const byte *in,
+			unsigned int nblocks)
+{
+  TWOFISH_context *ctx = context;
+
+  for (; nblocks; nblocks--, in += 16, out += 16)
+    do_twofish_encrypt (ctx, out, in);
+  _gcry_burn_stack (24+3*sizeof (void*));
+}
+
+static void
+twofish_decrypt_blocks (void *context, byte *out, const byte *in,
+			unsigned int nblocks)
+{
+  TWOFISH_context *ctx = context;
+
+  for (; nblocks; nblocks--, in += 16, out += 16)
+    do_twofish_decrypt (ctx, out, in);
+  _gcry_burn_stack (24+3*sizeof (void*));
+}
+
 
 /* Test a single encryption and decryption with each key size. */
 
@@ -1030,11 +1052,13 @@ main()
 gcry_cipher_spec_t _gcry_cipher_spec_twofish =
   {
     "TWOFISH", NULL, NULL, 16, 256, sizeof (TWOFISH_context),
-    twofish_setkey, twofish_encrypt, twofish_decrypt
+    twofish_setkey, twofish_encrypt, twofish_decrypt,
+    NULL, NULL, twofish_encrypt_blocks, twofish_decrypt_blocks
   };
 
 gcry_cipher_spec_t _gcry_cipher_spec_twofish128 =
   {
     "TWOFISH128", NULL, NULL, 16, 128, sizeof (TWOFISH_context),
-    twofish_setkey, twofish_encrypt, twofish_decrypt
+    twofish_setkey, twofish_encrypt, twofish_decrypt,
+    NULL, NULL, twofish_encrypt_blocks, twofish_decrypt_blocks
   };
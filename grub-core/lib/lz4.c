@@ -36,6 +36,10 @@
 #include <grub/mm.h>
 #include <grub/misc.h>
 #include <grub/types.h>
+#include <grub/dl.h>
+#include <grub/lz4.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
 
 static int LZ4_uncompress_unknownOutputSize(const char *source, char *dest,
 					    int isize, int maxOutputSize);
@@ -131,26 +135,25 @@ typedef struct _U64_S {
 #define	LZ4_WILDCOPY(s, d, e) do { LZ4_COPYPACKET(s, d) } while (d < e);
 
 /* Decompression functions */
-grub_err_t
-lz4_decompress(void *s_start, void *d_start, grub_size_t s_len, grub_size_t d_len);
-
-grub_err_t
-lz4_decompress(void *s_start, void *d_start, grub_size_t s_len, grub_size_t d_len)
+grub_ssize_t
+grub_lz4_decompress(const char *inbuf, grub_size_t insize, char *outbuf,
+		    grub_size_t outsize)
 {
-	const BYTE *src = s_start;
-	U32 bufsiz = (src[0] << 24) | (src[1] << 16) | (src[2] << 8) |
-	    src[3];
+	int ret;
 
-	/* invalid compressed buffer size encoded at start */
-	if (bufsiz + 4 > s_len)
-		return grub_error(GRUB_ERR_BAD_FS,"lz4 decompression failed.");
+	if (insize > GRUB_INT_MAX || outsize > GRUB_INT_MAX) {
+		grub_error(GRUB_ERR_BAD_COMPRESSED_DATA,
+			   "lz4 block too large");
+		return -1;
+	}
 
-	/*
-	 * Returns 0 on success (decompression function returned non-negative)
-	 * and appropriate error on failure (decompression function returned negative).
-	 */
-	return (LZ4_uncompress_unknownOutputSize((char*)s_start + 4, d_start, bufsiz,
-	    d_len) < 0)?grub_error(GRUB_ERR_BAD_FS,"lz4 decompression failed."):0;
+	ret = LZ4_uncompress_unknownOutputSize(inbuf, outbuf, insize, outsize);
+	if (ret < 0) {
+		grub_error(GRUB_ERR_BAD_COMPRESSED_DATA,
+			   "lz4 decompression failed");
+		return -1;
+	}
+	return ret;
 }
 
 static int
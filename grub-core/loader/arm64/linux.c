@@ -289,6 +289,7 @@ grub_cmd_linux (grub_command_t cmd __attribute__ ((unused)),
   grub_file_t file = 0;
   struct linux_arch_kernel_header lh;
   grub_err_t err;
+  grub_ssize_t len;
 
   grub_dl_ref (my_mod);
 
@@ -323,8 +324,10 @@ grub_cmd_linux (grub_command_t cmd __attribute__ ((unused)),
     }
 
   grub_file_seek (file, 0);
-  if (grub_file_read (file, kernel_addr, kernel_size)
-      < (grub_int64_t) kernel_size)
+  grub_boot_time_begin ("Kernel %s", argv[0]);
+  len = grub_file_read (file, kernel_addr, kernel_size);
+  grub_boot_time_end ();
+  if (len < (grub_ssize_t) kernel_size)
     {
       if (!grub_errno)
 	grub_error (GRUB_ERR_BAD_OS, N_("premature end of file %s"), argv[0]);
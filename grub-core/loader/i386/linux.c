@@ -1001,9 +1001,11 @@ grub_cmd_linux (grub_command_t cmd __attribute__ ((unused)),
   }
 
   len = prot_file_size;
+  grub_boot_time_begin ("Kernel %s", argv[0]);
   if (grub_file_read (file, prot_mode_mem, len) != len && !grub_errno)
     grub_error (GRUB_ERR_BAD_OS, N_("premature end of file %s"),
 		argv[0]);
+  grub_boot_time_end ();
 
   if (grub_errno == GRUB_ERR_NONE)
     {
@@ -4,6 +4,7 @@
 #include <grub/misc.h>
 #include <grub/file.h>
 #include <grub/mm.h>
+#include <grub/time.h>
 
 struct newc_head
 {
@@ -199,7 +200,8 @@ grub_initrd_init (int argc, char *argv[],
 	}
       initrd_ctx->components[i].file = grub_file_open (fname,
 						       GRUB_FILE_TYPE_LINUX_INITRD
-						       | GRUB_FILE_TYPE_NO_DECOMPRESS);
+						       | GRUB_FILE_TYPE_NO_DECOMPRESS
+						       | GRUB_FILE_TYPE_NO_DISK_CACHE);
       if (!initrd_ctx->components[i].file)
 	{
 	  grub_initrd_close (initrd_ctx);
@@ -252,7 +254,8 @@ grub_initrd_load (struct grub_linux_initrd_context *initrd_ctx,
   int i;
   int newc = 0;
   struct dir *root = 0;
-  grub_ssize_t cursize = 0;
+  grub_ssize_t cursize = 0, len;
+  grub_uint64_t start, ms;
 
   for (i = 0; i < initrd_ctx->nfiles; i++)
     {
@@ -278,9 +281,16 @@ grub_initrd_load (struct grub_linux_initrd_context *initrd_ctx,
 	  newc = 0;
 	}
 
+      /* Each component is read with a single call straight into its place
+	 in the target, so the disk layer can hand large requests to the
+	 driver.  */
       cursize = initrd_ctx->components[i].size;
-      if (grub_file_read (initrd_ctx->components[i].file, ptr, cursize)
-	  != cursize)
+      grub_boot_time_begin ("Initrd %s", argv[i]);
+      start = grub_get_time_ms ();
+      len = grub_file_read (initrd_ctx->components[i].file, ptr, cursize);
+      ms = grub_get_time_ms () - start;
+      grub_boot_time_end ();
+      if (len != cursize)
 	{
 	  if (!grub_errno)
 	    grub_error (GRUB_ERR_FILE_READ_ERROR, N_("premature end of file %s"),
@@ -288,6 +298,11 @@ grub_initrd_load (struct grub_linux_initrd_context *initrd_ctx,
 	  grub_initrd_close (initrd_ctx);
 	  return grub_errno;
 	}
+      grub_dprintf ("linux", "Loaded initrd %s: %" PRIuGRUB_UINT64_T
+		    " bytes in %" PRIuGRUB_UINT64_T " ms (%" PRIuGRUB_UINT64_T
+		    " KiB/s)\n", argv[i], (grub_uint64_t) cursize, ms,
+		    ms ? grub_divmod64 ((grub_uint64_t) cursize * 1000,
+					ms * 1024, 0) : 0);
       ptr += cursize;
     }
   if (newc)
@@ -33,6 +33,7 @@
 #include <grub/charset.h>
 #include <grub/script_sh.h>
 #include <grub/bufio.h>
+#include <grub/time.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -111,6 +112,8 @@ read_config_file (const char *config)
   const char *ctmp;
 
   grub_menu_t newmenu;
+  grub_uint64_t start_ms, parse_ms;
+  unsigned long parses, cache_hits;
 
   newmenu = grub_env_get_menu ();
   if (! newmenu)
@@ -164,6 +167,12 @@ read_config_file (const char *config)
   grub_env_export ("config_file");
   grub_env_export ("config_directory");
 
+  grub_boot_time_begin ("Config %s", config);
+  start_ms = grub_get_time_ms ();
+  parse_ms = grub_script_stats.parse_ms;
+  parses = grub_script_stats.parses;
+  cache_hits = grub_script_stats.cache_hits;
+
   while (1)
     {
       char *line;
@@ -179,6 +188,16 @@ read_config_file (const char *config)
       grub_free (line);
     }
 
+  /* Both figures include the files sourced from this one.  */
+  parse_ms = grub_script_stats.parse_ms - parse_ms;
+  grub_dprintf ("scripts", "%s: parsing took %llu ms, executing %llu ms; "
+		"%lu parses, %lu sourced scripts reused\n",
+		config, (unsigned long long) parse_ms,
+		(unsigned long long) (grub_get_time_ms () - start_ms - parse_ms),
+		grub_script_stats.parses - parses,
+		grub_script_stats.cache_hits - cache_hits);
+  grub_boot_time_end ();
+
   if (old_file)
     grub_env_set ("config_file", old_file);
   else
@@ -556,6 +575,7 @@ GRUB_MOD_INIT(normal)
 GRUB_MOD_FINI(normal)
 {
   grub_context_fini ();
+  grub_script_cache_flush ();
   grub_script_fini ();
   grub_menu_fini ();
   grub_normal_auth_fini ();
@@ -158,6 +158,28 @@ grub_util_fd_seek (grub_util_fd_t fd, grub_uint64_t off)
   return -1;
 }
 
+void *
+grub_util_fd_map (grub_util_fd_t fd __attribute__ ((unused)),
+		  grub_uint64_t size __attribute__ ((unused)))
+{
+  return NULL;
+}
+
+void
+grub_util_fd_unmap (void *addr __attribute__ ((unused)),
+		    grub_uint64_t size __attribute__ ((unused)))
+{
+}
+
+ssize_t
+grub_util_fd_pread (grub_util_fd_t fd, char *buf, size_t len,
+		    grub_uint64_t off)
+{
+  if (grub_util_fd_seek (fd, off))
+    return -1;
+  return grub_util_fd_read (fd, buf, len);
+}
+
 grub_util_fd_t
 grub_util_fd_open (const char *dev, int flg)
 {
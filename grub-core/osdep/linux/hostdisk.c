@@ -357,12 +357,16 @@ grub_util_fd_open_device (const grub_disk_t disk, grub_disk_addr_t sector, int f
 #ifdef O_LARGEFILE
   flags |= O_LARGEFILE;
 #endif
+  /* Only writes need to reach the disk before we return.  */
+  if ((flags & O_ACCMODE) != O_RDONLY)
+    {
 #ifdef O_SYNC
-  flags |= O_SYNC;
+      flags |= O_SYNC;
 #endif
 #ifdef O_FSYNC
-  flags |= O_FSYNC;
+      flags |= O_FSYNC;
 #endif
+    }
 #ifdef O_BINARY
   flags |= O_BINARY;
 #endif
@@ -450,13 +454,7 @@ grub_util_fd_open_device (const grub_disk_t disk, grub_disk_addr_t sector, int f
       }
   }
 
-  if (grub_util_fd_seek (fd, sector << disk->log_sector_size))
-    {
-      close (fd);
-      grub_error (GRUB_ERR_BAD_DEVICE, N_("cannot seek `%s': %s"),
-		  grub_util_biosdisk_get_osdev (disk), strerror (errno));
-      return -1;
-    }
+  data->offset = sector << disk->log_sector_size;
 
   return fd;
 }
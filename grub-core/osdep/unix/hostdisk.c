@@ -45,6 +45,8 @@
 
 #if !defined (__CYGWIN__) && !defined (__MINGW32__) && !defined (__AROS__)
 
+#include <sys/mman.h>
+
 #ifdef __linux__
 # include <sys/ioctl.h>         /* ioctl */
 # include <sys/mount.h>
@@ -124,6 +126,66 @@ grub_util_fd_read (grub_util_fd_t fd, char *buf, size_t len)
   return size;
 }
 
+/* Read LEN bytes at offset OFF from FD in BUF without moving the file
+   position.  Return value as for grub_util_fd_read.  */
+ssize_t
+grub_util_fd_pread (grub_util_fd_t fd, char *buf, size_t len,
+		    grub_uint64_t off)
+{
+  ssize_t size = 0;
+
+  while (len)
+    {
+#if SIZEOF_OFF_T == 8
+      ssize_t ret = pread (fd, buf, len, (off_t) off);
+#elif SIZEOF_OFF64_T == 8
+      ssize_t ret = pread64 (fd, buf, len, (off64_t) off);
+#else
+#error "No large file support"
+#endif
+
+      if (ret == 0)
+	break;
+
+      if (ret < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          else
+            return ret;
+        }
+
+      len -= ret;
+      buf += ret;
+      off += ret;
+      size += ret;
+    }
+
+  return size;
+}
+
+/* Map the first SIZE bytes of FD read-only.  Return NULL if that is not
+   possible, the caller then falls back to reading.  */
+void *
+grub_util_fd_map (grub_util_fd_t fd, grub_uint64_t size)
+{
+  void *addr;
+
+  if (size == 0 || size != (grub_size_t) size)
+    return NULL;
+
+  addr = mmap (NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED)
+    return NULL;
+  return addr;
+}
+
+void
+grub_util_fd_unmap (void *addr, grub_uint64_t size)
+{
+  munmap (addr, size);
+}
+
 /* Write LEN bytes from BUF to FD. Return less than or equal to zero if an
    error occurs, otherwise return LEN.  */
 ssize_t
@@ -871,12 +871,162 @@ grub_script_execute_sourcecode_getline (char **line,
   return 0;
 }
 
+/* Parse trees of recently executed source scripts.  Menu entries are
+   kept as source text and executed through grub_script_execute_sourcecode
+   every time they are selected, so reuse the result of the first parse.  */
+#define SCRIPT_CACHE_MAX_ENTRIES 32
+
+struct script_cache_entry
+{
+  struct script_cache_entry *next;
+  char *source;
+  grub_uint32_t hash;
+  unsigned refcnt;
+  unsigned nscripts;
+  struct grub_script **scripts;
+};
+
+static struct script_cache_entry *script_cache;
+static unsigned script_cache_count;
+
+static grub_uint32_t
+script_cache_hash (const char *source)
+{
+  grub_uint32_t hash = 2166136261U;
+
+  for (; *source; source++)
+    hash = (hash ^ (grub_uint8_t) *source) * 16777619;
+  return hash;
+}
+
+static void
+script_cache_free_entry (struct script_cache_entry *entry)
+{
+  unsigned i;
+
+  for (i = 0; i < entry->nscripts; i++)
+    grub_script_free (entry->scripts[i]);
+  grub_free (entry->scripts);
+  grub_free (entry->source);
+  grub_free (entry);
+}
+
+static void
+script_cache_release (struct script_cache_entry *entry)
+{
+  /* An entry evicted while it was running is freed by its last user.  */
+  if (--entry->refcnt == 0 && ! entry->source)
+    script_cache_free_entry (entry);
+}
+
+static struct script_cache_entry *
+script_cache_find (const char *source, grub_uint32_t hash)
+{
+  struct script_cache_entry **prev, *entry;
+
+  for (prev = &script_cache; (entry = *prev); prev = &entry->next)
+    if (entry->hash == hash && grub_strcmp (entry->source, source) == 0)
+      {
+	/* Move to the front.  */
+	*prev = entry->next;
+	entry->next = script_cache;
+	script_cache = entry;
+	return entry;
+      }
+
+  return 0;
+}
+
+static void
+script_cache_evict (struct script_cache_entry *entry)
+{
+  if (entry->refcnt)
+    {
+      /* Still executing, mark it as detached.  */
+      grub_free (entry->source);
+      entry->source = 0;
+      entry->next = 0;
+    }
+  else
+    script_cache_free_entry (entry);
+}
+
+static void
+script_cache_insert (const char *source, grub_uint32_t hash,
+		     struct grub_script **scripts, unsigned nscripts)
+{
+  struct script_cache_entry *entry, **prev;
+
+  entry = grub_zalloc (sizeof (*entry));
+  if (! entry)
+    goto fail;
+  entry->source = grub_strdup (source);
+  if (! entry->source)
+    {
+      grub_free (entry);
+      goto fail;
+    }
+  entry->hash = hash;
+  entry->scripts = scripts;
+  entry->nscripts = nscripts;
+  entry->next = script_cache;
+  script_cache = entry;
+
+  if (++script_cache_count > SCRIPT_CACHE_MAX_ENTRIES)
+    {
+      for (prev = &script_cache; (*prev)->next; prev = &(*prev)->next);
+      entry = *prev;
+      *prev = 0;
+      script_cache_count--;
+      script_cache_evict (entry);
+    }
+  return;
+
+ fail:
+  grub_errno = GRUB_ERR_NONE;
+  while (nscripts)
+    grub_script_free (scripts[--nscripts]);
+  grub_free (scripts);
+}
+
+void
+grub_script_cache_flush (void)
+{
+  struct script_cache_entry *entry;
+
+  while ((entry = script_cache))
+    {
+      script_cache = entry->next;
+      script_cache_evict (entry);
+    }
+  script_cache_count = 0;
+}
+
 /* Execute a source script.  */
 grub_err_t
 grub_script_execute_sourcecode (const char *source)
 {
   grub_err_t ret = 0;
   struct grub_script *parsed_script;
+  struct script_cache_entry *entry;
+  struct grub_script **scripts = 0;
+  unsigned nscripts = 0, i;
+  unsigned long generation = grub_script_function_generation;
+  const char *start = source;
+  grub_uint32_t hash;
+  int cacheable = 1;
+
+  hash = script_cache_hash (source);
+  entry = script_cache_find (source, hash);
+  if (entry)
+    {
+      grub_script_stats.cache_hits++;
+      entry->refcnt++;
+      for (i = 0; i < entry->nscripts; i++)
+	ret = grub_script_execute (entry->scripts[i]);
+      script_cache_release (entry);
+      return ret;
+    }
 
   while (source)
     {
@@ -885,16 +1035,47 @@ grub_script_execute_sourcecode (const char *source)
       grub_script_execute_sourcecode_getline (&line, 0, &source);
       parsed_script = grub_script_parse
 	(line, grub_script_execute_sourcecode_getline, &source);
+      grub_free (line);
       if (! parsed_script)
 	{
 	  ret = grub_errno;
-	  grub_free (line);
+	  cacheable = 0;
 	  break;
 	}
 
+      /* Keep the parse tree around unless it defined a function.  */
+      if (cacheable && generation == grub_script_function_generation
+	  && (nscripts & (nscripts - 1)) == 0)
+	{
+	  struct grub_script **n;
+
+	  n = grub_realloc (scripts, (nscripts ? nscripts * 2 : 1)
+			    * sizeof (scripts[0]));
+	  if (! n)
+	    {
+	      grub_errno = GRUB_ERR_NONE;
+	      cacheable = 0;
+	    }
+	  else
+	    scripts = n;
+	}
+      if (generation != grub_script_function_generation)
+	cacheable = 0;
+
       ret = grub_script_execute (parsed_script);
-      grub_script_free (parsed_script);
-      grub_free (line);
+      if (cacheable)
+	scripts[nscripts++] = parsed_script;
+      else
+	grub_script_free (parsed_script);
+    }
+
+  if (cacheable && nscripts && ! script_cache_find (start, hash))
+    script_cache_insert (start, hash, scripts, nscripts);
+  else
+    {
+      while (nscripts)
+	grub_script_free (scripts[--nscripts]);
+      grub_free (scripts);
     }
 
   return ret;
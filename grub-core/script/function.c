@@ -23,6 +23,7 @@
 #include <grub/charset.h>
 
 grub_script_function_t grub_script_function_list;
+unsigned long grub_script_function_generation;
 
 grub_script_function_t
 grub_script_function_create (struct grub_script_arg *functionname_arg,
@@ -43,6 +44,7 @@ grub_script_function_create (struct grub_script_arg *functionname_arg,
     }
 
   func->func = cmd;
+  grub_script_function_generation++;
 
   /* Keep the list sorted for simplicity.  */
   p = &grub_script_function_list;
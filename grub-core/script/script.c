@@ -21,6 +21,7 @@
 #include <grub/script_sh.h>
 #include <grub/parser.h>
 #include <grub/mm.h>
+#include <grub/time.h>
 
 /* It is not possible to deallocate the memory when a syntax error was
    found.  Because of that it is required to keep track of all memory
@@ -337,11 +338,10 @@ grub_script_create (struct grub_script_cmd *cmd, struct grub_script_mem *mem)
   return parsed;
 }
 
-/* Parse the script passed in SCRIPT and return the parsed
-   datastructure that is ready to be interpreted.  */
-struct grub_script *
-grub_script_parse (char *script,
-		   grub_reader_getline_t getline, void *getline_data)
+/* Helper for grub_script_parse.  */
+static struct grub_script *
+grub_script_parse_real (char *script,
+			grub_reader_getline_t getline, void *getline_data)
 {
   struct grub_script *parsed;
   struct grub_script_mem *membackup;
@@ -394,3 +394,22 @@ grub_script_parse (char *script,
 
   return parsed;
 }
+
+struct grub_script_stats grub_script_stats;
+
+/* Parse the script passed in SCRIPT and return the parsed
+   datastructure that is ready to be interpreted.  */
+struct grub_script *
+grub_script_parse (char *script,
+		   grub_reader_getline_t getline, void *getline_data)
+{
+  struct grub_script *parsed;
+  grub_uint64_t start;
+
+  start = grub_get_time_ms ();
+  parsed = grub_script_parse_real (script, getline, getline_data);
+  grub_script_stats.parse_ms += grub_get_time_ms () - start;
+  grub_script_stats.parses++;
+
+  return parsed;
+}
@@ -0,0 +1,136 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Check the ECB and CBC helpers, which use the ciphers' bulk entry points
+   when they have them, against a plain block-at-a-time computation.  */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/crypto.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* Deliberately not a multiple of GRUB_CRYPTO_BULK_BLOCKS.  */
+#define NBLOCKS 37
+
+static const char *const ciphers[] =
+  {
+    "aes", "serpent", "twofish", "camellia128"
+  };
+
+static void
+check_cipher (const char *name)
+{
+  const gcry_cipher_spec_t *spec;
+  grub_crypto_cipher_handle_t cipher = NULL;
+  grub_uint8_t key[32];
+  grub_uint8_t iv[GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE];
+  grub_uint8_t *plain = NULL, *ref = NULL, *buf = NULL;
+  grub_size_t bs, size, i;
+
+  spec = grub_crypto_lookup_cipher_by_name (name);
+  if (!spec)
+    {
+      grub_test_assert (0, "cipher %s not found", name);
+      return;
+    }
+  bs = spec->blocksize;
+  size = NBLOCKS * bs;
+
+  for (i = 0; i < sizeof (key); i++)
+    key[i] = i * 7 + 1;
+
+  cipher = grub_crypto_cipher_open (spec);
+  plain = grub_malloc (size);
+  ref = grub_malloc (size);
+  buf = grub_malloc (size);
+  if (!cipher || !plain || !ref || !buf)
+    {
+      grub_test_assert (0, "out of memory");
+      goto out;
+    }
+  if (grub_crypto_cipher_set_key (cipher, key, spec->keylen / GRUB_CHAR_BIT))
+    {
+      grub_test_assert (0, "%s: setkey failed", name);
+      goto out;
+    }
+
+  for (i = 0; i < size; i++)
+    plain[i] = i * 13 + 5;
+
+  /* ECB encryption.  */
+  for (i = 0; i < size; i += bs)
+    spec->encrypt (cipher->ctx, ref + i, plain + i);
+  grub_crypto_ecb_encrypt (cipher, buf, plain, size);
+  grub_test_assert (grub_memcmp (buf, ref, size) == 0,
+		    "%s: ECB encryption mismatch", name);
+
+  /* ECB decryption, in place.  */
+  grub_crypto_ecb_decrypt (cipher, buf, buf, size);
+  grub_test_assert (grub_memcmp (buf, plain, size) == 0,
+		    "%s: ECB decryption mismatch", name);
+
+  /* CBC encryption, then a reference decryption.  */
+  grub_memset (iv, 0x5a, sizeof (iv));
+  grub_crypto_cbc_encrypt (cipher, ref, plain, size, iv);
+  grub_memset (iv, 0x5a, sizeof (iv));
+  for (i = 0; i < size; i += bs)
+    {
+      spec->decrypt (cipher->ctx, buf + i, ref + i);
+      grub_crypto_xor (buf + i, buf + i, i ? ref + i - bs : iv, bs);
+    }
+  grub_test_assert (grub_memcmp (buf, plain, size) == 0,
+		    "%s: CBC encryption mismatch", name);
+
+  /* CBC decryption, out of place.  */
+  grub_memset (iv, 0x5a, sizeof (iv));
+  grub_crypto_cbc_decrypt (cipher, buf, ref, size, iv);
+  grub_test_assert (grub_memcmp (buf, plain, size) == 0,
+		    "%s: CBC decryption mismatch", name);
+  grub_test_assert (grub_memcmp (iv, ref + size - bs, bs) == 0,
+		    "%s: CBC decryption returned wrong IV", name);
+
+  /* CBC decryption, in place and split at an odd block boundary.  */
+  grub_memcpy (buf, ref, size);
+  grub_memset (iv, 0x5a, sizeof (iv));
+  grub_crypto_cbc_decrypt (cipher, buf, buf, 11 * bs, iv);
+  grub_crypto_cbc_decrypt (cipher, buf + 11 * bs, buf + 11 * bs,
+			   size - 11 * bs, iv);
+  grub_test_assert (grub_memcmp (buf, plain, size) == 0,
+		    "%s: in-place CBC decryption mismatch", name);
+
+ out:
+  grub_free (plain);
+  grub_free (ref);
+  grub_free (buf);
+  if (cipher)
+    grub_crypto_cipher_close (cipher);
+}
+
+static void
+cipher_bulk_test (void)
+{
+  unsigned i;
+
+  for (i = 0; i < ARRAY_SIZE (ciphers); i++)
+    check_cipher (ciphers[i]);
+}
+
+GRUB_FUNCTIONAL_TEST (cipher_bulk_test, cipher_bulk_test);
@@ -0,0 +1,174 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Ciphers as used by cryptodisk and hashes as used by the verifiers and
+   hashsum.  */
+
+#include <grub/bench.h>
+#include <grub/crypto.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define BUF_SIZE (64 * 1024)
+
+struct crypto_bench
+{
+  grub_crypto_cipher_handle_t cipher;
+  const gcry_md_spec_t *md;
+  grub_uint8_t iv[GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE];
+  grub_uint8_t digest[GRUB_CRYPTO_MAX_MDLEN];
+  grub_uint8_t buf[BUF_SIZE];
+};
+
+static grub_err_t
+crypto_init (void **data, const char *cipher_name, const char *md_name)
+{
+  struct crypto_bench *c;
+  grub_uint8_t key[32];
+  unsigned i;
+
+  c = grub_zalloc (sizeof (*c));
+  if (c == NULL)
+    return grub_errno;
+
+  for (i = 0; i < BUF_SIZE; i++)
+    c->buf[i] = i * 13;
+  for (i = 0; i < sizeof (key); i++)
+    key[i] = i;
+
+  if (cipher_name)
+    {
+      const gcry_cipher_spec_t *spec;
+
+      spec = grub_crypto_lookup_cipher_by_name (cipher_name);
+      if (spec == NULL)
+	{
+	  grub_free (c);
+	  return grub_error (GRUB_ERR_FILE_NOT_FOUND, "cipher %s not found",
+			     cipher_name);
+	}
+      c->cipher = grub_crypto_cipher_open (spec);
+      if (c->cipher == NULL)
+	{
+	  grub_free (c);
+	  return grub_errno;
+	}
+      grub_crypto_cipher_set_key (c->cipher, key, spec->keylen / GRUB_CHAR_BIT);
+    }
+
+  if (md_name)
+    {
+      c->md = grub_crypto_lookup_md_by_name (md_name);
+      if (c->md == NULL)
+	{
+	  grub_free (c);
+	  return grub_error (GRUB_ERR_FILE_NOT_FOUND, "hash %s not found",
+			     md_name);
+	}
+    }
+
+  *data = c;
+  return GRUB_ERR_NONE;
+}
+
+static void
+crypto_fini (void *data)
+{
+  struct crypto_bench *c = data;
+
+  if (c->cipher)
+    grub_crypto_cipher_close (c->cipher);
+  grub_free (c);
+}
+
+#define CIPHER_INIT(fn, name)				\
+  static grub_err_t					\
+  fn (void **data)					\
+  {							\
+    return crypto_init (data, name, NULL);		\
+  }
+
+#define MD_INIT(fn, name)				\
+  static grub_err_t					\
+  fn (void **data)					\
+  {							\
+    return crypto_init (data, NULL, name);		\
+  }
+
+CIPHER_INIT (aes_init, "aes")
+CIPHER_INIT (serpent_init, "serpent")
+CIPHER_INIT (twofish_init, "twofish")
+MD_INIT (sha1_init, "sha1")
+MD_INIT (sha256_init, "sha256")
+MD_INIT (sha512_init, "sha512")
+MD_INIT (crc32_init, "crc32")
+
+static void
+ecb_decrypt (void *data)
+{
+  struct crypto_bench *c = data;
+  grub_crypto_ecb_decrypt (c->cipher, c->buf, c->buf, BUF_SIZE);
+}
+
+static void
+cbc_decrypt (void *data)
+{
+  struct crypto_bench *c = data;
+  grub_crypto_cbc_decrypt (c->cipher, c->buf, c->buf, BUF_SIZE, c->iv);
+}
+
+static void
+cbc_encrypt (void *data)
+{
+  struct crypto_bench *c = data;
+  grub_crypto_cbc_encrypt (c->cipher, c->buf, c->buf, BUF_SIZE, c->iv);
+}
+
+static void
+hash (void *data)
+{
+  struct crypto_bench *c = data;
+  grub_crypto_hash (c->md, c->digest, c->buf, BUF_SIZE);
+}
+
+static struct grub_bench crypto_benches[] =
+  {
+    { .name = "cipher/aes-ecb-decrypt", .bytes = BUF_SIZE,
+      .init = aes_init, .run = ecb_decrypt, .fini = crypto_fini },
+    { .name = "cipher/aes-cbc-decrypt", .bytes = BUF_SIZE,
+      .init = aes_init, .run = cbc_decrypt, .fini = crypto_fini },
+    { .name = "cipher/aes-cbc-encrypt", .bytes = BUF_SIZE,
+      .init = aes_init, .run = cbc_encrypt, .fini = crypto_fini },
+    { .name = "cipher/serpent-cbc-decrypt", .bytes = BUF_SIZE,
+      .init = serpent_init, .run = cbc_decrypt, .fini = crypto_fini },
+    { .name = "cipher/twofish-cbc-decrypt", .bytes = BUF_SIZE,
+      .init = twofish_init, .run = cbc_decrypt, .fini = crypto_fini },
+    { .name = "hash/sha1", .bytes = BUF_SIZE,
+      .init = sha1_init, .run = hash, .fini = crypto_fini },
+    { .name = "hash/sha256", .bytes = BUF_SIZE,
+      .init = sha256_init, .run = hash, .fini = crypto_fini },
+    { .name = "hash/sha512", .bytes = BUF_SIZE,
+      .init = sha512_init, .run = hash, .fini = crypto_fini },
+    { .name = "hash/crc32", .bytes = BUF_SIZE,
+      .init = crc32_init, .run = hash, .fini = crypto_fini },
+  };
+
+GRUB_BENCHMARKS (crypto_bench, crypto_benches);
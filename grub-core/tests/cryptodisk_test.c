@@ -0,0 +1,163 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Known-answer tests for decrypting several sectors at once through
+   grub_cryptodisk_decrypt.  The expected values are the SHA-256 of the
+   plaintext, computed independently with OpenSSL one sector at a time.  */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/crypto.h>
+#include <grub/cryptodisk.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define LOG_SECTOR_SIZE 9
+#define NSECTORS 4
+
+struct cryptodisk_vector
+{
+  const char *name;
+  grub_cryptodisk_mode_t mode;
+  grub_cryptodisk_mode_iv_t mode_iv;
+  grub_size_t keysize;
+  grub_disk_addr_t sector;
+  grub_uint8_t digest[32];
+};
+
+static const struct cryptodisk_vector vectors[] =
+  {
+    {
+      "aes-xts-plain64", GRUB_CRYPTODISK_MODE_XTS,
+      GRUB_CRYPTODISK_MODE_IV_PLAIN64, 32, 0x123456789ULL,
+      {
+	0x37, 0xac, 0x0c, 0x5d, 0x11, 0x22, 0x34, 0xd3,
+	0x1e, 0x49, 0xbc, 0x0c, 0x30, 0xbc, 0xea, 0x4b,
+	0xc3, 0x85, 0x40, 0xcd, 0x35, 0x98, 0x2f, 0x13,
+	0x47, 0xb7, 0xab, 0xe5, 0x82, 0xf5, 0xc0, 0xdc
+      }
+    },
+    {
+      "aes-cbc-essiv:sha256", GRUB_CRYPTODISK_MODE_CBC,
+      GRUB_CRYPTODISK_MODE_IV_ESSIV, 16, 5,
+      {
+	0x96, 0xaf, 0x25, 0x80, 0x90, 0x64, 0xe7, 0x6f,
+	0x6a, 0xd1, 0x3a, 0x5f, 0xfc, 0x0d, 0xb9, 0x78,
+	0xa6, 0xca, 0xdb, 0x6c, 0x97, 0x81, 0xc1, 0x69,
+	0xa9, 0xf5, 0xd8, 0xb6, 0x00, 0xe2, 0xa3, 0x2f
+      }
+    }
+  };
+
+static void
+check_vector (const struct cryptodisk_vector *v,
+	      const gcry_cipher_spec_t *aes, const gcry_md_spec_t *sha256)
+{
+  struct grub_cryptodisk dev;
+  grub_uint8_t key[32];
+  grub_uint8_t digest[32];
+  grub_uint8_t *buf = NULL;
+  grub_size_t size = NSECTORS << LOG_SECTOR_SIZE, i;
+  gcry_err_code_t err;
+
+  grub_memset (&dev, 0, sizeof (dev));
+  dev.mode = v->mode;
+  dev.mode_iv = v->mode_iv;
+  dev.log_sector_size = LOG_SECTOR_SIZE;
+  dev.cipher = grub_crypto_cipher_open (aes);
+  if (v->mode == GRUB_CRYPTODISK_MODE_XTS)
+    dev.secondary_cipher = grub_crypto_cipher_open (aes);
+  if (v->mode_iv == GRUB_CRYPTODISK_MODE_IV_ESSIV)
+    {
+      dev.essiv_cipher = grub_crypto_cipher_open (aes);
+      dev.essiv_hash = sha256;
+    }
+  buf = grub_malloc (size);
+  if (!dev.cipher || !buf
+      || (v->mode == GRUB_CRYPTODISK_MODE_XTS && !dev.secondary_cipher)
+      || (v->mode_iv == GRUB_CRYPTODISK_MODE_IV_ESSIV && !dev.essiv_cipher))
+    {
+      grub_test_assert (0, "out of memory");
+      goto out;
+    }
+
+  for (i = 0; i < v->keysize; i++)
+    key[i] = i * 7 + 1;
+  err = grub_cryptodisk_setkey (&dev, key, v->keysize);
+  if (err)
+    {
+      grub_test_assert (0, "%s: setkey failed: %d", v->name, err);
+      goto out;
+    }
+
+  /* All sectors in one call.  */
+  for (i = 0; i < size; i++)
+    buf[i] = i * 13 + 5;
+  err = grub_cryptodisk_decrypt (&dev, buf, size, v->sector);
+  grub_test_assert (err == GPG_ERR_NO_ERROR, "%s: decryption failed: %d",
+		    v->name, err);
+  grub_crypto_hash (sha256, digest, buf, size);
+  grub_test_assert (grub_memcmp (digest, v->digest, sizeof (digest)) == 0,
+		    "%s: multi-sector decryption mismatch", v->name);
+
+  /* The same data split into one sector and the rest.  */
+  for (i = 0; i < size; i++)
+    buf[i] = i * 13 + 5;
+  err = grub_cryptodisk_decrypt (&dev, buf, 1U << LOG_SECTOR_SIZE, v->sector);
+  if (!err)
+    err = grub_cryptodisk_decrypt (&dev, buf + (1U << LOG_SECTOR_SIZE),
+				   size - (1U << LOG_SECTOR_SIZE),
+				   v->sector + 1);
+  grub_test_assert (err == GPG_ERR_NO_ERROR, "%s: decryption failed: %d",
+		    v->name, err);
+  grub_crypto_hash (sha256, digest, buf, size);
+  grub_test_assert (grub_memcmp (digest, v->digest, sizeof (digest)) == 0,
+		    "%s: split decryption mismatch", v->name);
+
+ out:
+  grub_free (buf);
+  if (dev.cipher)
+    grub_crypto_cipher_close (dev.cipher);
+  if (dev.secondary_cipher)
+    grub_crypto_cipher_close (dev.secondary_cipher);
+  if (dev.essiv_cipher)
+    grub_crypto_cipher_close (dev.essiv_cipher);
+}
+
+static void
+cryptodisk_test (void)
+{
+  const gcry_cipher_spec_t *aes;
+  const gcry_md_spec_t *sha256;
+  unsigned i;
+
+  aes = grub_crypto_lookup_cipher_by_name ("aes");
+  sha256 = grub_crypto_lookup_md_by_name ("sha256");
+  if (!aes || !sha256)
+    {
+      grub_test_assert (0, "aes or sha256 not found");
+      return;
+    }
+
+  for (i = 0; i < ARRAY_SIZE (vectors); i++)
+    check_vector (&vectors[i], aes, sha256);
+}
+
+GRUB_FUNCTIONAL_TEST (cryptodisk_test, cryptodisk_test);
@@ -0,0 +1,224 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Decompressors used for kernels, initrds and filesystem extents.  Every
+   decompressor works on the same config-file-like text so the numbers can
+   be compared against each other.  */
+
+#include <grub/bench.h>
+#include <grub/deflate.h>
+#include <grub/dl.h>
+#include <grub/i18n.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+
+#include "xz.h"
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+#include <minilzo.h>
+
+#include "decompress_bench_data.h"
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define TEXT_SIZE 16384
+
+struct decompress_bench
+{
+  grub_uint8_t *text;
+  grub_uint8_t *out;
+  grub_uint8_t *lzo;
+  lzo_uint lzo_size;
+  struct xz_dec *xz;
+  ZSTD_DCtx *zstd;
+};
+
+static void
+fill_text (grub_uint8_t *buf, grub_size_t size)
+{
+  static const char *const words[] =
+    {
+      "menuentry", "linux", "initrd", "insmod", "search", "--fs-uuid",
+      "--set=root", "echo", "'Loading", "Linux'", "/boot/vmlinuz", "ro",
+      "quiet", "splash", "gfxpayload=keep", "part_gpt", "ext2", "{", "}",
+      "\n", "\t", "set", "root=UUID=", "7a1c03e5"
+    };
+  grub_uint32_t state = 1;
+  grub_size_t pos = 0;
+
+  while (pos < size)
+    {
+      const char *w;
+
+      state = state * 1103515245 + 12345;
+      w = words[(state >> 16) % ARRAY_SIZE (words)];
+      while (*w && pos < size)
+	buf[pos++] = *w++;
+      if (pos < size)
+	buf[pos++] = ' ';
+    }
+}
+
+static void *
+zstd_malloc (void *state __attribute__ ((unused)), size_t size)
+{
+  return grub_malloc (size);
+}
+
+static void
+zstd_free (void *state __attribute__ ((unused)), void *address)
+{
+  grub_free (address);
+}
+
+static void
+decompress_fini (void *data)
+{
+  struct decompress_bench *d = data;
+
+  if (d->xz)
+    xz_dec_end (d->xz);
+  if (d->zstd)
+    ZSTD_freeDCtx (d->zstd);
+  grub_free (d->lzo);
+  grub_free (d->text);
+  grub_free (d->out);
+  grub_free (d);
+}
+
+static grub_err_t
+decompress_init (void **data)
+{
+  struct decompress_bench *d;
+  ZSTD_customMem allocator;
+  void *wrkmem = NULL;
+
+  d = grub_zalloc (sizeof (*d));
+  if (d == NULL)
+    return grub_errno;
+
+  allocator.customAlloc = zstd_malloc;
+  allocator.customFree = zstd_free;
+  allocator.opaque = NULL;
+
+  d->text = grub_malloc (TEXT_SIZE);
+  d->out = grub_malloc (TEXT_SIZE);
+  /* Worst case expansion of LZO1X.  */
+  d->lzo = grub_malloc (TEXT_SIZE + TEXT_SIZE / 16 + 64 + 3);
+  wrkmem = grub_malloc (LZO1X_1_MEM_COMPRESS);
+  d->xz = xz_dec_init (1 << 16);
+  d->zstd = ZSTD_createDCtx_advanced (allocator);
+  if (!d->text || !d->out || !d->lzo || !wrkmem || !d->xz || !d->zstd)
+    {
+      grub_free (wrkmem);
+      decompress_fini (d);
+      return grub_error (GRUB_ERR_OUT_OF_MEMORY, N_("out of memory"));
+    }
+
+  fill_text (d->text, TEXT_SIZE);
+
+  /* LZO is the only one with a compressor in GRUB.  */
+  if (lzo1x_1_compress (d->text, TEXT_SIZE, d->lzo, &d->lzo_size,
+			wrkmem) != LZO_E_OK)
+    {
+      grub_free (wrkmem);
+      decompress_fini (d);
+      return grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "lzo compression failed");
+    }
+  grub_free (wrkmem);
+
+  *data = d;
+  return GRUB_ERR_NONE;
+}
+
+/* Don't report the time taken by an error path.  */
+static void
+check_output (struct decompress_bench *d, grub_size_t size, const char *name)
+{
+  if (size != TEXT_SIZE || grub_memcmp (d->out, d->text, TEXT_SIZE) != 0)
+    grub_error (GRUB_ERR_TEST_FAILURE,
+		"%s decompression produced wrong output", name);
+}
+
+static void
+deflate_run (void *data)
+{
+  struct decompress_bench *d = data;
+  grub_ssize_t ret;
+
+  ret = grub_zlib_decompress ((char *) deflate_data, sizeof (deflate_data), 0,
+			      (char *) d->out, TEXT_SIZE);
+  check_output (d, ret, "deflate");
+}
+
+static void
+xz_run (void *data)
+{
+  struct decompress_bench *d = data;
+  struct xz_buf buf;
+
+  xz_dec_reset (d->xz);
+  buf.in = xz_data;
+  buf.in_pos = 0;
+  buf.in_size = sizeof (xz_data);
+  buf.out = d->out;
+  buf.out_pos = 0;
+  buf.out_size = TEXT_SIZE;
+  if (xz_dec_run (d->xz, &buf) != XZ_STREAM_END)
+    buf.out_pos = 0;
+  check_output (d, buf.out_pos, "xz");
+}
+
+static void
+zstd_run (void *data)
+{
+  struct decompress_bench *d = data;
+  grub_size_t ret;
+
+  ret = ZSTD_decompressDCtx (d->zstd, d->out, TEXT_SIZE,
+			     zstd_data, sizeof (zstd_data));
+  if (ZSTD_isError (ret))
+    ret = 0;
+  check_output (d, ret, "zstd");
+}
+
+static void
+lzo_run (void *data)
+{
+  struct decompress_bench *d = data;
+  lzo_uint size = TEXT_SIZE;
+
+  if (lzo1x_decompress_safe (d->lzo, d->lzo_size, d->out, &size,
+			     NULL) != LZO_E_OK)
+    size = 0;
+  check_output (d, size, "lzo");
+}
+
+static struct grub_bench decompress_benches[] =
+  {
+    { .name = "decompress/deflate", .bytes = TEXT_SIZE,
+      .init = decompress_init, .run = deflate_run, .fini = decompress_fini },
+    { .name = "decompress/xz", .bytes = TEXT_SIZE,
+      .init = decompress_init, .run = xz_run, .fini = decompress_fini },
+    { .name = "decompress/zstd", .bytes = TEXT_SIZE,
+      .init = decompress_init, .run = zstd_run, .fini = decompress_fini },
+    { .name = "decompress/lzo", .bytes = TEXT_SIZE,
+      .init = decompress_init, .run = lzo_run, .fini = decompress_fini },
+  };
+
+GRUB_BENCHMARKS (decompress_bench, decompress_benches);
@@ -0,0 +1,532 @@
+/* The output of fill_text (TEXT_SIZE = 16384) compressed with zlib at
+   level 9, xz with a 64 KiB dictionary and CRC32 check, and zstd -19.  */
+
+static unsigned char deflate_data[] =
+{
+0x78, 0xda, 0x8d, 0x5b, 0x4d, 0x6f, 0x1b, 0x47, 0x12, 0x3d, 0x77, 0xff, 0x0a, 0xde, 0x72, 0x32,
+0x92, 0xcd, 0x62, 0xb1, 0x27, 0xdf, 0xf6, 0x12, 0xc0, 0xd7, 0x9c, 0x17, 0x8a, 0xcd, 0xc8, 0xc2,
+0xda, 0x92, 0x42, 0x52, 0x81, 0x93, 0x41, 0xff, 0xf7, 0x25, 0xfb, 0xa3, 0xea, 0xd5, 0xab, 0xaa,
+0xa1, 0x21, 0xc3, 0x1a, 0x71, 0x66, 0xfa, 0xa3, 0x3e, 0x5f, 0xbd, 0x6a, 0x3e, 0xfe, 0xfe, 0xed,
+0xf5, 0xe1, 0xaf, 0x2f, 0x2f, 0x0f, 0x9f, 0xde, 0xff, 0xef, 0x78, 0x7c, 0x3d, 0xbc, 0x7b, 0x77,
+0x3e, 0x5e, 0xde, 0x9f, 0x5e, 0x5e, 0x2e, 0x87, 0x0f, 0x4f, 0xcf, 0x6f, 0xdf, 0x7e, 0x38, 0x3c,
+0x3d, 0x9f, 0xbf, 0xbe, 0x7c, 0x5a, 0xbf, 0xea, 0xf5, 0xe2, 0xe9, 0x72, 0xfa, 0x74, 0x38, 0xbd,
+0x1c, 0x0a, 0x3e, 0x7d, 0x7e, 0xfd, 0xf2, 0x70, 0xfe, 0x7c, 0xf8, 0xf7, 0xc3, 0x3f, 0x3e, 0xfe,
+0xf4, 0xcf, 0xe3, 0xbf, 0x0e, 0x7f, 0xbc, 0x3d, 0x1d, 0x2f, 0xd7, 0x47, 0xb6, 0xc3, 0xf1, 0xe3,
+0xe7, 0x97, 0xeb, 0x2f, 0xb9, 0xb3, 0x1d, 0x1e, 0x69, 0xd2, 0xdb, 0x00, 0xef, 0x7f, 0xfd, 0xf5,
+0x97, 0xff, 0xbc, 0x3f, 0x34, 0x7d, 0xee, 0xf5, 0xe1, 0x74, 0xf9, 0xef, 0xe3, 0xeb, 0x45, 0x2f,
+0x60, 0x3a, 0xf9, 0xec, 0xcb, 0x6d, 0x95, 0x87, 0x1f, 0x7f, 0xbb, 0x7e, 0xf8, 0xe3, 0x9f, 0x5f,
+0x6f, 0x7f, 0xfd, 0x7d, 0x38, 0x7e, 0xbb, 0xfc, 0x7c, 0x38, 0x1f, 0x1f, 0x4e, 0x1f, 0x3f, 0x87,
+0xf7, 0x61, 0xbe, 0x7a, 0xfd, 0xb1, 0x37, 0xaf, 0x53, 0x5c, 0x97, 0xf8, 0xf5, 0xf8, 0xfc, 0x76,
+0x7c, 0xbe, 0x9c, 0xfe, 0x5a, 0xe3, 0x94, 0x7e, 0x43, 0xa6, 0xed, 0x9b, 0x7a, 0x74, 0xc2, 0xfb,
+0xfd, 0xfc, 0xee, 0xed, 0xed, 0xe9, 0x93, 0x1b, 0xb4, 0x2d, 0x69, 0xe2, 0xd2, 0x40, 0x96, 0xb2,
+0x1e, 0x1e, 0x52, 0x26, 0xdc, 0x64, 0x84, 0xdb, 0xcc, 0xfa, 0xdf, 0x8e, 0x2c, 0xa7, 0xca, 0x7e,
+0xf8, 0x70, 0xbd, 0xf9, 0xf4, 0xfc, 0x08, 0xcb, 0xd3, 0x2b, 0xbb, 0x4c, 0x10, 0x30, 0x8c, 0x63,
+0x9f, 0x19, 0x8a, 0x85, 0xdb, 0xf0, 0xd2, 0xb8, 0x37, 0x44, 0x3e, 0x0d, 0x82, 0xd7, 0x27, 0xea,
+0xe5, 0x1b, 0x73, 0x7b, 0x2a, 0x78, 0xbd, 0x9a, 0x1b, 0x11, 0x59, 0xcc, 0x47, 0x83, 0x8d, 0xc9,
+0x47, 0x73, 0xf6, 0x6d, 0x2e, 0x69, 0x8e, 0x30, 0x3f, 0x65, 0x6b, 0xd0, 0xd7, 0xe6, 0xc8, 0x6d,
+0xbd, 0xd0, 0x60, 0xec, 0x74, 0x27, 0x53, 0x8b, 0xc9, 0xe0, 0xa9, 0x3a, 0x86, 0x98, 0xc4, 0x32,
+0xe0, 0xc9, 0x69, 0x1f, 0x76, 0x24, 0x15, 0xc7, 0x16, 0x3f, 0xc0, 0xeb, 0x1b, 0x86, 0x9c, 0x1a,
+0x54, 0xb7, 0x1e, 0xef, 0xee, 0xe7, 0xe3, 0x8e, 0xee, 0x65, 0xed, 0x05, 0xe4, 0x82, 0x26, 0x2d,
+0xa3, 0x1b, 0xef, 0xb3, 0xd2, 0xdf, 0x42, 0x3f, 0xd6, 0xed, 0x8d, 0x77, 0xc0, 0xf0, 0x4f, 0xd3,
+0xd4, 0xed, 0x30, 0xe3, 0x31, 0xf0, 0xd3, 0xf1, 0xf1, 0x6d, 0xfd, 0xeb, 0x72, 0xfc, 0xba, 0xbe,
+0x7e, 0xfd, 0x77, 0xfb, 0x1c, 0xe6, 0x85, 0xcb, 0x3e, 0x76, 0x6c, 0xcf, 0x6a, 0x4e, 0x63, 0x3b,
+0x70, 0x6b, 0x2a, 0x7d, 0xac, 0xe2, 0x24, 0x8b, 0x1b, 0x7f, 0xf3, 0x7b, 0x73, 0x8a, 0xf5, 0x92,
+0xdc, 0x66, 0xbb, 0x5b, 0x3b, 0x1d, 0xa3, 0x74, 0xc1, 0x8a, 0x95, 0xb5, 0xbe, 0x8b, 0xb1, 0x25,
+0xdd, 0xf5, 0x7c, 0x91, 0x64, 0xa6, 0xca, 0x69, 0xfe, 0x15, 0x79, 0x6a, 0x27, 0x74, 0x6c, 0x6b,
+0x3f, 0x45, 0x17, 0xc0, 0xbe, 0x35, 0xe6, 0xe4, 0x41, 0x9c, 0x6f, 0xf1, 0x03, 0x7d, 0x57, 0x32,
+0x16, 0xcc, 0xe9, 0xe3, 0xfd, 0x94, 0x9e, 0xd1, 0x8d, 0x6e, 0xac, 0x0f, 0x54, 0x9c, 0x5b, 0x5d,
+0xa7, 0x94, 0x25, 0x4f, 0xe9, 0x94, 0xeb, 0xd3, 0x35, 0x75, 0x27, 0x50, 0x96, 0xb1, 0x0b, 0x19,
+0xe5, 0xf6, 0xb9, 0xfc, 0xd1, 0xf5, 0x33, 0x82, 0x8a, 0x0e, 0x21, 0xab, 0x38, 0xad, 0x7b, 0x0d,
+0x47, 0xaa, 0xd7, 0x07, 0x6a, 0x1f, 0x66, 0xc8, 0x0c, 0x6e, 0x35, 0xc8, 0xa7, 0xd3, 0x91, 0x6e,
+0xfe, 0xd7, 0xad, 0x5e, 0x76, 0x0d, 0x97, 0x33, 0xb6, 0x82, 0x59, 0xcd, 0x3d, 0xaa, 0x05, 0xcd,
+0x01, 0x8d, 0xb1, 0xc7, 0xe1, 0xbe, 0xae, 0x81, 0x30, 0xb6, 0xb8, 0xc9, 0x4e, 0x2f, 0x30, 0x00,
+0xeb, 0xc6, 0xb8, 0x41, 0x5f, 0x8f, 0x48, 0x0a, 0x16, 0x90, 0x89, 0xde, 0x58, 0x52, 0x18, 0x3f,
+0x65, 0xbe, 0x7a, 0x33, 0x65, 0x1b, 0x9b, 0x74, 0x2d, 0xcb, 0xd1, 0xe5, 0x96, 0x4b, 0xdf, 0x6c,
+0xbc, 0x3d, 0x22, 0xf4, 0x3b, 0x62, 0x23, 0x55, 0x07, 0x1c, 0x3a, 0x94, 0x9d, 0xd4, 0xf5, 0xd6,
+0xdc, 0x6d, 0x9d, 0x0f, 0xc4, 0x11, 0x77, 0xec, 0x66, 0x1b, 0xea, 0xb4, 0x3e, 0x4c, 0xa8, 0x45,
+0xa2, 0xca, 0x92, 0xee, 0x54, 0xbe, 0xae, 0x5e, 0xde, 0x34, 0x4a, 0x30, 0xc1, 0x55, 0x1f, 0x1e,
+0x8b, 0x8a, 0xd0, 0xd2, 0xa6, 0x19, 0xad, 0xeb, 0x68, 0xce, 0xd3, 0x48, 0xd8, 0xce, 0x77, 0x9d,
+0x79, 0x24, 0x49, 0x1b, 0x24, 0x5f, 0x48, 0x56, 0x4d, 0x3f, 0xe1, 0x97, 0xb7, 0xeb, 0xcf, 0x4d,
+0xad, 0x60, 0x3c, 0x11, 0x24, 0x2a, 0x56, 0x5a, 0x01, 0xd4, 0x9b, 0xe1, 0x7d, 0xec, 0x5f, 0x34,
+0x5d, 0xdd, 0x4a, 0x7c, 0xf8, 0x0e, 0x83, 0x93, 0x8e, 0x35, 0xb7, 0xa7, 0x92, 0x37, 0x49, 0xfa,
+0xb2, 0x82, 0x10, 0x86, 0x1c, 0xc1, 0x76, 0x73, 0xf2, 0xda, 0x7f, 0xd8, 0xfc, 0xc2, 0x11, 0xc3,
+0xc5, 0x98, 0x6c, 0xa9, 0x8a, 0x38, 0x89, 0xe3, 0x93, 0x4d, 0xcd, 0x05, 0x91, 0x0f, 0x8f, 0xff,
+0x11, 0x41, 0x26, 0x9a, 0xb4, 0xbf, 0x2a, 0x24, 0x4f, 0x6f, 0xc4, 0x1e, 0xfd, 0xbb, 0xc4, 0xab,
+0xfb, 0xdc, 0x96, 0xe5, 0x81, 0xe9, 0x2e, 0x6c, 0xd6, 0x55, 0x51, 0xd6, 0x85, 0x4f, 0x38, 0x29,
+0xf2, 0x5a, 0x01, 0x2a, 0x15, 0xe1, 0x5c, 0x89, 0x37, 0xd3, 0x66, 0x20, 0x05, 0x79, 0x4e, 0x51,
+0x54, 0x76, 0x0b, 0xdd, 0x71, 0x8e, 0x95, 0xd5, 0xf9, 0xf2, 0xc1, 0x45, 0x9f, 0xb6, 0x74, 0x29,
+0x8e, 0xd7, 0x18, 0x29, 0xec, 0x24, 0x63, 0x04, 0x5b, 0x73, 0xc1, 0x6e, 0x86, 0x28, 0x14, 0xd5,
+0x6e, 0x3c, 0xeb, 0xcd, 0x31, 0x5f, 0x89, 0x10, 0x97, 0x1b, 0xb4, 0xcb, 0x26, 0x42, 0xe2, 0xa8,
+0x4f, 0xcd, 0x38, 0xdb, 0x6e, 0x1c, 0x31, 0x79, 0x74, 0x2a, 0x64, 0x08, 0xdc, 0x06, 0x47, 0x17,
+0x7d, 0x24, 0x37, 0x6e, 0x0e, 0xae, 0xa1, 0x2d, 0xa5, 0x79, 0xc6, 0x1b, 0x92, 0x13, 0x1b, 0xa0,
+0x2b, 0xfb, 0xee, 0xa6, 0x51, 0x43, 0x5f, 0x32, 0x11, 0x64, 0xc9, 0x33, 0xd5, 0xe0, 0x94, 0x0f,
+0xe4, 0x43, 0x55, 0xa2, 0x85, 0x81, 0xb7, 0x30, 0xb8, 0x13, 0xe3, 0xe6, 0x40, 0x64, 0x67, 0x43,
+0x90, 0x00, 0x93, 0xcf, 0xc7, 0x08, 0xd2, 0x41, 0x18, 0xdf, 0x4c, 0x0e, 0x58, 0x78, 0x9f, 0xea,
+0xf6, 0x68, 0x14, 0xe3, 0x00, 0x3e, 0xd9, 0xc2, 0xe5, 0xd0, 0x0b, 0x0d, 0x09, 0xf7, 0xa1, 0xc8,
+0xb8, 0xa7, 0xbd, 0x79, 0x7f, 0x0e, 0x56, 0x22, 0x10, 0x84, 0x36, 0xdc, 0x6d, 0x89, 0x45, 0xce,
+0xc9, 0x9f, 0x0b, 0x49, 0xbf, 0x06, 0x9b, 0x32, 0x8a, 0x14, 0x90, 0xaa, 0xbc, 0x92, 0x54, 0xc9,
+0x70, 0xb9, 0x20, 0x20, 0xba, 0x5f, 0x18, 0x74, 0x65, 0x21, 0x8c, 0x58, 0x59, 0xbb, 0x11, 0xbe,
+0xba, 0xed, 0xdf, 0x26, 0x4d, 0x36, 0xea, 0xa8, 0xe0, 0xc7, 0x7c, 0xa0, 0x72, 0x5c, 0x69, 0xac,
+0xc5, 0x16, 0x68, 0xaa, 0xd8, 0x29, 0x19, 0x2b, 0x29, 0xb6, 0x01, 0xc4, 0xb5, 0x35, 0xb0, 0x19,
+0x46, 0xd0, 0x02, 0x4b, 0xee, 0xd6, 0x13, 0x14, 0xfc, 0x4d, 0xa9, 0x43, 0x45, 0x68, 0xc9, 0x05,
+0xde, 0x8c, 0x13, 0x8c, 0x98, 0x72, 0x93, 0x01, 0xbc, 0x5b, 0x57, 0xb4, 0x36, 0x4a, 0xb6, 0xc8,
+0xe0, 0xf4, 0x12, 0x49, 0x7b, 0x61, 0x79, 0x07, 0x74, 0x7d, 0x89, 0x03, 0x79, 0x01, 0xa0, 0x6e,
+0xff, 0xd4, 0xc3, 0xa5, 0x86, 0x48, 0xa2, 0x8d, 0xfc, 0xaa, 0x96, 0xbb, 0x78, 0xaa, 0x66, 0xb3,
+0xda, 0xaa, 0x9a, 0xed, 0x65, 0x9f, 0xc1, 0xca, 0x76, 0xde, 0x65, 0x1f, 0xca, 0x59, 0x08, 0x58,
+0x4a, 0xa5, 0x4c, 0xcb, 0x78, 0x19, 0xd6, 0x29, 0x96, 0x13, 0x6e, 0x92, 0x5d, 0xb5, 0xcd, 0x58,
+0x71, 0x31, 0x0e, 0x8e, 0x09, 0xc9, 0x53, 0x09, 0x1b, 0xa6, 0x17, 0x17, 0xb1, 0xd9, 0x15, 0xac,
+0x2a, 0x02, 0x6d, 0x46, 0xd9, 0x0f, 0x71, 0x39, 0xe8, 0x8d, 0x0a, 0x08, 0xa6, 0x58, 0x0a, 0x3b,
+0xb4, 0xec, 0xb6, 0x3f, 0x59, 0x94, 0x6b, 0x45, 0x42, 0x89, 0x0c, 0xbe, 0x38, 0xd6, 0x80, 0x65,
+0x58, 0x49, 0x0b, 0x26, 0x6e, 0x83, 0x68, 0x18, 0x94, 0xda, 0xb7, 0x82, 0xcd, 0x62, 0x99, 0x1b,
+0x91, 0x82, 0xf2, 0xa0, 0x5c, 0x70, 0x71, 0x92, 0xac, 0x98, 0xb5, 0xde, 0x97, 0x47, 0x25, 0xf4,
+0x18, 0xc0, 0x55, 0x66, 0xe4, 0x68, 0x3c, 0xb2, 0x97, 0x4d, 0x65, 0xea, 0x4a, 0xf6, 0x64, 0xa0,
+0x3d, 0xa7, 0x0e, 0xce, 0x19, 0x10, 0x49, 0x34, 0xdc, 0x33, 0x82, 0xc5, 0x30, 0xab, 0xe5, 0x20,
+0x26, 0x49, 0xe6, 0x5f, 0xb1, 0x12, 0x2c, 0x6b, 0x7d, 0xb3, 0x9e, 0xf7, 0xc1, 0xbc, 0xdf, 0x77,
+0x9c, 0x02, 0x4a, 0x2a, 0xa9, 0x3f, 0x3d, 0x4b, 0x36, 0x1e, 0x0f, 0x57, 0xe5, 0xaa, 0x40, 0x6b,
+0x3d, 0x0a, 0xc8, 0xa4, 0x94, 0xd6, 0xbd, 0x72, 0x9b, 0x60, 0x65, 0x53, 0x72, 0xca, 0x88, 0xa5,
+0x9f, 0x05, 0xd6, 0xa4, 0xce, 0x64, 0x6c, 0x9f, 0xb3, 0x4d, 0x55, 0x64, 0x62, 0x5f, 0x85, 0xc8,
+0x9e, 0xe0, 0xf5, 0xd9, 0x9d, 0x00, 0xed, 0x47, 0xdc, 0x94, 0x4b, 0x3a, 0x9e, 0x22, 0x0c, 0x51,
+0x9a, 0xe1, 0x3f, 0x6b, 0x47, 0x31, 0x77, 0x08, 0xb1, 0x3d, 0x24, 0x5d, 0x0c, 0x66, 0x9f, 0xf0,
+0x94, 0xa3, 0x1c, 0x14, 0xdc, 0xcd, 0x85, 0xbc, 0x94, 0x7d, 0xe7, 0x51, 0x52, 0x0a, 0xf8, 0x8c,
+0xc9, 0x2f, 0xad, 0xbb, 0x64, 0x75, 0x63, 0x01, 0xd5, 0x2d, 0x04, 0xdb, 0x21, 0x1e, 0x5d, 0xa0,
+0x46, 0xf9, 0xde, 0x09, 0x99, 0x54, 0x1b, 0x30, 0x6b, 0x56, 0xff, 0x19, 0x72, 0xd6, 0xc1, 0x55,
+0xf5, 0xf6, 0x10, 0x62, 0x1b, 0xc0, 0x35, 0xd7, 0x2d, 0x14, 0x7c, 0xec, 0x1b, 0x16, 0x31, 0xa0,
+0xe7, 0x42, 0x2e, 0x88, 0xcc, 0xcb, 0xc3, 0x4d, 0xa1, 0x20, 0x6c, 0x01, 0x24, 0xfb, 0x67, 0xf4,
+0x75, 0xbf, 0x7a, 0x76, 0xce, 0x27, 0x4d, 0x8f, 0xc5, 0x5c, 0xf1, 0x1b, 0x4d, 0x0d, 0x0a, 0x5b,
+0x5c, 0xba, 0xe9, 0xea, 0xa2, 0x22, 0xea, 0x17, 0x18, 0x99, 0xa8, 0x26, 0x28, 0x9a, 0xeb, 0x57,
+0x24, 0x85, 0x37, 0x98, 0xb1, 0xe4, 0x38, 0x9c, 0x36, 0xb0, 0x9a, 0x03, 0xd5, 0xab, 0xe1, 0x82,
+0x0d, 0x0b, 0x8d, 0x18, 0x5b, 0x8e, 0x79, 0x4d, 0x1e, 0xf5, 0x9f, 0x0b, 0xac, 0x9a, 0x55, 0x96,
+0x37, 0x33, 0x0d, 0xd3, 0x8c, 0x7b, 0xa5, 0xbc, 0xd9, 0x4c, 0xb0, 0x97, 0xc2, 0x57, 0xa3, 0xec,
+0x62, 0xa6, 0x94, 0x89, 0x96, 0x5c, 0x92, 0x2e, 0xdc, 0x85, 0x8b, 0xa0, 0x53, 0xb6, 0xc3, 0xb6,
+0xb3, 0x03, 0xa8, 0x27, 0x40, 0xaf, 0x45, 0xab, 0x87, 0xa8, 0x14, 0xda, 0x34, 0x1a, 0x8d, 0xad,
+0x07, 0xf4, 0x1d, 0x77, 0x4b, 0xac, 0xf7, 0x78, 0xcc, 0x6c, 0x52, 0x15, 0xd7, 0x3c, 0xb5, 0x23,
+0xe0, 0x66, 0x63, 0x99, 0x01, 0x8f, 0x1e, 0x57, 0x4f, 0xe1, 0x60, 0x5e, 0x5e, 0x71, 0x6b, 0x17,
+0xe6, 0x60, 0x51, 0xe8, 0x12, 0x5b, 0x4c, 0x11, 0x17, 0xcf, 0x29, 0x8e, 0xa9, 0xac, 0x5a, 0x9b,
+0xf2, 0xeb, 0xb6, 0x62, 0xd5, 0x6a, 0x3e, 0x8c, 0x55, 0xf3, 0x71, 0x3b, 0x18, 0x61, 0x4d, 0xf6,
+0xd1, 0x12, 0xf1, 0xcd, 0x1e, 0x32, 0x94, 0xac, 0xdf, 0x1c, 0x75, 0x07, 0x76, 0x92, 0xa1, 0x11,
+0xf0, 0x7c, 0x8e, 0xf8, 0x37, 0x28, 0x2c, 0x38, 0xee, 0x21, 0xe9, 0xb4, 0xc5, 0xa6, 0x1e, 0xc5,
+0x18, 0x4f, 0x41, 0xa4, 0x9c, 0xee, 0x58, 0xcb, 0x86, 0x8d, 0xb8, 0xa8, 0x02, 0xf0, 0x8c, 0x2e,
+0x77, 0x52, 0x11, 0x06, 0x25, 0x4d, 0x8d, 0xa9, 0x2e, 0x67, 0x35, 0xb6, 0x00, 0x60, 0x53, 0xe1,
+0x04, 0x76, 0x0f, 0xf3, 0xb6, 0x58, 0x4e, 0x0d, 0xb6, 0xeb, 0x0b, 0xf4, 0xea, 0x67, 0x67, 0xe3,
+0x12, 0x32, 0x27, 0x61, 0x20, 0xb9, 0x18, 0x5f, 0x4e, 0x62, 0x4d, 0x3b, 0xec, 0xee, 0x19, 0xa6,
+0x76, 0xbf, 0xcd, 0x6d, 0x1a, 0x37, 0xb6, 0x92, 0x11, 0x1d, 0xa5, 0xb0, 0x47, 0xd8, 0xfa, 0xd6,
+0xd9, 0x52, 0x27, 0x5f, 0xb2, 0x8d, 0x40, 0xfd, 0x58, 0x09, 0x7a, 0x2b, 0x4b, 0x70, 0x11, 0x86,
+0x7a, 0xac, 0x41, 0xf6, 0x8e, 0x29, 0x78, 0xdc, 0xfb, 0xdd, 0x30, 0xac, 0x46, 0x47, 0x25, 0xbc,
+0x1c, 0xa3, 0xf0, 0x8e, 0x44, 0x2b, 0x2b, 0x1e, 0x5a, 0xa1, 0xf7, 0x4f, 0xa1, 0x44, 0x04, 0xb5,
+0xc9, 0x13, 0xb3, 0xcd, 0xd0, 0xc5, 0x51, 0xa9, 0x6e, 0x91, 0x2e, 0x0f, 0x9b, 0x24, 0x52, 0x09,
+0x5a, 0x24, 0x84, 0x80, 0x0b, 0x0a, 0x36, 0x39, 0x93, 0x34, 0xe5, 0x03, 0x15, 0x7c, 0x95, 0xb1,
+0xee, 0x1c, 0x1c, 0x92, 0xf6, 0x8e, 0x97, 0x39, 0x60, 0xcd, 0x16, 0x71, 0xc6, 0x93, 0x20, 0x4b,
+0x18, 0x16, 0xf6, 0x1b, 0xf6, 0xfe, 0xfb, 0x7e, 0x66, 0x99, 0x53, 0xd3, 0x4f, 0xb4, 0xb7, 0x42,
+0x98, 0x1d, 0xb3, 0xb0, 0xe3, 0x17, 0xa3, 0x97, 0x30, 0x07, 0x4d, 0xd6, 0xcc, 0x47, 0x73, 0x40,
+0x75, 0x26, 0xd0, 0x08, 0xa6, 0x36, 0x84, 0x55, 0xdb, 0x39, 0x5e, 0xc5, 0x7b, 0xf6, 0x0d, 0xff,
+0x08, 0x6c, 0xec, 0xa5, 0xb9, 0x90, 0x81, 0xd8, 0x23, 0xaa, 0x4a, 0x8e, 0x8e, 0x76, 0xf3, 0x0e,
+0xa2, 0x77, 0x5f, 0x59, 0x55, 0xb4, 0x8b, 0x22, 0x46, 0x84, 0xa1, 0xa2, 0xa6, 0xed, 0x7c, 0x72,
+0xa9, 0x8a, 0x05, 0xcb, 0x34, 0xf8, 0xec, 0xd5, 0xc6, 0xcc, 0x54, 0x24, 0x3f, 0xc0, 0x58, 0x5e,
+0xf2, 0x35, 0xc6, 0x25, 0x55, 0xd9, 0xe9, 0x6d, 0x64, 0xed, 0xa2, 0x50, 0x16, 0x8b, 0x09, 0x9f,
+0x81, 0x80, 0xcf, 0xf3, 0x90, 0x2d, 0x38, 0xce, 0x12, 0x92, 0x82, 0xd4, 0xc9, 0x72, 0x9d, 0xae,
+0x38, 0x7c, 0x19, 0x5a, 0xf5, 0x12, 0x17, 0xcb, 0x8e, 0xcc, 0xbe, 0xf7, 0x54, 0xdc, 0x4f, 0xe3,
+0xce, 0x83, 0x1b, 0x76, 0x46, 0x8b, 0xe0, 0xbc, 0x0a, 0x9f, 0x7c, 0x99, 0x24, 0xa2, 0xb8, 0xd3,
+0x69, 0xb4, 0x06, 0xb0, 0x38, 0x81, 0xbe, 0x06, 0x2f, 0x77, 0xb1, 0x8b, 0x49, 0x0e, 0x31, 0xb1,
+0x5a, 0x4a, 0x9d, 0x2d, 0x12, 0x3f, 0x73, 0x09, 0x49, 0x06, 0x90, 0x13, 0x46, 0x1b, 0xaa, 0xdf,
+0x56, 0x0b, 0x01, 0xb4, 0x34, 0xf1, 0xb5, 0x6f, 0xd9, 0x47, 0x1a, 0xb8, 0x59, 0xa4, 0x4a, 0x89,
+0x37, 0xec, 0xe4, 0x1d, 0x96, 0x1c, 0x8e, 0x97, 0x88, 0x07, 0x83, 0x76, 0x22, 0x03, 0xf7, 0xfc,
+0xd5, 0x75, 0x52, 0xd6, 0x59, 0xa9, 0xe3, 0x16, 0x90, 0xd8, 0xb3, 0xe7, 0xf8, 0xb6, 0x7b, 0x94,
+0xdd, 0x7e, 0x5b, 0x25, 0xa1, 0x4d, 0x36, 0x01, 0xc3, 0x2c, 0xfd, 0x29, 0x5a, 0xec, 0xa1, 0x9b,
+0xf6, 0x47, 0x21, 0x44, 0xc3, 0x1d, 0xcf, 0x62, 0x3a, 0xc9, 0x7b, 0x9c, 0xd7, 0xde, 0x5f, 0x18,
+0xdb, 0xb8, 0x16, 0xbf, 0x64, 0xcd, 0x40, 0x87, 0x67, 0x59, 0x9e, 0x37, 0xeb, 0x25, 0xa0, 0x8a,
+0xdd, 0x35, 0x4f, 0xc8, 0xc4, 0xdc, 0xa1, 0x66, 0x88, 0xa8, 0x0a, 0x4a, 0xf0, 0x21, 0x4c, 0x1e,
+0x7a, 0xb7, 0xd3, 0xab, 0x39, 0xbc, 0x36, 0x32, 0x48, 0xc2, 0x6f, 0x5a, 0x16, 0xa4, 0x04, 0x15,
+0xde, 0x46, 0xac, 0x5a, 0xb5, 0xa7, 0xbb, 0xb6, 0x00, 0x7b, 0x62, 0xa4, 0xd5, 0xa5, 0x37, 0x5b,
+0x9a, 0x35, 0x1f, 0x1b, 0x48, 0x05, 0xb3, 0x8d, 0x99, 0x44, 0x08, 0x49, 0xea, 0x9b, 0xab, 0x5e,
+0x20, 0xfd, 0x84, 0xc5, 0x83, 0xc7, 0xa1, 0xb6, 0xb4, 0x6a, 0xfe, 0x38, 0xb3, 0x46, 0x22, 0x09,
+0xa4, 0x02, 0xa3, 0xad, 0xa5, 0xcd, 0x0f, 0x87, 0xd4, 0x7b, 0xf3, 0xb4, 0xf0, 0xb1, 0x0d, 0x60,
+0xa3, 0x96, 0x9b, 0x73, 0xf5, 0x86, 0xe0, 0xec, 0xe2, 0x31, 0x0e, 0xda, 0x78, 0x74, 0xb4, 0x0e,
+0xc9, 0xac, 0x20, 0x29, 0x16, 0x54, 0x2f, 0x97, 0x49, 0x15, 0x79, 0x86, 0x99, 0x18, 0xe2, 0x83,
+0xb0, 0xc5, 0x1f, 0x39, 0xe5, 0xe3, 0x47, 0xb6, 0xaa, 0xdb, 0x82, 0xf2, 0x0e, 0x39, 0xc1, 0x9d,
+0x82, 0xc1, 0x1b, 0x26, 0x68, 0x39, 0x28, 0x64, 0xf4, 0x78, 0xb0, 0xe1, 0x9c, 0xdb, 0x1d, 0x2a,
+0x1d, 0x6b, 0x30, 0xc6, 0x2c, 0x9b, 0x76, 0x53, 0xe5, 0x1c, 0xd0, 0x84, 0xb5, 0x67, 0x07, 0x8b,
+0x80, 0x1d, 0xb5, 0x5d, 0x2a, 0x03, 0x9a, 0x7b, 0x32, 0x46, 0x1a, 0x87, 0xb1, 0x34, 0x25, 0xaf,
+0xb4, 0xf0, 0x80, 0x18, 0x1a, 0x09, 0x8d, 0x8b, 0x74, 0xd3, 0x43, 0xbb, 0xdb, 0x74, 0x72, 0xc7,
+0x4a, 0xad, 0x75, 0x96, 0xc0, 0x51, 0xd2, 0x16, 0xbb, 0xad, 0xc5, 0xb9, 0x24, 0x77, 0x48, 0x4c,
+0xbe, 0x6e, 0x12, 0x1e, 0xcc, 0xe3, 0x76, 0x9c, 0x77, 0x6c, 0xdb, 0xbd, 0xa4, 0xd2, 0x32, 0x73,
+0x39, 0x04, 0xbb, 0xac, 0x10, 0xed, 0x37, 0x30, 0xd7, 0x13, 0x27, 0xff, 0xa8, 0xd6, 0x44, 0xc3,
+0x74, 0xa4, 0xaf, 0x3d, 0x53, 0x1c, 0xa9, 0x38, 0xae, 0xf8, 0x94, 0xf8, 0xcd, 0x4f, 0x85, 0x32,
+0x06, 0xcb, 0x6b, 0xa9, 0xe0, 0x70, 0x94, 0xf8, 0x30, 0x9d, 0x61, 0x2e, 0x96, 0x9e, 0xea, 0x39,
+0x2e, 0x5e, 0x62, 0x1c, 0x45, 0xbe, 0xfb, 0xbb, 0x20, 0x36, 0xe3, 0xb6, 0xbc, 0x3c, 0xcd, 0xf9,
+0x38, 0x13, 0x88, 0xcb, 0x3c, 0x8c, 0x93, 0x1c, 0x35, 0x0a, 0x69, 0x4a, 0x63, 0x0b, 0x75, 0xf1,
+0xf3, 0x09, 0x52, 0xa2, 0xaf, 0x3d, 0xd9, 0x48, 0x8e, 0xdf, 0x8a, 0xc1, 0xff, 0xc3, 0x13, 0xda,
+0x46, 0xe4, 0xb1, 0xa1, 0xda, 0xc3, 0x14, 0x32, 0xb4, 0x07, 0xea, 0xa3, 0x55, 0x06, 0x44, 0xa6,
+0x49, 0x48, 0xf5, 0xce, 0x89, 0x6b, 0x66, 0x7d, 0x2c, 0x25, 0x53, 0xe2, 0x0e, 0x2c, 0xcb, 0x03,
+0x12, 0x91, 0x25, 0xc8, 0x72, 0x68, 0x9a, 0xf0, 0x8b, 0x7e, 0x7b, 0x46, 0x0e, 0x36, 0xcc, 0xac,
+0x48, 0x06, 0x31, 0x3e, 0x43, 0x5c, 0x10, 0xec, 0x18, 0x72, 0x09, 0xf9, 0x71, 0x51, 0x40, 0x3b,
+0xba, 0xd2, 0xe2, 0x21, 0xcd, 0x9f, 0x85, 0x08, 0x5a, 0x32, 0x92, 0x20, 0xce, 0xac, 0x3e, 0xf7,
+0x65, 0x97, 0xd0, 0x28, 0x42, 0xd3, 0xb3, 0x01, 0xaf, 0x52, 0xa8, 0xee, 0x78, 0x24, 0x5a, 0x8a,
+0xf4, 0xbd, 0x6c, 0x6b, 0xa9, 0x3a, 0xa2, 0x09, 0x8e, 0x27, 0x72, 0x41, 0x9d, 0xb3, 0x88, 0xc8,
+0x54, 0xb8, 0xa3, 0x5b, 0x2e, 0xe6, 0x23, 0xfc, 0x93, 0x72, 0xd0, 0x04, 0xb5, 0xbc, 0x8c, 0x62,
+0xdf, 0x20, 0x8c, 0xb9, 0x5f, 0xf0, 0xac, 0x63, 0x57, 0xca, 0x58, 0x15, 0x1b, 0x3f, 0x99, 0x61,
+0xe2, 0x36, 0x3f, 0xc2, 0x2e, 0xe9, 0xe1, 0x51, 0x7b, 0x28, 0xc5, 0x6c, 0x9b, 0x44, 0x6f, 0xae,
+0x72, 0xa9, 0xdd, 0xe7, 0x5a, 0x0b, 0x71, 0xed, 0xe8, 0xa0, 0x0d, 0x1e, 0x6d, 0x1b, 0xed, 0xa4,
+0xf8, 0x2b, 0x96, 0x5b, 0x92, 0xfa, 0x9a, 0x69, 0x6d, 0xb9, 0xd8, 0x61, 0xeb, 0xd3, 0xf4, 0xfb,
+0x44, 0x11, 0xe5, 0xeb, 0xf2, 0xbd, 0xff, 0xda, 0x5b, 0x62, 0xe7, 0xb8, 0xa2, 0x16, 0xf4, 0xdd,
+0xe9, 0xac, 0x95, 0xfd, 0xba, 0x83, 0xad, 0xdc, 0xf4, 0xc4, 0x20, 0x37, 0xac, 0xc2, 0xbe, 0x95,
+0xf3, 0x70, 0x3a, 0xd5, 0xb9, 0x77, 0x80, 0x23, 0xe8, 0x15, 0x26, 0xd0, 0xc6, 0xd8, 0x5d, 0x51,
+0x54, 0x19, 0xc4, 0xb0, 0xe0, 0x3c, 0x07, 0x9d, 0x2e, 0x4a, 0x62, 0x28, 0x57, 0x78, 0x10, 0xc8,
+0x22, 0xf6, 0xb2, 0xba, 0xba, 0xdd, 0xa0, 0x6e, 0xdf, 0x0f, 0x97, 0xd8, 0x12, 0xb9, 0xe9, 0xf7,
+0x1f, 0xd2, 0x9a, 0x8b, 0xca, 0x84, 0xee, 0xe8, 0xec, 0xe0, 0xcc, 0x05, 0xf7, 0x32, 0xc2, 0x78,
+0xec, 0x41, 0x64, 0x8c, 0x66, 0xf2, 0x95, 0xa7, 0xc0, 0x24, 0x3c, 0x65, 0xcf, 0xcd, 0x98, 0x90,
+0x31, 0xcd, 0xf1, 0x98, 0x1e, 0xb4, 0x32, 0x12, 0xde, 0xa4, 0xb4, 0x2c, 0x26, 0xac, 0xbb, 0x6c,
+0xc6, 0xa4, 0x3f, 0xb6, 0xbd, 0x57, 0xe1, 0x1e, 0x95, 0x14, 0x4c, 0xa4, 0x58, 0x49, 0xe7, 0xdf,
+0xe8, 0xd8, 0x3b, 0xf6, 0xb5, 0x88, 0xa5, 0x22, 0x33, 0x87, 0xae, 0xb7, 0x76, 0xbb, 0xf3, 0x55,
+0x2f, 0xd7, 0x5e, 0x69, 0xde, 0x40, 0x2a, 0x9e, 0x86, 0x73, 0x77, 0x7b, 0x69, 0x46, 0xc9, 0xd6,
+0x70, 0x30, 0x19, 0x73, 0x38, 0x78, 0x15, 0xa9, 0xef, 0xce, 0x73, 0x47, 0x7c, 0x8e, 0xd2, 0x91,
+0x00, 0x36, 0x43, 0x50, 0x46, 0xf5, 0x5f, 0x52, 0xfa, 0xee, 0x00, 0xeb, 0xe5, 0xbe, 0x53, 0x36,
+0x8d, 0xc8, 0xf8, 0x7f, 0x9f, 0x98, 0x59, 0x7b,
+};
+
+static unsigned char xz_data[] =
+{
+0xfd, 0x37, 0x7a, 0x58, 0x5a, 0x00, 0x00, 0x01, 0x69, 0x22, 0xde, 0x36, 0x02, 0x00, 0x21, 0x01,
+0x08, 0x00, 0x00, 0x00, 0xd8, 0x0f, 0x23, 0x13, 0xe0, 0x3f, 0xff, 0x0a, 0x9b, 0x5d, 0x00, 0x33,
+0x99, 0x8b, 0x77, 0xc4, 0x0a, 0x79, 0x03, 0xc4, 0x1d, 0xc8, 0x0e, 0x28, 0x9b, 0x53, 0x88, 0x55,
+0x0b, 0x3e, 0x32, 0xaf, 0xe1, 0x31, 0xb5, 0xa4, 0x75, 0xd6, 0x5c, 0xfd, 0xa3, 0x0d, 0x93, 0x6d,
+0xbe, 0x96, 0xa5, 0x23, 0x4a, 0x78, 0xee, 0x9b, 0xd9, 0xab, 0x07, 0xd4, 0xd3, 0x1f, 0x65, 0x6b,
+0xaf, 0x97, 0x5d, 0xd0, 0xa9, 0xe7, 0xdb, 0x00, 0xb6, 0x82, 0x25, 0x77, 0xc7, 0xdc, 0x1d, 0x07,
+0x90, 0xae, 0xe7, 0xae, 0x83, 0xac, 0xfa, 0x85, 0x70, 0x0b, 0xa7, 0xd6, 0x04, 0x35, 0x2d, 0x60,
+0x9c, 0x61, 0xac, 0xf2, 0xbd, 0x1f, 0x77, 0xaa, 0xb8, 0x00, 0xe7, 0x18, 0xcc, 0x6c, 0x01, 0x98,
+0xf0, 0xf0, 0x85, 0xb4, 0x58, 0x13, 0x74, 0xde, 0xb6, 0xaf, 0xdd, 0x92, 0x93, 0xa2, 0x5a, 0x43,
+0xdd, 0x5f, 0xc6, 0xb7, 0x26, 0x9f, 0xaf, 0xd5, 0x7f, 0xb4, 0xab, 0x23, 0x98, 0xf9, 0x21, 0x96,
+0xf9, 0xd6, 0x50, 0xc2, 0xfa, 0xb1, 0x29, 0x9b, 0x20, 0x30, 0xa9, 0x5e, 0x51, 0xcf, 0x66, 0x99,
+0x61, 0x6f, 0xc9, 0x67, 0x69, 0x28, 0x2d, 0xef, 0x34, 0x92, 0xd6, 0xe3, 0x2d, 0x53, 0xcb, 0x8a,
+0xf2, 0x7c, 0x57, 0x9f, 0xdc, 0x99, 0x53, 0xfc, 0x2d, 0x90, 0x0a, 0x72, 0x11, 0xf0, 0x3a, 0xd9,
+0xf9, 0xc5, 0x89, 0x24, 0x13, 0xfd, 0xf8, 0x9c, 0x84, 0x2d, 0x5f, 0x02, 0x32, 0x97, 0xba, 0x12,
+0x8c, 0x71, 0x89, 0x58, 0x69, 0xf3, 0x22, 0xc7, 0x9a, 0x57, 0xb1, 0xa7, 0x87, 0x82, 0xb4, 0x15,
+0x73, 0xa7, 0x22, 0x55, 0x2b, 0xcb, 0xa2, 0x83, 0xb5, 0x18, 0xf3, 0xa2, 0x83, 0x8b, 0x89, 0x15,
+0x36, 0x38, 0x9e, 0x7b, 0x5f, 0x76, 0x1f, 0x62, 0xb3, 0xaa, 0x80, 0xcd, 0x38, 0xd2, 0xf6, 0x28,
+0xa6, 0xe4, 0xbd, 0x52, 0x24, 0xa9, 0x93, 0x5d, 0x1f, 0xe6, 0x09, 0xdd, 0x21, 0x01, 0xcf, 0x95,
+0x3d, 0xdd, 0x98, 0xea, 0xdb, 0x1e, 0xfc, 0x29, 0x75, 0x7d, 0x24, 0x64, 0x54, 0x12, 0xee, 0x95,
+0x2d, 0x1c, 0xe0, 0x2b, 0xda, 0x82, 0x7e, 0xe9, 0xf5, 0x76, 0x24, 0xd2, 0xe4, 0x09, 0x00, 0xb7,
+0x1b, 0xba, 0x87, 0xaf, 0x43, 0x92, 0x1a, 0xb3, 0x7d, 0x32, 0x7c, 0xb2, 0xf3, 0xee, 0x77, 0xc9,
+0xfe, 0x0c, 0x8c, 0x3f, 0x6d, 0x85, 0x36, 0xc1, 0xbc, 0xb9, 0x16, 0x4c, 0x1d, 0x21, 0x07, 0xe4,
+0x4c, 0x18, 0xa9, 0x10, 0x51, 0x3d, 0x1c, 0x30, 0xd3, 0xcb, 0x0f, 0xcd, 0xb1, 0xbf, 0x73, 0x2c,
+0x51, 0x11, 0x4f, 0xc6, 0x01, 0xfe, 0x26, 0xff, 0xa2, 0x93, 0x2e, 0xdc, 0xde, 0xf3, 0x86, 0x5e,
+0x36, 0xd0, 0x5f, 0xf7, 0x89, 0x71, 0x96, 0x08, 0x37, 0x55, 0xd6, 0xe3, 0xf6, 0xa3, 0x84, 0x0f,
+0xea, 0xf6, 0x4d, 0xae, 0x00, 0x86, 0x1a, 0xf7, 0xe6, 0xf5, 0xf6, 0x71, 0xd8, 0x49, 0xc7, 0xa1,
+0xd2, 0x75, 0xc4, 0x44, 0x25, 0xf0, 0xc3, 0xcc, 0x18, 0x7f, 0x36, 0x4a, 0x9f, 0x83, 0xc1, 0xae,
+0xbe, 0x22, 0xed, 0x67, 0xa4, 0x2e, 0xfb, 0x4c, 0xbc, 0x66, 0xd5, 0x36, 0x03, 0xc9, 0xd1, 0xa9,
+0x6c, 0xfa, 0xe1, 0x82, 0x3e, 0xee, 0xbb, 0x2b, 0x1c, 0x9f, 0x98, 0x1b, 0xdc, 0xdf, 0x42, 0x4c,
+0x1b, 0xd8, 0x61, 0xce, 0x45, 0x95, 0x34, 0xa0, 0xe4, 0x8a, 0x01, 0xe4, 0x85, 0x99, 0x29, 0xee,
+0xab, 0x37, 0xaf, 0xe4, 0x23, 0x64, 0x70, 0xb8, 0xaf, 0x02, 0x1c, 0xde, 0xed, 0xc1, 0x3d, 0xc6,
+0x3a, 0xd8, 0xfc, 0xe2, 0x02, 0xc0, 0xde, 0x6c, 0xe7, 0xed, 0x6e, 0x2c, 0x6b, 0x55, 0x24, 0xd1,
+0x71, 0x5b, 0x7b, 0x37, 0x2d, 0xc4, 0x11, 0x38, 0x57, 0xad, 0x97, 0xb1, 0x08, 0x19, 0x27, 0x51,
+0xef, 0x54, 0x2b, 0x7b, 0x9b, 0x8e, 0xa4, 0xaa, 0x7d, 0xf2, 0xaa, 0x41, 0x2a, 0xaa, 0xae, 0xec,
+0x14, 0x58, 0x5d, 0x69, 0x77, 0x55, 0x95, 0xf2, 0x3c, 0xbf, 0x06, 0xbc, 0xf9, 0xce, 0x62, 0xaf,
+0x3d, 0xad, 0xd2, 0x4d, 0x13, 0xd9, 0x24, 0x29, 0x98, 0x25, 0xf6, 0xa5, 0xfa, 0x1d, 0x74, 0xa9,
+0xd7, 0xb3, 0x67, 0x03, 0x44, 0xb7, 0x1d, 0xc5, 0x4c, 0x0f, 0x7a, 0x14, 0xda, 0x09, 0x55, 0x00,
+0xd6, 0xc7, 0x62, 0x13, 0x41, 0x0c, 0x87, 0x7b, 0xad, 0x05, 0x35, 0x36, 0x9b, 0x7e, 0x2e, 0xab,
+0x51, 0xb6, 0xb6, 0x25, 0xe2, 0x02, 0xfb, 0x27, 0xbf, 0x4a, 0xd0, 0xcd, 0x15, 0x6c, 0x22, 0xfb,
+0x0a, 0x97, 0x39, 0xc6, 0xab, 0xe2, 0x9d, 0xcf, 0x25, 0xbc, 0x56, 0x56, 0xaf, 0x14, 0x9c, 0x88,
+0xc3, 0xd9, 0xb5, 0xe6, 0x07, 0x3b, 0x0b, 0x98, 0xff, 0x72, 0x2d, 0x4d, 0x95, 0x87, 0xb7, 0x92,
+0x59, 0x40, 0x1d, 0x59, 0x3a, 0x53, 0xb7, 0xf6, 0xe8, 0xf1, 0x39, 0x5a, 0xee, 0x23, 0x8f, 0x80,
+0xe2, 0xb3, 0x9b, 0xa8, 0x8a, 0x59, 0x51, 0x64, 0x19, 0x35, 0x26, 0x2e, 0xf7, 0xcc, 0x49, 0x80,
+0xaf, 0x7c, 0xb1, 0x2d, 0x2d, 0x53, 0x77, 0x11, 0xcd, 0xcd, 0xd0, 0xda, 0x60, 0x41, 0x22, 0x14,
+0x9a, 0x2d, 0x51, 0xfd, 0xea, 0xf2, 0x60, 0x39, 0x4f, 0x67, 0x01, 0xb6, 0x83, 0x8b, 0xd8, 0x99,
+0xd9, 0xaa, 0x66, 0xc8, 0x8f, 0xa8, 0xc5, 0x77, 0x18, 0x25, 0x1a, 0x97, 0x42, 0xed, 0xf0, 0xe3,
+0xd1, 0x3f, 0x9e, 0x93, 0x44, 0xcb, 0x49, 0x74, 0x91, 0xc0, 0x6a, 0x84, 0xfc, 0xe2, 0x30, 0x43,
+0x49, 0x9f, 0x5d, 0x01, 0xc9, 0xb6, 0xcf, 0x1a, 0x9b, 0x8a, 0x57, 0xef, 0x07, 0x27, 0x7a, 0xe1,
+0xca, 0x90, 0xa1, 0x08, 0xce, 0x1c, 0xfe, 0xac, 0x66, 0x62, 0x3a, 0x9f, 0xfc, 0x05, 0xd9, 0x54,
+0x07, 0xf7, 0x56, 0x6f, 0x56, 0x92, 0x34, 0x60, 0x4f, 0x98, 0xfb, 0x91, 0xfa, 0x0c, 0x26, 0x46,
+0xa6, 0xe2, 0xb9, 0xea, 0xaa, 0x2c, 0xfc, 0x2d, 0x41, 0x21, 0x72, 0xe0, 0x3c, 0xd2, 0x55, 0x42,
+0xcd, 0x27, 0x4a, 0x00, 0x82, 0x32, 0xb2, 0x14, 0x7b, 0x5d, 0x4d, 0xa8, 0xa2, 0xe1, 0x14, 0xf0,
+0x94, 0x37, 0x8b, 0x8c, 0x25, 0xb3, 0xe3, 0xdd, 0xe4, 0x81, 0x77, 0xc5, 0x77, 0x9c, 0x74, 0x2e,
+0x0d, 0x44, 0xfe, 0xd6, 0x9c, 0x0a, 0x22, 0x3e, 0x90, 0xd1, 0x5d, 0xa0, 0xb5, 0x02, 0x5c, 0x27,
+0x4b, 0xfb, 0xc6, 0x94, 0xa0, 0xd5, 0xcb, 0x19, 0xaa, 0x30, 0x12, 0xd7, 0x47, 0x29, 0x4e, 0x3c,
+0x60, 0x51, 0x41, 0x02, 0xce, 0x84, 0x83, 0x36, 0x1d, 0xd2, 0x5b, 0x41, 0x90, 0x9c, 0xb7, 0x06,
+0xbf, 0xd9, 0x8c, 0xb8, 0xfe, 0x87, 0x0a, 0x10, 0x20, 0x7a, 0xef, 0x19, 0x0b, 0x63, 0x49, 0x1f,
+0xea, 0xc2, 0x3d, 0x74, 0x49, 0x84, 0x9e, 0xce, 0x8a, 0xb2, 0x9e, 0x16, 0x4a, 0x55, 0x68, 0x84,
+0x64, 0x7f, 0x30, 0xa7, 0x99, 0x3d, 0x6f, 0xd4, 0x74, 0x13, 0x5b, 0xde, 0x1e, 0x5d, 0xec, 0x10,
+0xd6, 0xdd, 0xd8, 0xc1, 0x6d, 0xa2, 0xc1, 0x23, 0x60, 0x6c, 0xa5, 0x3e, 0x61, 0xfb, 0x62, 0xe1,
+0x14, 0xb2, 0x46, 0xc7, 0x47, 0xac, 0x05, 0x3d, 0x76, 0x63, 0x91, 0xda, 0x2c, 0x4a, 0x91, 0x4a,
+0x70, 0xab, 0x53, 0xe4, 0xe2, 0x67, 0x86, 0x56, 0x27, 0x28, 0xfc, 0xa9, 0x32, 0xd8, 0xf1, 0xa6,
+0x8b, 0x80, 0x9d, 0x6c, 0xca, 0xb8, 0x10, 0x10, 0xfb, 0x4c, 0x1e, 0xe5, 0xb7, 0x8e, 0xf1, 0x33,
+0x86, 0x8d, 0x32, 0x60, 0xf7, 0x03, 0xdc, 0x11, 0x7b, 0xd7, 0x92, 0x2a, 0x81, 0x8c, 0x2d, 0xa8,
+0x63, 0x89, 0x69, 0x3c, 0x33, 0x2f, 0x09, 0x1e, 0x51, 0x7b, 0x80, 0x95, 0xe4, 0x00, 0x31, 0x9e,
+0xe8, 0xa4, 0xaf, 0x69, 0xb5, 0xce, 0xde, 0xb6, 0x16, 0x5a, 0x9d, 0xf9, 0xfa, 0x78, 0x27, 0x1c,
+0xb5, 0xbb, 0x30, 0xa7, 0xe4, 0x08, 0xe7, 0xe3, 0x8a, 0x6b, 0xfc, 0xf3, 0x3f, 0x19, 0x83, 0x7d,
+0x15, 0xdd, 0xe5, 0x10, 0xca, 0xe7, 0xf8, 0x75, 0x55, 0x2c, 0x19, 0x24, 0xd6, 0xe3, 0xee, 0xc2,
+0x23, 0x58, 0x9d, 0xee, 0x98, 0x20, 0xf7, 0x60, 0x08, 0xf6, 0xfd, 0x0e, 0xaf, 0xff, 0xcd, 0xed,
+0xab, 0x6b, 0x76, 0x2e, 0xc9, 0xfa, 0x84, 0xd6, 0x41, 0x55, 0xac, 0x96, 0xc2, 0xdd, 0x43, 0x88,
+0xda, 0xf9, 0xf5, 0x40, 0x31, 0xad, 0xd7, 0xe5, 0xb1, 0xba, 0xb1, 0xa9, 0xa7, 0xf9, 0x0e, 0x61,
+0xd8, 0xe4, 0x24, 0x71, 0x5a, 0xf6, 0x62, 0xe6, 0x1b, 0xdd, 0xcb, 0x98, 0xff, 0xd9, 0x29, 0x61,
+0xfc, 0xe1, 0xb4, 0x66, 0x7d, 0xec, 0x1a, 0x7f, 0xa0, 0xdf, 0x1f, 0xec, 0xdd, 0xfa, 0xb4, 0xa8,
+0x06, 0x12, 0x59, 0x1f, 0xa6, 0x17, 0x3e, 0xfb, 0xc3, 0x20, 0xfe, 0x88, 0x00, 0xe0, 0xe8, 0x53,
+0x02, 0xd3, 0x25, 0x63, 0x5a, 0xe4, 0x7d, 0xb5, 0xd3, 0x80, 0xba, 0xb1, 0x4b, 0x27, 0xb3, 0xb8,
+0xed, 0x42, 0x3f, 0x1e, 0x81, 0xea, 0x86, 0xeb, 0xa7, 0x42, 0x26, 0x14, 0x86, 0x2f, 0x1e, 0xdb,
+0x8a, 0xee, 0x85, 0x87, 0xdf, 0x0b, 0x4f, 0x47, 0xdb, 0xc5, 0x8f, 0xae, 0xf3, 0x4f, 0x14, 0x9f,
+0xe7, 0x52, 0x8a, 0xbd, 0x5f, 0x35, 0x3e, 0x7f, 0xcd, 0x84, 0x6d, 0x3e, 0xbd, 0xff, 0x91, 0xf8,
+0xaa, 0x55, 0x03, 0xb9, 0xe5, 0x92, 0x19, 0x64, 0x43, 0x64, 0x7c, 0x83, 0x35, 0xdd, 0xd0, 0x09,
+0x94, 0xb5, 0x6c, 0x9f, 0x9c, 0x2d, 0xed, 0xe1, 0x35, 0x17, 0x00, 0x4b, 0x50, 0xe3, 0x9e, 0xf2,
+0xc7, 0x51, 0xbf, 0x9c, 0xbd, 0xe1, 0x1a, 0xeb, 0x9e, 0xf5, 0xad, 0xaf, 0x86, 0xeb, 0xa0, 0x5d,
+0xf0, 0x0b, 0x28, 0x27, 0x28, 0xa2, 0x08, 0x5f, 0x24, 0xdb, 0x9b, 0x76, 0x9a, 0x31, 0x97, 0xb5,
+0xf3, 0xd4, 0xf1, 0xe6, 0xf5, 0x58, 0x44, 0xe9, 0x1e, 0xd2, 0xcc, 0x6c, 0x4a, 0xda, 0xdd, 0x63,
+0x46, 0x34, 0xf7, 0x9d, 0xe0, 0xcc, 0xf6, 0x7d, 0xee, 0x31, 0x79, 0x0a, 0x94, 0xeb, 0x71, 0xfc,
+0x54, 0x42, 0x68, 0x3a, 0x71, 0x82, 0x59, 0x8c, 0xb6, 0xb0, 0x06, 0x24, 0xc2, 0x9d, 0x37, 0x4c,
+0x84, 0xe5, 0xc4, 0x1b, 0x13, 0x98, 0x84, 0x7a, 0x17, 0x94, 0x80, 0x24, 0xba, 0x53, 0x6e, 0xd7,
+0x6f, 0xad, 0x3e, 0x59, 0xa0, 0xd7, 0x8d, 0xc9, 0xb7, 0x8a, 0x57, 0x87, 0x3c, 0x67, 0x73, 0xae,
+0xd1, 0x47, 0x88, 0xbd, 0xc5, 0x2f, 0xfc, 0xbd, 0x63, 0x1e, 0x97, 0x47, 0xd2, 0x12, 0x86, 0x2a,
+0xe7, 0xee, 0x5f, 0xaa, 0x07, 0x18, 0xd6, 0x08, 0x35, 0x07, 0xff, 0x69, 0x2b, 0xfc, 0x29, 0xb6,
+0xad, 0x77, 0xf1, 0xef, 0x7a, 0xb7, 0xee, 0x42, 0x8c, 0x00, 0xc7, 0xf4, 0x79, 0x32, 0xcf, 0x60,
+0x16, 0xb2, 0xd5, 0x7f, 0x1e, 0xf1, 0x0c, 0x48, 0xc9, 0xe0, 0x2f, 0xd6, 0xb3, 0xd9, 0x62, 0x27,
+0xdd, 0xbe, 0x68, 0x53, 0x47, 0x8f, 0x03, 0x1b, 0x9d, 0xf0, 0x1f, 0xe9, 0x1d, 0x93, 0x26, 0x61,
+0xc7, 0x6d, 0x49, 0x9d, 0x07, 0x6d, 0x82, 0x1a, 0x38, 0x3e, 0x4f, 0xff, 0xa2, 0xcd, 0x41, 0x83,
+0x50, 0xaa, 0x60, 0xc0, 0xa9, 0xc5, 0x2a, 0xc2, 0xa9, 0x7e, 0x19, 0x60, 0x0c, 0xeb, 0x2c, 0x0a,
+0xcd, 0x27, 0xeb, 0x43, 0x0b, 0xaf, 0x4a, 0x57, 0x31, 0x2d, 0xa0, 0x2f, 0x0c, 0x2e, 0x8e, 0xd9,
+0x1d, 0x41, 0xaa, 0x1f, 0xf8, 0xb6, 0xb7, 0x7a, 0x41, 0xcb, 0x33, 0x48, 0x5c, 0xc2, 0x3c, 0xf5,
+0x2b, 0xcc, 0x78, 0xc9, 0xcb, 0x78, 0x24, 0x47, 0x2b, 0x5a, 0xd7, 0xf7, 0xb6, 0xc0, 0xf4, 0x95,
+0xad, 0x14, 0xa2, 0x0a, 0x67, 0xb8, 0xf6, 0x52, 0x0a, 0x2b, 0x9d, 0xd9, 0x1d, 0x5b, 0x1b, 0x1f,
+0xd7, 0x79, 0x07, 0x7c, 0xa5, 0xa5, 0xae, 0x1e, 0x30, 0xb8, 0xb5, 0x57, 0xca, 0x04, 0x9a, 0x89,
+0xcd, 0xc3, 0xd4, 0xd7, 0x05, 0x59, 0x26, 0xf3, 0x2a, 0x33, 0xb2, 0x02, 0x79, 0x66, 0xb0, 0x50,
+0xf3, 0x7b, 0x8c, 0x76, 0x7d, 0x16, 0xea, 0xb9, 0x76, 0xf1, 0x4d, 0xba, 0x3c, 0x5e, 0x87, 0xae,
+0xb5, 0x53, 0xd8, 0x3e, 0xfd, 0x5f, 0xf2, 0x0a, 0xd4, 0x89, 0xfd, 0x27, 0xf2, 0x91, 0x67, 0x33,
+0xd5, 0xda, 0x04, 0x0a, 0x34, 0x24, 0x03, 0x5c, 0xd1, 0x09, 0x19, 0x98, 0x07, 0x78, 0xd3, 0xea,
+0x61, 0x25, 0xeb, 0x2c, 0x65, 0xaa, 0x5a, 0xfb, 0xdd, 0x27, 0xa0, 0x86, 0xc8, 0xf6, 0x90, 0x8f,
+0x5a, 0x16, 0x7e, 0xb8, 0xdd, 0x6f, 0xdd, 0x94, 0x7a, 0xe7, 0xbf, 0x2c, 0xa4, 0xab, 0x0b, 0x41,
+0x68, 0xed, 0x66, 0x1a, 0xe3, 0x00, 0xef, 0x53, 0x89, 0xbf, 0xa8, 0xc9, 0x86, 0xfa, 0x1d, 0x9d,
+0x20, 0x5e, 0x79, 0x72, 0x35, 0x43, 0x4e, 0x89, 0xc2, 0x02, 0xc2, 0x29, 0x37, 0x40, 0x1e, 0x75,
+0xfb, 0x0b, 0xea, 0x24, 0x29, 0x99, 0x0c, 0x64, 0xa0, 0x36, 0x2e, 0x00, 0xe9, 0x82, 0x2d, 0x91,
+0xfc, 0x43, 0x59, 0xb9, 0x3a, 0xd4, 0x9f, 0x90, 0xae, 0x80, 0xad, 0x73, 0x2d, 0xf9, 0x7a, 0xea,
+0xbc, 0x3e, 0x9b, 0x3d, 0xf7, 0x16, 0xc1, 0x05, 0xc6, 0xa2, 0xd9, 0x0b, 0xc1, 0x34, 0x1e, 0xa7,
+0xb3, 0xda, 0xf4, 0x1b, 0x72, 0xa5, 0x07, 0xcd, 0x1b, 0xae, 0x46, 0xa9, 0x89, 0x72, 0xae, 0x9a,
+0xbe, 0x57, 0xb9, 0xf8, 0xcc, 0xd7, 0xe5, 0x7c, 0x01, 0x3f, 0x9b, 0x13, 0x87, 0x72, 0x56, 0xa0,
+0x6f, 0x05, 0x65, 0xe0, 0x00, 0x10, 0x3e, 0x8e, 0x0e, 0x73, 0xae, 0xc9, 0x6e, 0x83, 0x50, 0x35,
+0xda, 0xc2, 0xab, 0x98, 0xda, 0x5e, 0x30, 0xae, 0xf5, 0xd5, 0xd1, 0x8e, 0x6a, 0xe0, 0xfb, 0xa2,
+0xdf, 0xfc, 0x85, 0xb6, 0x2c, 0x33, 0x16, 0x3f, 0x8f, 0xc4, 0x61, 0x6d, 0xbd, 0x70, 0x07, 0x09,
+0xfe, 0x80, 0x08, 0x72, 0x47, 0xc8, 0x10, 0x1a, 0xcc, 0x85, 0x8c, 0x7e, 0xc9, 0x08, 0x5a, 0x02,
+0xd8, 0x8b, 0x82, 0x03, 0x40, 0x6a, 0x00, 0x4e, 0x43, 0x25, 0x8a, 0xdd, 0x67, 0x98, 0x3d, 0x6b,
+0xd6, 0x5b, 0x37, 0x96, 0x12, 0x5c, 0x2e, 0x32, 0xad, 0x52, 0x37, 0xc6, 0xbf, 0x8e, 0x02, 0x37,
+0xd4, 0xfd, 0x70, 0xa1, 0xe9, 0x4e, 0x90, 0xee, 0x70, 0xe7, 0x48, 0x69, 0x7e, 0x68, 0xef, 0x69,
+0x27, 0xa9, 0xc1, 0xc6, 0x40, 0xce, 0x2d, 0xef, 0xef, 0x69, 0xb9, 0x77, 0xb7, 0x80, 0xdb, 0x47,
+0x95, 0x2c, 0xd1, 0xa2, 0x1a, 0x82, 0x00, 0x51, 0x95, 0x9b, 0x85, 0x31, 0x3d, 0xe7, 0xeb, 0xfb,
+0xe8, 0xf1, 0x1d, 0x4c, 0x7f, 0x4b, 0xf7, 0x76, 0x21, 0x5a, 0xf8, 0x70, 0x6d, 0xae, 0x9d, 0xed,
+0x9e, 0x27, 0xc7, 0xb2, 0x30, 0xcf, 0x46, 0x8a, 0xff, 0x82, 0x71, 0x59, 0x84, 0xb5, 0x5d, 0x26,
+0xeb, 0xd8, 0xb7, 0xa3, 0xc8, 0xca, 0xe7, 0x6f, 0x79, 0x41, 0xa4, 0xbc, 0x97, 0x47, 0xdb, 0x45,
+0x79, 0xcd, 0xcc, 0x54, 0x15, 0x65, 0xe5, 0xc2, 0x74, 0xfd, 0x29, 0x02, 0x4a, 0xce, 0xf7, 0x35,
+0xd3, 0x83, 0x83, 0x2a, 0x37, 0x58, 0x5e, 0xb8, 0x99, 0x5a, 0x28, 0xa9, 0x8a, 0xbe, 0xf3, 0x14,
+0x19, 0x78, 0x7d, 0x68, 0x61, 0xdd, 0x30, 0x88, 0xda, 0x3e, 0xf0, 0xb2, 0xa4, 0xa1, 0x07, 0x76,
+0x0b, 0x63, 0xae, 0xf7, 0x10, 0x7c, 0x06, 0xcc, 0xb9, 0xbf, 0x4c, 0x24, 0x13, 0xd3, 0xd3, 0x03,
+0xaa, 0xf6, 0xd1, 0x47, 0x70, 0xde, 0x56, 0xd2, 0x80, 0xc5, 0xb6, 0x67, 0xe8, 0xf5, 0xaa, 0x4b,
+0x76, 0x70, 0x5d, 0xcd, 0x8a, 0x2d, 0x82, 0x2a, 0xed, 0xcf, 0x84, 0x89, 0x29, 0x52, 0x7e, 0x6a,
+0x6e, 0xe5, 0x5e, 0xa6, 0x3e, 0xff, 0x02, 0x0e, 0xd8, 0x00, 0xb0, 0xc5, 0x8a, 0xbf, 0x6a, 0x5d,
+0x61, 0x31, 0x8e, 0xbf, 0x1f, 0x4d, 0xa2, 0x15, 0xa0, 0xbe, 0xb3, 0x7c, 0x07, 0xe1, 0xd4, 0xfb,
+0x73, 0xa4, 0xdb, 0x45, 0xcc, 0xa6, 0x3c, 0xfc, 0x90, 0x09, 0x70, 0x03, 0x57, 0x24, 0xe4, 0xf1,
+0xf8, 0x48, 0xb1, 0xa6, 0x36, 0xe7, 0x5c, 0x17, 0xe2, 0xc7, 0x27, 0x47, 0x04, 0x75, 0x13, 0xb7,
+0x4e, 0x5d, 0xe7, 0x44, 0x73, 0x4a, 0xe3, 0x8a, 0xa3, 0xf2, 0x46, 0xda, 0x51, 0x41, 0x7f, 0x8b,
+0x06, 0x71, 0x84, 0xe9, 0xcb, 0x92, 0xcb, 0x07, 0xb6, 0x06, 0x22, 0x75, 0x02, 0x92, 0x05, 0x97,
+0x8a, 0x75, 0x2c, 0x36, 0x1d, 0x63, 0xb6, 0xe4, 0xee, 0x7d, 0xaa, 0xd0, 0xba, 0x68, 0xaf, 0xb6,
+0x69, 0x70, 0xc9, 0x1c, 0xef, 0x7c, 0x4e, 0x11, 0x16, 0x6e, 0x55, 0x1e, 0x72, 0x90, 0x10, 0xa5,
+0x1b, 0x40, 0x7d, 0x5c, 0x72, 0x99, 0x7a, 0x66, 0xb5, 0xb0, 0x63, 0x27, 0x23, 0xdc, 0x9f, 0xe6,
+0x40, 0xcb, 0xbe, 0xdf, 0xdb, 0x9c, 0x76, 0xd4, 0x35, 0x77, 0x06, 0x8e, 0x5a, 0x44, 0x6c, 0x1d,
+0xf8, 0x52, 0x5c, 0xea, 0x27, 0x67, 0xa1, 0x8c, 0xf8, 0xa8, 0x7e, 0x4a, 0xcf, 0x07, 0x0f, 0xe5,
+0x1b, 0x55, 0x9c, 0xc5, 0x30, 0xad, 0xd5, 0xb2, 0xf0, 0x9b, 0xaf, 0xa5, 0x61, 0x2a, 0xc1, 0xfe,
+0x8d, 0x40, 0xbd, 0x9c, 0x95, 0xcb, 0x46, 0xdc, 0x14, 0x23, 0x7b, 0xac, 0x68, 0x21, 0x6b, 0xc6,
+0xd8, 0xb5, 0xdb, 0xc8, 0xc0, 0x5f, 0x08, 0x2c, 0x35, 0x49, 0x8d, 0x8b, 0xd0, 0xb8, 0xd8, 0xad,
+0xfa, 0xd6, 0x85, 0xa3, 0x09, 0x92, 0x24, 0x9d, 0x83, 0x3a, 0x39, 0x4e, 0x6d, 0x25, 0x01, 0x13,
+0x44, 0x15, 0x5f, 0x0c, 0x28, 0xc6, 0x2c, 0x15, 0xa8, 0xbe, 0x23, 0xac, 0x3c, 0xcb, 0x82, 0x47,
+0x9f, 0xbb, 0x55, 0xf5, 0x96, 0x19, 0xc1, 0x97, 0x05, 0x06, 0xc3, 0xa0, 0xd8, 0x12, 0xec, 0x83,
+0xb6, 0xfe, 0xba, 0xc9, 0x32, 0xd0, 0xd1, 0x22, 0xc5, 0xa3, 0x64, 0xa1, 0x88, 0x9e, 0x30, 0xf5,
+0xe3, 0xef, 0x41, 0xc0, 0x0a, 0x65, 0x22, 0xd7, 0xf2, 0xad, 0xf5, 0x8c, 0x9a, 0x3d, 0xa1, 0xd0,
+0x33, 0x68, 0x4c, 0x69, 0xe2, 0xaa, 0xf9, 0xeb, 0x21, 0x25, 0x30, 0x16, 0x24, 0x7b, 0x6e, 0x97,
+0x55, 0x02, 0x2a, 0xe7, 0x8f, 0xb0, 0xb0, 0x0e, 0x87, 0x08, 0x21, 0xfa, 0x6e, 0x1c, 0xba, 0xd5,
+0x9a, 0x71, 0x17, 0x07, 0x07, 0xe2, 0x0b, 0x78, 0xb1, 0x25, 0x20, 0x7d, 0x5e, 0x9e, 0x07, 0xdc,
+0x8d, 0xba, 0x85, 0xf4, 0x9e, 0x85, 0xa7, 0xbb, 0xda, 0x70, 0x68, 0x54, 0xaa, 0x5d, 0x25, 0xb4,
+0xf7, 0x69, 0xeb, 0xa0, 0xa5, 0xca, 0x2c, 0x6f, 0x13, 0x2f, 0x2f, 0x04, 0x74, 0x79, 0x49, 0x7f,
+0x15, 0x9f, 0xcd, 0xcd, 0x7a, 0x15, 0x53, 0x62, 0x44, 0xe4, 0x05, 0x30, 0xf5, 0x14, 0xc9, 0x0f,
+0xbf, 0x92, 0x22, 0xc3, 0xfe, 0xd7, 0xe3, 0xf2, 0x49, 0x98, 0x87, 0x79, 0x36, 0x88, 0x1a, 0xda,
+0x22, 0xec, 0xad, 0xa6, 0x55, 0xa8, 0xe8, 0xf8, 0x3c, 0x15, 0xf2, 0x41, 0x9b, 0x93, 0x12, 0xcd,
+0xfb, 0x86, 0x43, 0xfd, 0xf7, 0x7b, 0xd7, 0xeb, 0x47, 0x1f, 0x79, 0xea, 0xb6, 0x61, 0x77, 0xd5,
+0x41, 0x32, 0x4f, 0xeb, 0xc1, 0x97, 0xfb, 0x3d, 0xfa, 0x88, 0x61, 0x60, 0x31, 0x65, 0xe3, 0xf5,
+0xa7, 0x8a, 0xc7, 0x78, 0x63, 0x6c, 0x00, 0xde, 0xb0, 0x53, 0x24, 0x6d, 0xba, 0xbc, 0x95, 0xa1,
+0x9f, 0x5a, 0x3f, 0xf6, 0x08, 0x57, 0x14, 0x22, 0x4a, 0x71, 0x20, 0xd7, 0x04, 0x32, 0xd6, 0xd7,
+0xcd, 0x0c, 0xd4, 0x4a, 0xf9, 0xcf, 0x44, 0x0f, 0xa4, 0xba, 0x92, 0x38, 0xd2, 0x66, 0x36, 0xb0,
+0xf8, 0x32, 0x04, 0x39, 0xcb, 0x12, 0xa2, 0x1b, 0x90, 0xa7, 0x9d, 0x00, 0x10, 0xe0, 0x42, 0x66,
+0x28, 0x01, 0x56, 0x6b, 0x59, 0x0b, 0x2b, 0xf3, 0x2f, 0x42, 0x77, 0x37, 0x27, 0xe9, 0xec, 0x10,
+0xba, 0x44, 0x6a, 0xd3, 0x63, 0xe6, 0x2e, 0x95, 0x6f, 0x37, 0x41, 0x7c, 0x72, 0x7d, 0x15, 0xf3,
+0xbd, 0x84, 0x44, 0xb3, 0x28, 0x1a, 0x76, 0x40, 0x80, 0x1d, 0x38, 0x2f, 0x83, 0xf5, 0x17, 0xde,
+0xb5, 0x9d, 0x7d, 0x21, 0xe3, 0xc1, 0xa0, 0x52, 0x6f, 0xd0, 0x2b, 0x2c, 0x4d, 0xc1, 0x29, 0xe4,
+0x23, 0xa7, 0x39, 0x30, 0x98, 0x75, 0x0a, 0xca, 0x38, 0xda, 0x18, 0x10, 0x9b, 0x86, 0xac, 0xf0,
+0x26, 0x88, 0xa8, 0x47, 0xd1, 0x87, 0x7d, 0xe0, 0x09, 0xaf, 0xb0, 0x86, 0x33, 0x31, 0xee, 0x9f,
+0x22, 0x44, 0x59, 0x94, 0x15, 0x8b, 0x08, 0x5a, 0x9d, 0xd4, 0x6f, 0xcf, 0x87, 0x44, 0x34, 0x54,
+0xd9, 0xe6, 0xeb, 0x65, 0xca, 0x4f, 0xc8, 0x0a, 0xd5, 0xdc, 0x8d, 0x8d, 0x97, 0xb8, 0xc9, 0x41,
+0xbf, 0x3d, 0x7a, 0x43, 0x2d, 0x1c, 0x1a, 0x41, 0x30, 0xc0, 0x00, 0x00, 0xb0, 0x53, 0x6a, 0x1e,
+0x00, 0x01, 0xb3, 0x15, 0x80, 0x80, 0x01, 0x00, 0x0e, 0x31, 0x7c, 0xe2, 0x3e, 0x30, 0x0d, 0x8b,
+0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x59, 0x5a,
+};
+
+static unsigned char zstd_data[] =
+{
+0x28, 0xb5, 0x2f, 0xfd, 0x64, 0x00, 0x3f, 0x95, 0x52, 0x00, 0x16, 0x53, 0x34, 0x1b, 0x50, 0x75,
+0x3a, 0xc4, 0x4c, 0xd3, 0x66, 0xb9, 0x01, 0x66, 0xd8, 0x58, 0x83, 0xb6, 0xc8, 0x1d, 0x1e, 0xbf,
+0x85, 0xa8, 0xb2, 0x9a, 0xcc, 0x84, 0x10, 0x9e, 0x1a, 0x37, 0x00, 0x36, 0x00, 0x22, 0x00, 0xab,
+0xee, 0xb5, 0x2d, 0xa8, 0xba, 0xf4, 0xb0, 0x0c, 0x03, 0x08, 0xc1, 0x41, 0x74, 0x42, 0x39, 0x95,
+0x89, 0xba, 0x4a, 0xac, 0x0f, 0x6b, 0x10, 0x1f, 0xc9, 0x42, 0x45, 0x50, 0x01, 0x99, 0x2a, 0x82,
+0x18, 0x6d, 0x92, 0xc4, 0x12, 0x6d, 0x51, 0x81, 0x40, 0xa7, 0xb5, 0x28, 0x89, 0xc7, 0x91, 0x2a,
+0x1a, 0x67, 0xca, 0x44, 0x24, 0x01, 0xd0, 0xe3, 0x48, 0x0c, 0x80, 0xff, 0x40, 0x55, 0x15, 0xa0,
+0x22, 0xa7, 0x61, 0x2d, 0x5a, 0x55, 0xb4, 0x2c, 0x75, 0x59, 0x4e, 0x20, 0xcc, 0x59, 0x54, 0x0b,
+0x2d, 0xb3, 0xba, 0xb1, 0x60, 0x04, 0x4d, 0x92, 0x1e, 0x82, 0x56, 0xda, 0x24, 0x71, 0x34, 0xe6,
+0x4c, 0x6f, 0x42, 0xb1, 0x68, 0x34, 0x12, 0xb5, 0x2b, 0x4d, 0x20, 0x01, 0x3f, 0x7f, 0x67, 0xfb,
+0x5c, 0xde, 0xf7, 0x23, 0x63, 0xfb, 0xbd, 0xac, 0xeb, 0xdf, 0x6d, 0x92, 0x2f, 0xe9, 0x76, 0xaa,
+0xec, 0x95, 0x67, 0xec, 0x7b, 0x77, 0xfe, 0x99, 0xc4, 0x98, 0xcf, 0xbf, 0x25, 0x51, 0xd4, 0xef,
+0xce, 0x36, 0xf5, 0xd3, 0xe5, 0x7f, 0xf6, 0x51, 0xf7, 0xd1, 0x3f, 0x9b, 0xcf, 0x26, 0x7f, 0xbc,
+0xf3, 0x24, 0xcf, 0xff, 0x6e, 0x9b, 0x37, 0x19, 0x8f, 0xec, 0x8e, 0xa4, 0xc9, 0x1a, 0x84, 0x82,
+0xa8, 0xd3, 0xbd, 0x49, 0x41, 0x41, 0x52, 0xc9, 0x3e, 0x07, 0x23, 0x20, 0x20, 0x70, 0x90, 0xe0,
+0xa8, 0x6c, 0x3c, 0x9d, 0x95, 0x4c, 0x3f, 0x23, 0x70, 0x20, 0x88, 0x10, 0x7c, 0x04, 0x70, 0x05,
+0xf0, 0x08, 0x0a, 0xa4, 0xc1, 0x72, 0x04, 0x43, 0xe0, 0x04, 0x17, 0x98, 0x82, 0xa4, 0x99, 0x03,
+0xff, 0x64, 0x75, 0xfa, 0xbb, 0x37, 0xa0, 0x64, 0xf1, 0x46, 0xa5, 0xed, 0xaa, 0xc5, 0x25, 0x4e,
+0x77, 0x11, 0x9c, 0x3f, 0xbf, 0x5a, 0xc7, 0x9b, 0x93, 0x7a, 0xb9, 0xf9, 0xe5, 0x3b, 0x8c, 0x22,
+0x60, 0x63, 0x56, 0x08, 0x0c, 0x4a, 0x9b, 0x6d, 0x3a, 0x09, 0x79, 0xb1, 0xe4, 0xd1, 0xbd, 0x32,
+0xf1, 0x28, 0xbf, 0x72, 0xee, 0x8d, 0xb4, 0xb6, 0xa6, 0x7e, 0x71, 0x45, 0x75, 0x6c, 0x8d, 0xdb,
+0xcf, 0x11, 0xfb, 0x15, 0x14, 0xe5, 0xec, 0x52, 0x78, 0x8e, 0x58, 0x65, 0x03, 0xf2, 0x53, 0x16,
+0xb9, 0x82, 0x59, 0x7b, 0x30, 0x55, 0x0a, 0x87, 0xb8, 0x6b, 0x0a, 0x36, 0x64, 0xfa, 0xb4, 0x80,
+0xe1, 0x04, 0x5a, 0xaf, 0x1f, 0x0d, 0x11, 0x24, 0x1d, 0x27, 0x2b, 0x3f, 0x23, 0x6b, 0xd0, 0x9f,
+0x48, 0x5b, 0x09, 0xbc, 0x6c, 0xbf, 0x66, 0xf5, 0xed, 0xab, 0x3e, 0x7c, 0x61, 0x9f, 0xf8, 0x90,
+0xbc, 0x01, 0x81, 0xdd, 0x83, 0xc9, 0x67, 0x26, 0x2e, 0x2f, 0xef, 0x28, 0xe6, 0x40, 0x15, 0x34,
+0xd2, 0xa3, 0x1f, 0x63, 0x92, 0x25, 0xb8, 0xef, 0xc9, 0xb2, 0x79, 0xb9, 0xb1, 0x84, 0x98, 0xc8,
+0x25, 0xcf, 0x71, 0xaf, 0x47, 0x08, 0x3a, 0x5f, 0x82, 0x99, 0x9c, 0xd3, 0xaa, 0x27, 0x53, 0x22,
+0xe4, 0xba, 0x42, 0x56, 0x50, 0xd7, 0xad, 0x5a, 0xdf, 0x3a, 0xab, 0x94, 0x6a, 0x11, 0xeb, 0x93,
+0x56, 0xea, 0x3b, 0xa7, 0x66, 0xeb, 0x5d, 0xd0, 0x5f, 0x5b, 0x9a, 0xe5, 0x43, 0x4a, 0xe5, 0x6b,
+0x2d, 0x6f, 0x60, 0x3f, 0xfe, 0xf5, 0x42, 0xfb, 0x25, 0xbc, 0x74, 0xcb, 0x0f, 0x4e, 0xf5, 0x36,
+0x85, 0x88, 0x9a, 0x61, 0x8a, 0x3e, 0x32, 0x7e, 0x2f, 0x93, 0x07, 0x69, 0x28, 0x85, 0x5c, 0xf2,
+0x9f, 0xf4, 0x7b, 0x3a, 0x7e, 0x0c, 0x79, 0x8c, 0x8f, 0x0c, 0x4a, 0x25, 0x63, 0x03, 0x24, 0x5c,
+0x08, 0xe8, 0xb8, 0x2f, 0x31, 0x76, 0x89, 0xe4, 0x54, 0xb8, 0xff, 0x04, 0x13, 0x41, 0x83, 0x67,
+0x5a, 0xc0, 0x67, 0x63, 0x76, 0x65, 0x73, 0x68, 0xa5, 0xa9, 0x2d, 0x8c, 0x86, 0x9e, 0xb2, 0x9f,
+0x37, 0x06, 0xd7, 0xf0, 0x32, 0xea, 0xc2, 0x8b, 0xc4, 0x9c, 0x15, 0xd4, 0x05, 0xc0, 0xa7, 0x08,
+0x25, 0x59, 0x97, 0xe6, 0xfd, 0xc4, 0x4f, 0xbc, 0x5d, 0x98, 0xf0, 0x14, 0x75, 0xf9, 0xce, 0x6b,
+0xbc, 0x37, 0x70, 0x1f, 0x75, 0x11, 0x83, 0xf7, 0x18, 0x15, 0x7a, 0x0a, 0x92, 0xcc, 0xc1, 0x28,
+0x49, 0x6f, 0xec, 0x70, 0x0b, 0xcb, 0xc8, 0xbd, 0x86, 0xba, 0xc8, 0x4a, 0x82, 0x86, 0xba, 0x02,
+0x49, 0x0c, 0xf8, 0x8d, 0x83, 0xf4, 0x5a, 0x41, 0x85, 0xb7, 0x59, 0xa5, 0x6a, 0x21, 0x38, 0x29,
+0x49, 0xe5, 0x8c, 0x39, 0x9b, 0xdb, 0xb5, 0x3e, 0x2d, 0x15, 0xb0, 0x8b, 0x8b, 0xc3, 0x88, 0x8e,
+0x07, 0x2a, 0x56, 0x94, 0x2f, 0x4f, 0x4f, 0xc0, 0x4f, 0xe9, 0x09, 0xa2, 0x76, 0x75, 0xd7, 0x54,
+0x1e, 0xe4, 0x9d, 0x04, 0x08, 0x98, 0x8c, 0x8e, 0x4f, 0x1c, 0x93, 0x0a, 0xa4, 0x6f, 0x10, 0x14,
+0xbe, 0xf6, 0xd4, 0x7b, 0x18, 0xb7, 0x64, 0xa8, 0x95, 0xbf, 0x9e, 0xf5, 0xfd, 0x33, 0xb7, 0x4c,
+0xbc, 0x1e, 0x66, 0x20, 0x5c, 0xa0, 0x1f, 0x30, 0x34, 0x67, 0x47, 0xcd, 0x93, 0x1f, 0x36, 0xa5,
+0x04, 0x2f, 0xff, 0x65, 0xf7, 0x52, 0xca, 0x9c, 0x02, 0xc3, 0x67, 0x5a, 0xd3, 0xf9, 0xad, 0x34,
+0x68, 0x71, 0xc0, 0x88, 0xa7, 0xc8, 0xe3, 0xb3, 0xcd, 0x99, 0x60, 0x39, 0x43, 0xc1, 0x3b, 0x2d,
+0xc5, 0x4d, 0x3c, 0x3d, 0x1d, 0x2d, 0x82, 0x7a, 0x16, 0x1c, 0xf9, 0x28, 0x50, 0xf9, 0x48, 0xb1,
+0x39, 0x5b, 0x72, 0xa0, 0x93, 0x42, 0x4b, 0x9d, 0x43, 0x4d, 0xd5, 0x2d, 0xa4, 0x5e, 0xd1, 0x48,
+0x08, 0xe1, 0x72, 0xd4, 0x56, 0x6e, 0x74, 0x8b, 0xcc, 0x57, 0x4a, 0x6d, 0x4c, 0x18, 0x77, 0x16,
+0x80, 0xb3, 0xb2, 0x30, 0x73, 0xa2, 0xe1, 0x67, 0x31, 0x25, 0x52, 0x79, 0x17, 0x84, 0x44, 0x39,
+0xb3, 0x8b, 0xbd, 0xe4, 0x4c, 0x48, 0x3b, 0x14, 0x87, 0x0c, 0x4b, 0x71, 0xa8, 0xd6, 0xe7, 0xa1,
+0xd2, 0x27, 0xae, 0x45, 0x88, 0xac, 0x21, 0xd6, 0x3b, 0xf9, 0x37, 0x2a, 0x87, 0xb6, 0x78, 0x00,
+0xf5, 0xca, 0x62, 0xc4, 0x6e, 0xfb, 0x36, 0x32, 0xb3, 0x03, 0xea, 0xf9, 0x3c, 0x7a, 0x58, 0xbc,
+0x4d, 0xd1, 0x08, 0xa2, 0xa9, 0xdc, 0x11, 0xed, 0xe4, 0xe9, 0x2b, 0x9b, 0x9b, 0x04, 0x44, 0x22,
+0xe8, 0xf3, 0x60, 0x52, 0xec, 0xe1, 0x39, 0x05, 0x93, 0x12, 0x0d, 0x6d, 0xfc, 0xe0, 0xa8, 0x3d,
+0x5b, 0xfa, 0x80, 0x84, 0x90, 0x3b, 0x67, 0x43, 0xc0, 0xde, 0x5b, 0x9a, 0xc8, 0x5b, 0xde, 0xdf,
+0xfa, 0x09, 0x12, 0xa8, 0xc6, 0x49, 0x4f, 0xc7, 0x47, 0xc4, 0xdb, 0xd7, 0xe1, 0x0f, 0xc0, 0x6f,
+0x44, 0xe1, 0x09, 0xbd, 0x25, 0x5e, 0x7e, 0x28, 0x9d, 0x32, 0x1e, 0x61, 0x9b, 0xb1, 0x8a, 0x1f,
+0x6c, 0x30, 0x15, 0x4d, 0x4b, 0x2f, 0x10, 0xfc, 0x7c, 0xfc, 0xf8, 0x26, 0x41, 0x8d, 0xed, 0xcf,
+0xb4, 0x21, 0x64, 0x91, 0x86, 0x7a, 0x7d, 0x04, 0x1c, 0xfb, 0xd1, 0x1b, 0xbd, 0xf0, 0x4b, 0x20,
+0x58, 0x50, 0x2a, 0xd0, 0x55, 0x7a, 0xc1, 0xc1, 0xba, 0x9d, 0xbb, 0x0f, 0xcc, 0x8a, 0xb0, 0xf8,
+0xdb, 0x28, 0x71, 0x56, 0x3a, 0xed, 0x1e, 0xe3, 0x5d, 0x4d, 0x8a, 0x49, 0x50, 0xe9, 0x26, 0x0c,
+0xec, 0x38, 0xce, 0xe9, 0xd2, 0x6b, 0xa5, 0x32, 0x18, 0x4c, 0xda, 0xd8, 0x9d, 0xa2, 0x37, 0x91,
+0x0b, 0xef, 0xb3, 0x87, 0x80, 0x10, 0x0f, 0x18, 0x4b, 0x9a, 0x01, 0xff, 0x09, 0x4c, 0x10, 0x94,
+0xee, 0x2c, 0x5f, 0xab, 0xe2, 0xc8, 0x48, 0x18, 0xd1, 0x65, 0xf1, 0x36, 0x26, 0x50, 0x5e, 0xe6,
+0x77, 0xb6, 0x54, 0x06, 0x89, 0x38, 0xae, 0x00, 0x97, 0x18, 0xc3, 0xc8, 0x93, 0x33, 0x6b, 0xf9,
+0x78, 0xf7, 0x49, 0x44, 0xb0, 0x79, 0x05, 0x5e, 0x9a, 0x88, 0x18, 0x09, 0x13, 0x49, 0xbb, 0x42,
+0x1c, 0xa0, 0xa7, 0xf5, 0xfb, 0xb9, 0xb3, 0x8d, 0x3c, 0x3d, 0x8f, 0x26, 0x16, 0xa4, 0xd2, 0xd6,
+0x58, 0x9e, 0xdc, 0xf9, 0x42, 0x2d, 0x83, 0x9b, 0x40, 0xef, 0x13, 0x67, 0x29, 0x1a, 0x92, 0xa1,
+0x53, 0xfa, 0xf6, 0x6e, 0x7a, 0x85, 0x96, 0xa4, 0x38, 0xe0, 0x84, 0x38, 0x0c, 0x20, 0x17, 0x98,
+0x22, 0xb9, 0x6e, 0x83, 0xa3, 0xab, 0x34, 0x78, 0xef, 0xee, 0x09, 0x65, 0x48, 0x0c, 0xca, 0x2a,
+0x8e, 0x0a, 0x21, 0xaa, 0xae, 0x73, 0xe0, 0xe0, 0xa5, 0xff, 0xfc, 0xdd, 0x4c, 0x15, 0x2b, 0xae,
+0x5f, 0x47, 0x9d, 0x4b, 0xb1, 0x61, 0xb2, 0xe3, 0x8f, 0xee, 0xb3, 0x9b, 0x39, 0x14, 0x0e, 0x46,
+0xb0, 0xa4, 0x2d, 0xd2, 0xaa, 0x2d, 0xda, 0x8d, 0x29, 0xfe, 0xf6, 0x54, 0x35, 0xd6, 0x86, 0x02,
+0xe8, 0x77, 0xce, 0xd3, 0x16, 0x45, 0x46, 0x79, 0xd4, 0x46, 0xe7, 0x9b, 0x6c, 0x76, 0x72, 0xbf,
+0x80, 0xb4, 0x24, 0x6d, 0x0f, 0x54, 0x7c, 0x89, 0x3f, 0x6e, 0xc0, 0x53, 0x88, 0x40, 0xdb, 0xf7,
+0xc8, 0x28, 0x83, 0x18, 0x4b, 0xa4, 0x13, 0xe1, 0x77, 0xb9, 0x7c, 0x72, 0xf4, 0xf9, 0xf7, 0xbc,
+0x48, 0x4a, 0x44, 0x4d, 0x14, 0xbd, 0x43, 0x3f, 0xfc, 0x52, 0xb6, 0xea, 0xc5, 0xb3, 0x62, 0x29,
+0x41, 0x5d, 0x82, 0xe5, 0x15, 0x83, 0xde, 0x17, 0xac, 0xa5, 0x0a, 0xc4, 0x43, 0x62, 0xee, 0x8d,
+0xdb, 0x88, 0x29, 0xcd, 0x7a, 0x9c, 0x15, 0x01, 0xcb, 0x07, 0x7c, 0x6f, 0x21, 0x6f, 0xec, 0xbe,
+0x50, 0x80, 0x8d, 0x3b, 0xdd, 0xcd, 0xec, 0xe4, 0xcd, 0x76, 0x4b, 0xdd, 0xe5, 0x97, 0xf4, 0x3d,
+0xf1, 0x76, 0xa1, 0x74, 0x21, 0x9f, 0xac, 0x90, 0xe4, 0xeb, 0x20, 0x18, 0x35, 0x02, 0x07, 0x91,
+0xbe, 0x8e, 0x72, 0xa3, 0x57, 0xae, 0xdc, 0x2b, 0x17, 0xb1, 0x4d, 0xdc, 0x12, 0x30, 0xe0, 0x1c,
+0x99, 0xac, 0x1b, 0x1b, 0x61, 0x2a, 0xe4, 0x60, 0xcd, 0xb4, 0x39, 0xc6, 0xec, 0x98, 0xb2, 0x24,
+0xfd, 0x68, 0xe9, 0x75, 0xcd, 0x2b, 0x61, 0x8e, 0xaf, 0xb9, 0x6f, 0x78, 0x62, 0xec, 0x93, 0xb8,
+0xc8, 0x1d, 0x9c, 0x9a, 0x65, 0x91, 0xcd, 0x87, 0x58, 0x15, 0x82, 0xd9, 0x37, 0x76, 0x2a, 0xda,
+0xdc, 0x99, 0x2c, 0x89, 0xd3, 0xec, 0x9b, 0x86, 0x10, 0x56, 0x4e, 0xbe, 0xb2, 0xdf, 0x13, 0xae,
+0xb5, 0x7e, 0xe6, 0xa5, 0x2d, 0x2a, 0x8a, 0x8e, 0x12, 0xad, 0x89, 0x1d, 0xb8, 0xcd, 0x18, 0xe6,
+0x9f, 0x3a, 0x8e, 0x77, 0x69, 0x9b, 0x4f, 0xdd, 0x1b, 0x40, 0x1c, 0x25, 0x67, 0xc5, 0x1f, 0xd8,
+0x40, 0x0b, 0xdf, 0xd3, 0xe9, 0xea, 0x29, 0x39, 0xb1, 0x80, 0x14, 0x98, 0x11, 0x86, 0xc0, 0xcc,
+0xfe, 0xa5, 0x48, 0x8e, 0x38, 0xb4, 0xf0, 0x0c, 0x19, 0xab, 0x69, 0x2f, 0x18, 0xdf, 0xe3, 0x76,
+0x8e, 0x24, 0xb7, 0x3a, 0xe5, 0xa9, 0x27, 0xd3, 0xbf, 0x15, 0xdc, 0x3f, 0x8b, 0x1e, 0xbd, 0xc1,
+0x27, 0x8b, 0x73, 0xec, 0xeb, 0x52, 0xed, 0x6a, 0xd9, 0x69, 0xcd, 0x10, 0xef, 0xb7, 0xe8, 0xd2,
+0x33, 0xdc, 0xcb, 0x53, 0x43, 0x4d, 0x8b, 0x21, 0xba, 0x54, 0x58, 0x7b, 0x58, 0xf8, 0xb5, 0x65,
+0x66, 0xab, 0x96, 0x56, 0xa5, 0x36, 0x45, 0xb2, 0x0c, 0x5f, 0xb0, 0x55, 0x86, 0xf9, 0x38, 0xdb,
+0x8c, 0x54, 0xfc, 0xdb, 0x5c, 0xe9, 0x50, 0x49, 0x68, 0x65, 0x61, 0x21, 0xe6, 0x3f, 0xe0, 0xa2,
+0x82, 0xee, 0x03, 0xf3, 0x0d, 0x88, 0x04, 0x25, 0xb3, 0xa8, 0x9c, 0xba, 0xc5, 0x6c, 0x0f, 0xb2,
+0x79, 0xa0, 0x06, 0xd2, 0x8f, 0x81, 0xe1, 0x65, 0xf9, 0xf5, 0x60, 0xa9, 0xf9, 0x90, 0x79, 0x90,
+0x32, 0x26, 0x54, 0x51, 0x75, 0xc0, 0x0c, 0x69, 0xea, 0xdf, 0x54, 0x81, 0x7b, 0x4a, 0x1d, 0x0a,
+0x43, 0x24, 0x91, 0x1f, 0x33, 0x28, 0x09, 0x5a, 0xe8, 0x57, 0xd6, 0x52, 0x5d, 0xcc, 0xd4, 0xb9,
+0x51, 0x44, 0xbc, 0x71, 0x0e, 0xd0, 0x18, 0xd0, 0x9d, 0x4d, 0x27, 0x8a, 0x8a, 0x9b, 0x1b, 0x33,
+0x4d, 0x6b, 0x74, 0x8a, 0x49, 0x7f, 0xe2, 0x3f, 0x50, 0x86, 0xa9, 0x89, 0x34, 0x21, 0x5d, 0x3d,
+0xf7, 0x53, 0x8a, 0x7c, 0xd0, 0x43, 0xd8, 0x98, 0xdd, 0x41, 0x77, 0x79, 0xf5, 0xea, 0x19, 0x9d,
+0x46, 0xcc, 0x3e, 0x48, 0x35, 0x4e, 0xd3, 0x6e, 0x13, 0x71, 0x5a, 0x7e, 0x4c, 0x15, 0x1c, 0xff,
+0x0e, 0x46, 0x25, 0x7f, 0xbd, 0x6f, 0x9b, 0x34, 0x8e, 0xba, 0x79, 0x03, 0xed, 0x18, 0x7d, 0xd0,
+0xc3, 0x16, 0xd9, 0x57, 0xd0, 0x0c, 0xe3, 0xdf, 0x0b, 0x93, 0xa7, 0xfc, 0x0d, 0x8e, 0xd7, 0xa2,
+0x28, 0xbf, 0x12, 0xf6, 0xd5, 0x5a, 0xc5, 0xb2, 0xe4, 0x7b, 0x4d, 0x60, 0x6f, 0x94, 0x7d, 0x84,
+0xde, 0xb3, 0xde, 0x92, 0xfb, 0x0a, 0xe8, 0x63, 0xbe, 0x43, 0x66, 0x6b, 0xc7, 0x2e, 0x09, 0xce,
+0xe8, 0x4a, 0x51, 0x5a, 0x3e, 0x5f, 0xad, 0x83, 0x32, 0x43, 0x19, 0x16, 0x1b, 0x83, 0x8e, 0xba,
+0x0b, 0xc0, 0xad, 0xbf, 0xf7, 0xc2, 0xf4, 0x60, 0x89, 0x55, 0x6b, 0x7c, 0x38, 0x62, 0x88, 0xa8,
+0xd4, 0x69, 0x96, 0x82, 0x75, 0xa4, 0x49, 0xb6, 0x6c, 0x45, 0x00, 0x06, 0xf0, 0x27, 0xb3, 0x70,
+0x88, 0xf8, 0x26, 0xe4, 0x37, 0xf1, 0x01, 0x6f, 0xa2, 0x8d, 0x8e, 0xad, 0x43, 0xb7, 0x36, 0x09,
+0x62, 0x96, 0x76, 0x02, 0x02, 0x8a, 0xfc, 0x35, 0x08, 0x7f, 0x69, 0xd7, 0xbd, 0xe8, 0xa6, 0x87,
+0xbc, 0x7a, 0x33, 0xb3, 0xa0, 0x6d, 0xc1, 0x01, 0x45, 0x22, 0xb4, 0x47, 0x63, 0x87, 0xee, 0x6b,
+0xa1, 0x8f, 0xeb, 0xd7, 0x1f, 0xc4, 0xee, 0x81, 0xab, 0xa2, 0x98, 0x86, 0x5f, 0x6e, 0x13, 0x52,
+0x99, 0xcc, 0x90, 0xc4, 0x5d, 0x6b, 0xc3, 0xb3, 0x39, 0xf1, 0xec, 0xba, 0xe7, 0x11, 0xc7, 0x31,
+0x40, 0xe2, 0xf8, 0x14, 0x1d, 0x5a, 0x6c, 0xf8, 0x3f, 0xdb, 0x81, 0x56, 0x31, 0x30, 0x20, 0x33,
+0x9d, 0xbe, 0x9c, 0xfa, 0x21, 0x76, 0x23, 0x80, 0x19, 0xe3, 0xc5, 0x1f, 0xb0, 0x8e, 0x91, 0x89,
+0xf0, 0x70, 0xdc, 0xd6, 0xea, 0x80, 0xaa, 0xbe, 0xde, 0x9d, 0xbf, 0x5a, 0x15, 0xf2, 0x2a, 0xab,
+0x2f, 0xd9, 0x13, 0x2e, 0xd2, 0xbf, 0xc1, 0x76, 0xc6, 0x99, 0x6c, 0x5d, 0x63, 0xf1, 0xc2, 0x25,
+0xb5, 0xc2, 0x19, 0x31, 0xbc, 0x58, 0xc1, 0x90, 0x81, 0x86, 0x24, 0xa0, 0xca, 0x07, 0x02, 0xcc,
+0x44, 0xe4, 0xbd, 0x8d, 0xdc, 0xc3, 0xc3, 0xe4, 0x07, 0x80, 0xa3, 0x9d, 0xfc, 0x4f, 0xb4, 0xb6,
+0x0b, 0xae, 0x39, 0x40, 0x60, 0xd3, 0x32, 0xc1, 0x1b, 0x8d, 0xda, 0x61, 0x6c, 0x6d, 0xba, 0xde,
+0xc6, 0xe0, 0x4e, 0x40, 0x70, 0x92, 0xe4, 0xef, 0x9e, 0xdb, 0x81, 0x61, 0x87, 0x53, 0x2e, 0x3d,
+0x09, 0xe1, 0x17, 0x1d, 0x8d, 0x61, 0xc2, 0x3b, 0xc4, 0x19, 0xfe, 0xe7, 0x88, 0x2b, 0xb4, 0x14,
+0xe4, 0xf8, 0x51, 0xcc, 0x6c, 0x55, 0x3f, 0xb8, 0x4f, 0x1d, 0x45, 0x7c, 0xe3, 0x5e, 0x0e, 0xd1,
+0x5f, 0x87, 0x05, 0x59, 0x87, 0x61, 0xe2, 0x65, 0x4d, 0xf5, 0x93, 0x21, 0xb2, 0x19, 0x1f, 0x93,
+0x1f, 0xc8, 0x06, 0x09, 0x95, 0x4e, 0x78, 0xc6, 0x2a, 0xd6, 0xf1, 0x25, 0xc4, 0x3a, 0xc3, 0xd3,
+0xf8, 0xc6, 0x69, 0x3e, 0x58, 0x10, 0xdb, 0x55, 0x17, 0x68, 0x9e, 0x97, 0xbc, 0xfe, 0xeb, 0x88,
+0xb3, 0x34, 0xd0, 0x22, 0xb8, 0x44, 0x43, 0xee, 0xd7, 0x82, 0xfa, 0xf8, 0x9e, 0x2b, 0x1c, 0x81,
+0x14, 0x21, 0xee, 0x42, 0x50, 0x9d, 0x2d, 0x0b, 0xe4, 0xce, 0x48, 0xf7, 0xbc, 0xd1, 0x0a, 0x79,
+0x55, 0x71, 0x63, 0xbd, 0x51, 0x31, 0xe5, 0xd3, 0x17, 0x02, 0x9d, 0xdd, 0x27, 0xd3, 0x71, 0x8f,
+0x96, 0xf6, 0xf5, 0x17, 0xa8, 0xbf, 0x05, 0x4c, 0xc8, 0x00, 0x42, 0x90, 0x15, 0x00, 0x2d, 0x4d,
+0x82, 0xcd, 0x77, 0x91, 0x72, 0x44, 0xe0, 0xf8, 0x4a, 0xd9, 0xae, 0xb8, 0xe7, 0xef, 0xad, 0x43,
+0x8a, 0xb9, 0x27, 0x64, 0x5d, 0xb5, 0x14, 0x24, 0x02, 0x3b, 0x13, 0x90, 0x4c, 0x39, 0x76, 0x48,
+0x81, 0xc8, 0x32, 0xea, 0xa0, 0x4f, 0x56, 0xcc, 0x1f, 0xbe, 0xa0, 0x88, 0x24, 0xdc, 0x09, 0x02,
+0xed, 0xa7, 0xdc, 0x47, 0xcb, 0x74, 0x8f, 0x62, 0x8c, 0x29, 0xb5, 0x88, 0xb6, 0x01, 0x04, 0x72,
+0x80, 0x54, 0x0b, 0xf1, 0x8b, 0xd5, 0xd7, 0xc2, 0xfd, 0x5d, 0xc4, 0xea, 0x37, 0x10, 0x38, 0xfb,
+0xaa, 0xfd, 0x74, 0xa2, 0xda, 0x27, 0x31, 0x41, 0x60, 0x72, 0x05, 0x71, 0xf7, 0x85, 0x48, 0xee,
+0x7b, 0xd0, 0x96, 0x2c, 0xc3, 0xfa, 0x2a, 0x57, 0xda, 0xac, 0xc7, 0xd9, 0x26, 0xfd, 0x8d, 0x56,
+0xaa, 0xeb, 0x07, 0x91, 0x30, 0x2e, 0xbe, 0xc8, 0x4c, 0xd3, 0xd7, 0x8e, 0xdf, 0x50, 0xf5, 0x04,
+0x35, 0x6b, 0x85, 0x97, 0xa3, 0xcb, 0xc2, 0x63, 0xba, 0xea, 0x1e, 0xe9, 0xb9, 0xc7, 0x27, 0xde,
+0x9c, 0x7d, 0xa8, 0xbb, 0xc9, 0x68, 0x7e, 0x88, 0xb0, 0xb4, 0x14, 0x4c, 0x7c, 0xac, 0x90, 0xff,
+0xc4, 0x08, 0x03, 0x8e, 0xb4, 0x9f, 0x9a, 0x88, 0x31, 0x91, 0xf2, 0x5d, 0xa8, 0x8b, 0x86, 0x93,
+0xfe, 0x78, 0x0e, 0xb4, 0xb8, 0x13, 0xe9, 0x96, 0x6f, 0xbe, 0x2f, 0xbe, 0xc4, 0xb4, 0xc6, 0x81,
+0xf2, 0xbe, 0xf2, 0x3c, 0x32, 0xad, 0x79, 0xee, 0xef, 0x13, 0x98, 0x11, 0xc5, 0xe2, 0xdf, 0x28,
+0x10, 0xc0, 0xa5, 0x02, 0x09, 0x97, 0x09, 0x56, 0x87, 0x90, 0x91, 0xea, 0x13, 0xd2, 0xd9, 0x5c,
+0xdb, 0x60, 0x5c, 0xab, 0x2f, 0x26, 0xe5, 0x4a, 0x1a, 0x40, 0x22, 0xdd, 0xcc, 0xde, 0xda, 0xd3,
+0x9b, 0x35, 0x09, 0xbe, 0xaf, 0x1e, 0x64, 0x27, 0x3c, 0x58, 0xa1, 0x08, 0x66, 0x4e, 0x4b, 0x7c,
+0x90, 0x25, 0x99, 0xb2, 0x28, 0x68, 0xbb, 0x69, 0xe0, 0xb3, 0x7c, 0xcb, 0x2a, 0x7e, 0x81, 0x4a,
+0x43, 0x2b, 0x57, 0x24, 0x31, 0xb6, 0x5b, 0x7b, 0xc4, 0xc2, 0x12, 0xcf, 0xcd, 0x30, 0x6d, 0xbe,
+0x43, 0x5d, 0x50, 0x2d, 0x51, 0xe2, 0x3b, 0xfb, 0x2b, 0x4d, 0xce, 0x3d, 0xa6, 0x31, 0x3f, 0xd3,
+0xc6, 0xed, 0xbd, 0x17, 0x2c, 0x31, 0x42, 0x7a, 0x92, 0xe0, 0xc7, 0x61, 0x1e, 0x75, 0xd2, 0xe5,
+0x95, 0x54, 0xf0, 0x70, 0x67, 0xc4, 0x4f, 0xe5, 0x42, 0x62, 0xb9, 0x97, 0xbb, 0x81, 0x71, 0x81,
+0xb3, 0xd0, 0xb3, 0x46, 0xe5, 0x46, 0xfa, 0x9b, 0xf4, 0x5f, 0x36, 0x93, 0xe5, 0x13, 0x16, 0x0b,
+0x27, 0x8c, 0xd9, 0x75, 0xf4, 0x09, 0x26, 0xba, 0xc4, 0xd1, 0xa6, 0x1f, 0x41, 0xdf, 0x92, 0x0e,
+0x5f, 0x95, 0x92, 0x92, 0x65, 0xe0, 0x98, 0xec, 0xb9, 0x29, 0xc2, 0x37, 0x21, 0xbd, 0x0d, 0xdd,
+0xa2, 0x7f, 0x11, 0x80, 0x67, 0xbb, 0xd0, 0xb5, 0x45, 0x0f, 0xd8, 0xdb, 0x3a, 0xae, 0xa9, 0x03,
+0x1e, 0x1a, 0xcc, 0xbf, 0x45, 0x7c, 0x57, 0xb1, 0x3e, 0x7b, 0xe2, 0x6c, 0x64, 0x40, 0x61, 0xd3,
+0x0e, 0xc4, 0x43, 0xf8, 0x2a, 0xa6, 0xb8, 0xaf, 0xf1, 0xc1, 0x2d, 0x9b, 0xec, 0x50, 0x09, 0x6d,
+0x42, 0x20, 0xf2, 0x6c, 0xff, 0x3f, 0x39, 0x20, 0xaf, 0x3e, 0x9c, 0x42, 0xd0, 0x0d, 0x4b, 0x39,
+0xd1, 0x4f, 0x3c, 0x4f, 0xb9, 0xa8, 0xf7, 0x33, 0x56, 0x02, 0x02, 0x82, 0xe5, 0x74, 0x76, 0x89,
+0x3c, 0x12, 0x97, 0xd2, 0x30, 0x83, 0x57, 0xc0, 0x3f, 0xab, 0xea, 0x0d, 0x87, 0x5c, 0x44, 0x5f,
+0xa4, 0xf0, 0x6e, 0x97, 0x95, 0x2c, 0x29, 0x73, 0x59, 0x91, 0x88, 0x7e, 0x81, 0xe1, 0x4a, 0x51,
+0xf4, 0x45, 0x37, 0x3a, 0xf3, 0x41, 0x0c, 0x16, 0x48, 0xa3, 0xae, 0x2b, 0x21, 0x05, 0x8f, 0xaf,
+};
@@ -0,0 +1,169 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* grub_disk_read on a synthetic disk, so that only the disk layer and its
+   cache are measured.  */
+
+#include <grub/bench.h>
+#include <grub/disk.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define BENCHDISK_SECTORS	(512 * 1024)
+#define READ_SIZE		(64 * 1024)
+
+struct disk_bench
+{
+  grub_disk_t disk;
+  grub_disk_addr_t next_sector;
+  char buf[READ_SIZE];
+};
+
+static int
+benchdisk_iterate (grub_disk_dev_iterate_hook_t hook, void *hook_data,
+		   grub_disk_pull_t pull)
+{
+  if (pull != GRUB_DISK_PULL_NONE)
+    return 0;
+
+  return hook ("benchdisk", hook_data);
+}
+
+static grub_err_t
+benchdisk_open (const char *name, grub_disk_t disk)
+{
+  if (grub_strcmp (name, "benchdisk"))
+    return grub_error (GRUB_ERR_UNKNOWN_DEVICE, "not a benchdisk");
+
+  disk->total_sectors = BENCHDISK_SECTORS;
+  disk->max_agglomerate = GRUB_DISK_MAX_MAX_AGGLOMERATE;
+  disk->id = 0;
+
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+benchdisk_read (grub_disk_t disk __attribute__ ((unused)),
+		grub_disk_addr_t sector, grub_size_t size, char *buf)
+{
+  grub_memset (buf, sector & 0xff, size << GRUB_DISK_SECTOR_BITS);
+  return GRUB_ERR_NONE;
+}
+
+static struct grub_disk_dev benchdisk_dev =
+  {
+    .name = "benchdisk",
+    .id = GRUB_DISK_DEVICE_BENCH_ID,
+    .disk_iterate = benchdisk_iterate,
+    .disk_open = benchdisk_open,
+    .disk_read = benchdisk_read,
+    .next = 0
+  };
+
+static grub_err_t
+disk_init (void **data)
+{
+  struct disk_bench *d;
+
+  d = grub_zalloc (sizeof (*d));
+  if (d == NULL)
+    return grub_errno;
+
+  grub_disk_dev_register (&benchdisk_dev);
+  d->disk = grub_disk_open ("benchdisk");
+  if (d->disk == NULL)
+    {
+      grub_disk_dev_unregister (&benchdisk_dev);
+      grub_free (d);
+      return grub_errno;
+    }
+  *data = d;
+  return GRUB_ERR_NONE;
+}
+
+static void
+disk_fini (void *data)
+{
+  struct disk_bench *d = data;
+
+  grub_disk_close (d->disk);
+  grub_disk_dev_unregister (&benchdisk_dev);
+  grub_free (d);
+}
+
+static void
+cached_512 (void *data)
+{
+  struct disk_bench *d = data;
+  grub_disk_read (d->disk, 0, 0, 512, d->buf);
+}
+
+static void
+cached_4k (void *data)
+{
+  struct disk_bench *d = data;
+  grub_disk_read (d->disk, 8, 0, 4096, d->buf);
+}
+
+static void
+cached_64k (void *data)
+{
+  struct disk_bench *d = data;
+  grub_disk_read (d->disk, 128, 0, READ_SIZE, d->buf);
+}
+
+/* Small reads at an offset inside a sector, as filesystem drivers do when
+   walking on-disk structures.  */
+static void
+cached_unaligned (void *data)
+{
+  struct disk_bench *d = data;
+  grub_disk_read (d->disk, 16, 100, 200, d->buf);
+}
+
+/* Sequential reads over an area larger than the cache, so that every read
+   goes to the device.  */
+static void
+sequential_64k (void *data)
+{
+  struct disk_bench *d = data;
+
+  grub_disk_read (d->disk, d->next_sector, 0, READ_SIZE, d->buf);
+  d->next_sector += READ_SIZE >> GRUB_DISK_SECTOR_BITS;
+  if (d->next_sector >= BENCHDISK_SECTORS)
+    d->next_sector = 0;
+}
+
+static struct grub_bench disk_benches[] =
+  {
+    { .name = "disk/cached-512", .bytes = 512, .init = disk_init,
+      .run = cached_512, .fini = disk_fini },
+    { .name = "disk/cached-4k", .bytes = 4096, .init = disk_init,
+      .run = cached_4k, .fini = disk_fini },
+    { .name = "disk/cached-64k", .bytes = READ_SIZE, .init = disk_init,
+      .run = cached_64k, .fini = disk_fini },
+    { .name = "disk/cached-unaligned", .bytes = 200, .init = disk_init,
+      .run = cached_unaligned, .fini = disk_fini },
+    { .name = "disk/sequential-64k", .bytes = READ_SIZE, .init = disk_init,
+      .run = sequential_64k, .fini = disk_fini },
+  };
+
+GRUB_BENCHMARKS (disk_bench, disk_benches);
@@ -0,0 +1,161 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2020  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Compare the optimized 32-bit blitters against a straightforward
+   per-channel computation.  The results have to be bit-exact, otherwise
+   the video checksums would change.  */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/fbblit.h>
+#include <grub/fbutil.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define WIDTH 256
+#define HEIGHT 64
+
+static grub_uint32_t
+pseudo_random (grub_uint32_t *state)
+{
+  *state = *state * 1103515245 + 12345;
+  return (*state >> 16) | (*state << 16);
+}
+
+static grub_uint8_t
+ref_blend (grub_uint8_t bg, grub_uint8_t fg, grub_uint8_t alpha)
+{
+  return (fg * alpha + bg * (255 - alpha)) / 255;
+}
+
+/* Expected result of putting RGBA8888 pixel SRC over DST, which is in
+   RGBA8888 or BGRA8888 (when SWAP is set) format.  */
+static grub_uint32_t
+ref_pixel (grub_uint32_t src, grub_uint32_t dst, int swap,
+	   enum grub_video_blit_operators oper)
+{
+  grub_uint8_t a = src >> 24;
+  grub_uint8_t sr = src, sg = src >> 8, sb = src >> 16;
+  grub_uint8_t dr, dg, db;
+
+  if (swap)
+    {
+      dr = dst >> 16;
+      dg = dst >> 8;
+      db = dst;
+    }
+  else
+    {
+      dr = dst;
+      dg = dst >> 8;
+      db = dst >> 16;
+    }
+
+  if (oper == GRUB_VIDEO_BLIT_BLEND)
+    {
+      if (a == 0)
+	return dst;
+      dr = ref_blend (dr, sr, a);
+      dg = ref_blend (dg, sg, a);
+      db = ref_blend (db, sb, a);
+    }
+  else
+    {
+      dr = sr;
+      dg = sg;
+      db = sb;
+    }
+
+  if (swap)
+    return ((grub_uint32_t) a << 24) | (dr << 16) | (dg << 8) | db;
+  return ((grub_uint32_t) a << 24) | (db << 16) | (dg << 8) | dr;
+}
+
+static void
+check_blit (enum grub_video_blit_format dst_format,
+	    enum grub_video_blit_operators oper)
+{
+  struct grub_video_mode_info src_mode, dst_mode;
+  struct grub_video_fbblit_info src, dst;
+  grub_uint32_t *src_data, *dst_data, *orig;
+  grub_uint32_t state = 1;
+  int swap = (dst_format == GRUB_VIDEO_BLIT_FORMAT_BGRA_8888);
+  unsigned i;
+
+  src_data = grub_malloc (WIDTH * HEIGHT * 4);
+  dst_data = grub_malloc (WIDTH * HEIGHT * 4);
+  orig = grub_malloc (WIDTH * HEIGHT * 4);
+  if (!src_data || !dst_data || !orig)
+    {
+      grub_test_assert (0, "out of memory");
+      goto out;
+    }
+
+  /* Every alpha value shows up in every column of the source.  */
+  for (i = 0; i < WIDTH * HEIGHT; i++)
+    {
+      src_data[i] = (pseudo_random (&state) & 0x00ffffff)
+	| ((grub_uint32_t) (i % 255 + (i / WIDTH) % 2) << 24);
+      orig[i] = dst_data[i] = pseudo_random (&state);
+    }
+
+  grub_memset (&src_mode, 0, sizeof (src_mode));
+  src_mode.width = WIDTH;
+  src_mode.height = HEIGHT;
+  src_mode.bytes_per_pixel = 4;
+  src_mode.pitch = WIDTH * 4;
+  src_mode.blit_format = GRUB_VIDEO_BLIT_FORMAT_RGBA_8888;
+  dst_mode = src_mode;
+  dst_mode.blit_format = dst_format;
+
+  src.mode_info = &src_mode;
+  src.data = (grub_uint8_t *) src_data;
+  dst.mode_info = &dst_mode;
+  dst.data = (grub_uint8_t *) dst_data;
+
+  grub_video_fb_dispatch_blit (&dst, &src, oper, 0, 0, WIDTH, HEIGHT, 0, 0);
+
+  for (i = 0; i < WIDTH * HEIGHT; i++)
+    {
+      grub_uint32_t expected = ref_pixel (src_data[i], orig[i], swap, oper);
+      if (dst_data[i] != expected)
+	{
+	  grub_test_assert (0, "format %d operator %d pixel %u: 0x%x != 0x%x",
+			    dst_format, oper, i, dst_data[i], expected);
+	  break;
+	}
+    }
+
+ out:
+  grub_free (src_data);
+  grub_free (dst_data);
+  grub_free (orig);
+}
+
+static void
+fbblit_test (void)
+{
+  check_blit (GRUB_VIDEO_BLIT_FORMAT_RGBA_8888, GRUB_VIDEO_BLIT_REPLACE);
+  check_blit (GRUB_VIDEO_BLIT_FORMAT_BGRA_8888, GRUB_VIDEO_BLIT_REPLACE);
+  check_blit (GRUB_VIDEO_BLIT_FORMAT_RGBA_8888, GRUB_VIDEO_BLIT_BLEND);
+  check_blit (GRUB_VIDEO_BLIT_FORMAT_BGRA_8888, GRUB_VIDEO_BLIT_BLEND);
+}
+
+GRUB_FUNCTIONAL_TEST (fbblit_test, fbblit_test);
@@ -0,0 +1,294 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/mm.h>
+#include <grub/misc.h>
+#include <grub/time.h>
+#include <grub/term.h>
+#include <grub/normal.h>
+#include <grub/bench.h>
+
+/* The timer only has millisecond resolution, so every sample runs the
+   benchmark long enough for one tick to be noise.  The median of several
+   samples is reported to filter out interrupts and cache effects.  */
+#define SAMPLE_MS	50
+#define SAMPLES		5
+
+grub_bench_t grub_bench_list;
+
+struct bench_result
+{
+  grub_uint64_t median_ns;
+  grub_uint64_t min_ns;
+  grub_uint64_t max_ns;
+  grub_uint64_t iterations;
+};
+
+void
+grub_bench_register (grub_bench_t bench)
+{
+  grub_list_push (GRUB_AS_LIST_P (&grub_bench_list), GRUB_AS_LIST (bench));
+}
+
+void
+grub_bench_unregister (grub_bench_t bench)
+{
+  grub_list_remove (GRUB_AS_LIST (bench));
+}
+
+/* Run BENCH ITERATIONS times and return the elapsed time in ms.  The clock
+   is started on a tick boundary to halve the quantization error.  Stop at
+   the first run that fails.  */
+static grub_uint64_t
+time_iterations (grub_bench_t bench, void *data, grub_uint64_t iterations)
+{
+  grub_uint64_t start, tick, i;
+
+  tick = grub_get_time_ms ();
+  do
+    start = grub_get_time_ms ();
+  while (start == tick);
+
+  for (i = 0; i < iterations && grub_errno == GRUB_ERR_NONE; i++)
+    bench->run (data);
+
+  return grub_get_time_ms () - start;
+}
+
+static grub_err_t
+measure (grub_bench_t bench, void *data, struct bench_result *res)
+{
+  grub_uint64_t samples[SAMPLES];
+  grub_uint64_t iterations = 1, ms;
+  int i, j;
+
+  /* Calibrate, which also warms up caches and lazily built tables.  */
+  while ((ms = time_iterations (bench, data, iterations)) < SAMPLE_MS)
+    {
+      if (grub_errno != GRUB_ERR_NONE)
+	return grub_errno;
+      if (ms == 0)
+	iterations *= 16;
+      else
+	iterations = grub_divmod64 (iterations * SAMPLE_MS * 5, ms * 4, 0) + 1;
+    }
+
+  for (i = 0; i < SAMPLES; i++)
+    {
+      grub_uint64_t ns;
+
+      ms = time_iterations (bench, data, iterations);
+      if (grub_errno != GRUB_ERR_NONE)
+	return grub_errno;
+      ns = grub_divmod64 (ms * 1000000ULL, iterations, 0);
+      for (j = i; j > 0 && samples[j - 1] > ns; j--)
+	samples[j] = samples[j - 1];
+      samples[j] = ns;
+    }
+
+  res->median_ns = samples[SAMPLES / 2];
+  res->min_ns = samples[0];
+  res->max_ns = samples[SAMPLES - 1];
+  res->iterations = iterations;
+  return GRUB_ERR_NONE;
+}
+
+/* Find NAME in the JSON output of an earlier run.  Only the layout written
+   by report_json is understood.  */
+static int
+baseline_lookup (const char *baseline, const char *name, grub_uint64_t *ns)
+{
+  const char *p = baseline, *next;
+  grub_size_t len = grub_strlen (name);
+
+  while ((p = grub_strstr (p, "\"name\": \"")) != NULL)
+    {
+      p += sizeof ("\"name\": \"") - 1;
+      if (grub_strncmp (p, name, len) != 0 || p[len] != '"')
+	continue;
+      next = grub_strstr (p, "\"name\": \"");
+      p = grub_strstr (p, "\"ns_per_op\": ");
+      /* Entries of benchmarks that failed have no timing.  */
+      if (p == NULL || (next != NULL && next < p))
+	return 0;
+      *ns = grub_strtoull (p + sizeof ("\"ns_per_op\": ") - 1, 0, 10);
+      return grub_errno == GRUB_ERR_NONE;
+    }
+  return 0;
+}
+
+static int
+matches (const char *name, char **patterns, int npatterns)
+{
+  int i;
+
+  if (npatterns == 0)
+    return 1;
+  for (i = 0; i < npatterns; i++)
+    if (grub_strstr (name, patterns[i]))
+      return 1;
+  return 0;
+}
+
+static void
+report_text (grub_bench_t bench, const struct bench_result *res,
+	     int have_base, grub_uint64_t base_ns, int regressed)
+{
+  grub_printf ("%-28s %10" PRIuGRUB_UINT64_T " ns/op",
+	       bench->name, res->median_ns);
+
+  if (res->median_ns)
+    grub_printf (" (+-%" PRIuGRUB_UINT64_T "%%)",
+		 grub_divmod64 ((res->max_ns - res->min_ns) * 100,
+				res->median_ns, 0));
+  if (bench->bytes && res->median_ns)
+    grub_printf (" %s",
+		 grub_get_human_size (grub_divmod64 (bench->bytes
+						     * 100000000000ULL,
+						     res->median_ns, 0),
+				      GRUB_HUMAN_SIZE_SPEED));
+  if (have_base)
+    grub_printf (", baseline %" PRIuGRUB_UINT64_T " ns/op%s", base_ns,
+		 regressed ? ", REGRESSION" : "");
+  grub_printf ("\n");
+}
+
+static void
+report_json (grub_bench_t bench, const struct bench_result *res, int first,
+	     int have_base, grub_uint64_t base_ns, int regressed)
+{
+  grub_printf ("%s    {\"name\": \"%s\", \"ns_per_op\": %" PRIuGRUB_UINT64_T
+	       ", \"min_ns\": %" PRIuGRUB_UINT64_T
+	       ", \"max_ns\": %" PRIuGRUB_UINT64_T
+	       ", \"bytes\": %" PRIuGRUB_SIZE
+	       ", \"iterations\": %" PRIuGRUB_UINT64_T,
+	       first ? "" : ",\n", bench->name, res->median_ns, res->min_ns,
+	       res->max_ns, bench->bytes, res->iterations);
+  if (have_base)
+    grub_printf (", \"baseline_ns\": %" PRIuGRUB_UINT64_T
+		 ", \"regression\": %s", base_ns, regressed ? "true" : "false");
+  grub_printf ("}");
+}
+
+/* Print S as a JSON string.  */
+static void
+json_print_string (const char *s)
+{
+  grub_printf ("\"");
+  for (; *s; s++)
+    {
+      if (*s == '"' || *s == '\\')
+	grub_printf ("\\%c", *s);
+      else if ((unsigned char) *s < 0x20)
+	grub_printf ("\\u%04x", (unsigned char) *s);
+      else
+	grub_printf ("%c", *s);
+    }
+  grub_printf ("\"");
+}
+
+static void
+report_json_error (grub_bench_t bench, const char *msg, int first)
+{
+  grub_printf ("%s    {\"name\": \"%s\", \"error\": ",
+	       first ? "" : ",\n", bench->name);
+  json_print_string (msg);
+  grub_printf ("}");
+}
+
+grub_err_t
+grub_bench_run_all (char **patterns, int npatterns,
+		    enum grub_bench_output output,
+		    const char *baseline, unsigned threshold)
+{
+  grub_bench_t bench;
+  int first = 1, failed = 0, regressions = 0;
+
+  if (output == GRUB_BENCH_OUTPUT_JSON)
+    grub_printf ("{\n  \"benchmarks\": [\n");
+
+  FOR_LIST_ELEMENTS (bench, grub_bench_list)
+    {
+      struct bench_result res;
+      grub_uint64_t base_ns = 0;
+      int have_base = 0, regressed = 0;
+      void *data = NULL;
+      grub_err_t err;
+
+      if (!matches (bench->name, patterns, npatterns))
+	continue;
+
+      err = bench->init ? bench->init (&data) : GRUB_ERR_NONE;
+      if (err == GRUB_ERR_NONE)
+	{
+	  err = measure (bench, data, &res);
+	  if (bench->fini)
+	    bench->fini (data);
+	}
+      if (err != GRUB_ERR_NONE)
+	{
+	  /* Keep the JSON output parseable, but do not drop the benchmark
+	     from it: a consumer must be able to tell a failure from a
+	     benchmark that does not exist.  */
+	  if (output == GRUB_BENCH_OUTPUT_JSON)
+	    {
+	      report_json_error (bench, grub_errmsg[0] ? grub_errmsg
+				 : "unknown error", first);
+	      first = 0;
+	    }
+	  else
+	    {
+	      grub_printf ("%s: ", bench->name);
+	      grub_print_error ();
+	    }
+	  grub_errno = GRUB_ERR_NONE;
+	  failed = 1;
+	  continue;
+	}
+
+      if (baseline)
+	{
+	  have_base = baseline_lookup (baseline, bench->name, &base_ns);
+	  grub_errno = GRUB_ERR_NONE;
+	}
+      if (have_base
+	  && res.median_ns * 100 > base_ns * (100 + threshold))
+	{
+	  regressed = 1;
+	  regressions++;
+	}
+
+      if (output == GRUB_BENCH_OUTPUT_JSON)
+	report_json (bench, &res, first, have_base, base_ns, regressed);
+      else
+	report_text (bench, &res, have_base, base_ns, regressed);
+      first = 0;
+      grub_refresh ();
+    }
+
+  if (output == GRUB_BENCH_OUTPUT_JSON)
+    grub_printf ("\n  ]\n}\n");
+
+  if (regressions)
+    return grub_error (GRUB_ERR_TEST_FAILURE,
+		       "%d benchmarks are more than %u%% slower than the baseline",
+		       regressions, threshold);
+  if (failed)
+    return grub_error (GRUB_ERR_TEST_FAILURE, "some benchmarks failed to run");
+  return GRUB_ERR_NONE;
+}
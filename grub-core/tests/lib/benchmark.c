@@ -0,0 +1,136 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/dl.h>
+#include <grub/mm.h>
+#include <grub/misc.h>
+#include <grub/file.h>
+#include <grub/extcmd.h>
+#include <grub/i18n.h>
+#include <grub/bench.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define DEFAULT_THRESHOLD 10
+
+static const struct grub_arg_option options[] =
+  {
+    {"json", 'j', 0, N_("Print results as JSON."), 0, 0},
+    {"baseline", 'b', 0, N_("Compare against the JSON output of an earlier run."),
+     N_("FILE"), ARG_TYPE_FILE},
+    {"threshold", 't', 0, N_("Slowdown in percent reported as a regression."),
+     N_("PERCENT"), ARG_TYPE_INT},
+    {0, 0, 0, 0, 0, 0}
+  };
+
+static const char *const bench_modules[] =
+  {
+    "mem_bench",
+    "disk_bench",
+    "decompress_bench",
+    "crypto_bench",
+    "video_bench"
+  };
+
+static char *
+read_baseline (const char *name)
+{
+  grub_file_t file;
+  grub_off_t size;
+  char *buf = NULL;
+
+  file = grub_file_open (name, GRUB_FILE_TYPE_TESTLOAD);
+  if (file == NULL)
+    return NULL;
+
+  size = grub_file_size (file);
+  if (size == GRUB_FILE_SIZE_UNKNOWN || size >= GRUB_UINT_MAX)
+    {
+      grub_error (GRUB_ERR_BAD_FILE_TYPE, N_("invalid baseline file"));
+      goto out;
+    }
+
+  buf = grub_malloc (size + 1);
+  if (buf == NULL)
+    goto out;
+
+  if (grub_file_read (file, buf, size) != (grub_ssize_t) size)
+    {
+      if (!grub_errno)
+	grub_error (GRUB_ERR_FILE_READ_ERROR, N_("premature end of file %s"),
+		    name);
+      grub_free (buf);
+      buf = NULL;
+      goto out;
+    }
+  buf[size] = '\0';
+
+ out:
+  grub_file_close (file);
+  return buf;
+}
+
+static grub_err_t
+grub_cmd_benchmark (grub_extcmd_context_t ctxt, int argc, char **args)
+{
+  struct grub_arg_list *state = ctxt->state;
+  unsigned threshold = DEFAULT_THRESHOLD;
+  char *baseline = NULL;
+  unsigned i;
+  grub_err_t err;
+
+  if (state[2].set)
+    threshold = grub_strtoul (state[2].arg, 0, 0);
+  if (grub_errno)
+    return grub_errno;
+
+  if (state[1].set)
+    {
+      baseline = read_baseline (state[1].arg);
+      if (baseline == NULL)
+	return grub_errno;
+    }
+
+  for (i = 0; i < ARRAY_SIZE (bench_modules); i++)
+    {
+      grub_dl_load (bench_modules[i]);
+      grub_errno = GRUB_ERR_NONE;
+    }
+
+  err = grub_bench_run_all (args, argc,
+			    state[0].set ? GRUB_BENCH_OUTPUT_JSON
+			    : GRUB_BENCH_OUTPUT_TEXT,
+			    baseline, threshold);
+  grub_free (baseline);
+  return err;
+}
+
+static grub_extcmd_t cmd;
+
+GRUB_MOD_INIT (benchmark)
+{
+  cmd = grub_register_extcmd ("benchmark", grub_cmd_benchmark, 0,
+			      N_("[-j] [-b FILE] [-t PERCENT] [PATTERN...]"),
+			      N_("Run micro-benchmarks of GRUB primitives."),
+			      options);
+}
+
+GRUB_MOD_FINI (benchmark)
+{
+  grub_unregister_extcmd (cmd);
+}
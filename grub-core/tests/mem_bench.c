@@ -0,0 +1,185 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Memory primitives and allocator patterns.  */
+
+#include <grub/bench.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define BUF_SIZE	(64 * 1024)
+#define ALLOC_BATCH	64
+
+struct mem_bench
+{
+  grub_uint8_t *src;
+  grub_uint8_t *dst;
+  void *ptrs[ALLOC_BATCH];
+};
+
+static grub_err_t
+mem_init (void **data)
+{
+  struct mem_bench *m;
+  unsigned i;
+
+  m = grub_zalloc (sizeof (*m));
+  if (m == NULL)
+    return grub_errno;
+  /* One extra byte for the misaligned variants.  */
+  m->src = grub_malloc (BUF_SIZE + 1);
+  m->dst = grub_malloc (BUF_SIZE + 1);
+  if (m->src == NULL || m->dst == NULL)
+    {
+      grub_free (m->src);
+      grub_free (m->dst);
+      grub_free (m);
+      return grub_errno;
+    }
+  for (i = 0; i < BUF_SIZE + 1; i++)
+    m->src[i] = i * 7;
+  /* A separate copy for memcmp to read.  */
+  grub_memcpy (m->dst, m->src, BUF_SIZE + 1);
+  *data = m;
+  return GRUB_ERR_NONE;
+}
+
+static void
+mem_fini (void *data)
+{
+  struct mem_bench *m = data;
+
+  grub_free (m->src);
+  grub_free (m->dst);
+  grub_free (m);
+}
+
+static void
+memcpy_64 (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memcpy (m->dst, m->src, 64);
+}
+
+static void
+memcpy_4k (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memcpy (m->dst, m->src, 4096);
+}
+
+static void
+memcpy_64k (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memcpy (m->dst, m->src, BUF_SIZE);
+}
+
+static void
+memcpy_64k_unaligned (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memcpy (m->dst, m->src + 1, BUF_SIZE);
+}
+
+static void
+memmove_64k_overlap (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memmove (m->dst + 1, m->dst, BUF_SIZE);
+}
+
+static void
+memset_4k (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memset (m->dst, 0x5a, 4096);
+}
+
+static void
+memset_64k (void *data)
+{
+  struct mem_bench *m = data;
+  grub_memset (m->dst, 0, BUF_SIZE);
+}
+
+static void
+memcmp_4k (void *data)
+{
+  struct mem_bench *m = data;
+  /* Equal buffers, so the whole length is compared.  */
+  if (grub_memcmp (m->dst, m->src, 4096) != 0)
+    grub_error (GRUB_ERR_TEST_FAILURE, "memcmp of equal buffers failed");
+}
+
+static void
+malloc_free_small (void *data __attribute__ ((unused)))
+{
+  grub_free (grub_malloc (32));
+}
+
+/* Allocate a batch of mixed sizes and release it in a different order,
+   roughly what a filesystem mount and unmount does.  */
+static void
+malloc_free_batch (void *data)
+{
+  struct mem_bench *m = data;
+  unsigned i;
+
+  for (i = 0; i < ALLOC_BATCH; i++)
+    m->ptrs[i] = grub_malloc (16 << (i % 8));
+  for (i = 0; i < ALLOC_BATCH; i += 2)
+    grub_free (m->ptrs[i]);
+  for (i = 1; i < ALLOC_BATCH; i += 2)
+    grub_free (m->ptrs[i]);
+}
+
+static void
+memalign_free (void *data __attribute__ ((unused)))
+{
+  grub_free (grub_memalign (4096, 8192));
+}
+
+static struct grub_bench mem_benches[] =
+  {
+    { .name = "memcpy/64", .bytes = 64, .init = mem_init,
+      .run = memcpy_64, .fini = mem_fini },
+    { .name = "memcpy/4k", .bytes = 4096, .init = mem_init,
+      .run = memcpy_4k, .fini = mem_fini },
+    { .name = "memcpy/64k", .bytes = BUF_SIZE, .init = mem_init,
+      .run = memcpy_64k, .fini = mem_fini },
+    { .name = "memcpy/64k-unaligned", .bytes = BUF_SIZE, .init = mem_init,
+      .run = memcpy_64k_unaligned, .fini = mem_fini },
+    { .name = "memmove/64k-overlap", .bytes = BUF_SIZE, .init = mem_init,
+      .run = memmove_64k_overlap, .fini = mem_fini },
+    { .name = "memset/4k", .bytes = 4096, .init = mem_init,
+      .run = memset_4k, .fini = mem_fini },
+    { .name = "memset/64k", .bytes = BUF_SIZE, .init = mem_init,
+      .run = memset_64k, .fini = mem_fini },
+    { .name = "memcmp/4k", .bytes = 4096, .init = mem_init,
+      .run = memcmp_4k, .fini = mem_fini },
+    { .name = "malloc/small", .run = malloc_free_small },
+    { .name = "malloc/batch", .init = mem_init,
+      .run = malloc_free_batch, .fini = mem_fini },
+    { .name = "malloc/memalign", .run = memalign_free },
+  };
+
+GRUB_BENCHMARKS (mem_bench, mem_benches);
@@ -0,0 +1,227 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Blitters used by gfxterm and gfxmenu.  Everything is drawn into offscreen
+   buffers, so no video mode is needed.  */
+
+#include <grub/bench.h>
+#include <grub/bitmap.h>
+#include <grub/dl.h>
+#include <grub/fbblit.h>
+#include <grub/fbutil.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/video.h>
+#include <grub/video_fb.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define WIDTH		256
+#define HEIGHT		64
+
+/* An 80 column line of 8x16 glyphs, as drawn by gfxterm.  */
+#define GLYPH_WIDTH	8
+#define GLYPH_HEIGHT	16
+#define LINE_GLYPHS	80
+
+struct video_bench
+{
+  struct grub_video_mode_info src_mode;
+  struct grub_video_mode_info dst_mode;
+  grub_uint32_t *src;
+  grub_uint32_t *dst;
+
+  struct grub_video_fbrender_target *target;
+  struct grub_video_fbrender_target *saved_target;
+  struct grub_video_bitmap glyph;
+  grub_uint8_t glyph_data[GLYPH_WIDTH * GLYPH_HEIGHT / 8];
+};
+
+static void
+video_fini (void *data)
+{
+  struct video_bench *v = data;
+
+  if (v->target)
+    {
+      /* Without an active adapter there is no target to go back to and the
+	 next video_fb setup resets it anyway.  */
+      if (grub_video_adapter_active)
+	grub_video_fb_set_active_render_target (v->saved_target);
+      grub_video_fb_delete_render_target (v->target);
+    }
+  grub_free (v->src);
+  grub_free (v->dst);
+  grub_free (v);
+}
+
+static grub_err_t
+video_init (void **data, enum grub_video_blit_format dst_format)
+{
+  struct video_bench *v;
+  grub_uint32_t state = 1;
+  unsigned i;
+
+  v = grub_zalloc (sizeof (*v));
+  if (v == NULL)
+    return grub_errno;
+
+  v->src = grub_malloc (WIDTH * HEIGHT * 4);
+  v->dst = grub_malloc (WIDTH * HEIGHT * 4);
+  if (v->src == NULL || v->dst == NULL)
+    {
+      video_fini (v);
+      return grub_errno;
+    }
+
+  /* Mostly opaque with antialiased edges, like a theme image.  */
+  for (i = 0; i < WIDTH * HEIGHT; i++)
+    {
+      grub_uint32_t alpha;
+
+      state = state * 1103515245 + 12345;
+      alpha = (i % WIDTH) < 8 ? (i % WIDTH) * 32 : 0xff;
+      v->src[i] = (state >> 8) | (alpha << 24);
+      v->dst[i] = state;
+    }
+
+  v->src_mode.width = WIDTH;
+  v->src_mode.height = HEIGHT;
+  v->src_mode.bytes_per_pixel = 4;
+  v->src_mode.pitch = WIDTH * 4;
+  v->src_mode.blit_format = GRUB_VIDEO_BLIT_FORMAT_RGBA_8888;
+  v->dst_mode = v->src_mode;
+  v->dst_mode.blit_format = dst_format;
+
+  *data = v;
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+rgba_init (void **data)
+{
+  return video_init (data, GRUB_VIDEO_BLIT_FORMAT_RGBA_8888);
+}
+
+static grub_err_t
+bgra_init (void **data)
+{
+  return video_init (data, GRUB_VIDEO_BLIT_FORMAT_BGRA_8888);
+}
+
+/* Font glyphs go through grub_video_blit_bitmap, which needs an active
+   render target to map the colours.  */
+static grub_err_t
+glyph_init (void **data)
+{
+  struct video_bench *v;
+  unsigned i;
+
+  v = grub_zalloc (sizeof (*v));
+  if (v == NULL)
+    return grub_errno;
+
+  if (grub_video_fb_create_render_target (&v->target,
+					  LINE_GLYPHS * GLYPH_WIDTH,
+					  GLYPH_HEIGHT,
+					  GRUB_VIDEO_MODE_TYPE_RGB
+					  | GRUB_VIDEO_MODE_TYPE_ALPHA)
+      != GRUB_ERR_NONE)
+    {
+      v->target = NULL;
+      video_fini (v);
+      return grub_errno;
+    }
+  grub_video_fb_get_active_render_target (&v->saved_target);
+  grub_video_fb_set_active_render_target (v->target);
+
+  /* The same layout grub_font_draw_glyph uses.  */
+  v->glyph.mode_info.width = GLYPH_WIDTH;
+  v->glyph.mode_info.height = GLYPH_HEIGHT;
+  v->glyph.mode_info.mode_type
+    = (1 << GRUB_VIDEO_MODE_TYPE_DEPTH_POS) | GRUB_VIDEO_MODE_TYPE_1BIT_BITMAP;
+  v->glyph.mode_info.blit_format = GRUB_VIDEO_BLIT_FORMAT_1BIT_PACKED;
+  v->glyph.mode_info.bpp = 1;
+  v->glyph.mode_info.bytes_per_pixel = 0;
+  v->glyph.mode_info.pitch = GLYPH_WIDTH;
+  v->glyph.mode_info.number_of_colors = 2;
+  v->glyph.mode_info.fg_red = 0xaa;
+  v->glyph.mode_info.fg_green = 0xaa;
+  v->glyph.mode_info.fg_blue = 0xaa;
+  v->glyph.mode_info.fg_alpha = 0xff;
+  v->glyph.data = v->glyph_data;
+
+  /* Roughly half of the pixels set.  */
+  for (i = 0; i < sizeof (v->glyph_data); i++)
+    v->glyph_data[i] = (i & 1) ? 0x3c : 0x66;
+
+  *data = v;
+  return GRUB_ERR_NONE;
+}
+
+static void
+blit (struct video_bench *v, enum grub_video_blit_operators oper)
+{
+  struct grub_video_fbblit_info src, dst;
+
+  src.mode_info = &v->src_mode;
+  src.data = (grub_uint8_t *) v->src;
+  dst.mode_info = &v->dst_mode;
+  dst.data = (grub_uint8_t *) v->dst;
+
+  grub_video_fb_dispatch_blit (&dst, &src, oper, 0, 0, WIDTH, HEIGHT, 0, 0);
+}
+
+static void
+blit_replace (void *data)
+{
+  blit (data, GRUB_VIDEO_BLIT_REPLACE);
+}
+
+static void
+blit_blend (void *data)
+{
+  blit (data, GRUB_VIDEO_BLIT_BLEND);
+}
+
+static void
+glyph_line (void *data)
+{
+  struct video_bench *v = data;
+  unsigned i;
+
+  for (i = 0; i < LINE_GLYPHS; i++)
+    grub_video_fb_blit_bitmap (&v->glyph, GRUB_VIDEO_BLIT_BLEND,
+			       i * GLYPH_WIDTH, 0, 0, 0,
+			       GLYPH_WIDTH, GLYPH_HEIGHT);
+}
+
+static struct grub_bench video_benches[] =
+  {
+    { .name = "fbblit/replace-rgba", .bytes = WIDTH * HEIGHT * 4,
+      .init = rgba_init, .run = blit_replace, .fini = video_fini },
+    { .name = "fbblit/blend-rgba", .bytes = WIDTH * HEIGHT * 4,
+      .init = rgba_init, .run = blit_blend, .fini = video_fini },
+    { .name = "fbblit/blend-bgra", .bytes = WIDTH * HEIGHT * 4,
+      .init = bgra_init, .run = blit_blend, .fini = video_fini },
+    { .name = "font/glyph-line",
+      .bytes = LINE_GLYPHS * GLYPH_WIDTH * GLYPH_HEIGHT * 4,
+      .init = glyph_init, .run = glyph_line, .fini = video_fini },
+  };
+
+GRUB_BENCHMARKS (video_bench, video_benches);
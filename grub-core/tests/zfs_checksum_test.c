@@ -0,0 +1,98 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2024  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Known-answer tests for the checksums ZFS verifies every block with.  */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/zfs/zfs.h>
+#include <grub/zfs/spa.h>
+#include <grub/zfs/zio.h>
+#include <grub/zfs/zio_checksum.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+struct checksum_vector
+{
+  void (*func) (const void *, grub_uint64_t, grub_zfs_endian_t,
+		zio_cksum_t *);
+  const char *name;
+  grub_size_t size;
+  grub_zfs_endian_t endian;
+  grub_uint64_t expected[4];
+};
+
+/* Computed over the first SIZE bytes of the pattern i * 7, or "abc"
+   when SIZE is 3.  */
+static const struct checksum_vector vectors[] =
+  {
+    { fletcher_4, "fletcher4", 1024, GRUB_ZFS_LITTLE_ENDIAN,
+      { 0x0000007f80817e00ULL, 0x00003f3bf53c5600ULL,
+	0x001520f664afcb00ULL, 0x0550c18d5fc88d00ULL } },
+    { fletcher_4, "fletcher4", 1024, GRUB_ZFS_BIG_ENDIAN,
+      { 0x0000007e81807f00ULL, 0x00003f163cf3fc80ULL,
+	0x00151d3acc00d200ULL, 0x0551ec9976883e40ULL } },
+    /* Not a multiple of four words, so the tail loop is used.  */
+    { fletcher_4, "fletcher4", 1022, GRUB_ZFS_LITTLE_ENDIAN,
+      { 0x0000007e868e921cULL, 0x00003ebc74bad800ULL,
+	0x0014e1ba6f737500ULL, 0x053ba096fb18c200ULL } },
+    { zio_checksum_SHA256, "SHA256", 1024, GRUB_ZFS_LITTLE_ENDIAN,
+      { 0x41a8df8d7a09deedULL, 0xa1ce604e394aca7eULL,
+	0x77f054f4937b3e51ULL, 0xc882a84f67de6d1dULL } },
+    { zio_checksum_SHA256, "SHA256", 1024, GRUB_ZFS_BIG_ENDIAN,
+      { 0x41a8df8d7a09deedULL, 0xa1ce604e394aca7eULL,
+	0x77f054f4937b3e51ULL, 0xc882a84f67de6d1dULL } },
+    { zio_checksum_SHA256, "SHA256", 3, GRUB_ZFS_LITTLE_ENDIAN,
+      { 0xba7816bf8f01cfeaULL, 0x414140de5dae2223ULL,
+	0xb00361a396177a9cULL, 0xb410ff61f20015adULL } },
+  };
+
+static void
+zfs_checksum_test (void)
+{
+  static grub_uint8_t buf[1024];
+  grub_size_t i;
+  unsigned j, k;
+
+  for (i = 0; i < ARRAY_SIZE (vectors); i++)
+    {
+      zio_cksum_t cksum;
+
+      if (vectors[i].size == 3)
+	grub_memcpy (buf, "abc", 3);
+      else
+	for (j = 0; j < vectors[i].size; j++)
+	  buf[j] = j * 7;
+
+      vectors[i].func (buf, vectors[i].size, vectors[i].endian, &cksum);
+      for (k = 0; k < 4; k++)
+	grub_test_assert (grub_zfs_to_cpu64 (cksum.zc_word[k],
+					     vectors[i].endian)
+			  == vectors[i].expected[k],
+			  "%s of %" PRIuGRUB_SIZE " bytes (endian %d): word %u"
+			  " is 0x%" PRIxGRUB_UINT64_T ", expected 0x%"
+			  PRIxGRUB_UINT64_T, vectors[i].name,
+			  vectors[i].size, vectors[i].endian, k,
+			  grub_zfs_to_cpu64 (cksum.zc_word[k],
+					     vectors[i].endian),
+			  vectors[i].expected[k]);
+    }
+}
+
+GRUB_FUNCTIONAL_TEST (zfs_checksum_test, zfs_checksum_test);
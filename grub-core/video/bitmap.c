@@ -22,6 +22,8 @@
 #include <grub/dl.h>
 #include <grub/mm.h>
 #include <grub/misc.h>
+#include <grub/file.h>
+#include <grub/env.h>
 #include <grub/i18n.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
@@ -74,6 +76,8 @@ grub_video_bitmap_create (struct grub_video_bitmap **bitmap,
 
   mode_info = &((*bitmap)->mode_info);
 
+  (*bitmap)->refcnt = 0;
+
   /* Populate mode_info.  */
   mode_info->width = width;
   mode_info->height = height;
@@ -159,6 +163,13 @@ grub_video_bitmap_destroy (struct grub_video_bitmap *bitmap)
   if (! bitmap)
     return GRUB_ERR_NONE;
 
+  /* Still used by the cache or another caller.  */
+  if (bitmap->refcnt)
+    {
+      bitmap->refcnt--;
+      return GRUB_ERR_NONE;
+    }
+
   grub_free (bitmap->data);
   grub_free (bitmap);
 
@@ -183,26 +194,321 @@ match_extension (const char *filename, const char *ext)
   return grub_strcasecmp (filename + pos, ext) == 0;
 }
 
+/* Decoded bitmaps are kept in a small LRU cache so that redrawing a
+   theme does not decode and scale the same files over and over.  Entries
+   are keyed on the file name, qualified with $root when it has no device,
+   the file size and modification time (when the filesystem has one), the
+   bitmap dimensions (0 x 0 for the image as stored), the scaling method
+   and the pixel format.  A hit hands out the cached bitmap itself with one
+   more reference, no data is copied.  */
+#define BITMAP_CACHE_MAX_SIZE (16 << 20)
+
+/* What identifies the contents of a file without reading it.  */
+struct bitmap_cache_key
+{
+  char *filename;
+  grub_off_t file_size;
+  grub_int64_t mtime;
+  int mtimeset;
+};
+
+struct bitmap_cache_entry
+{
+  struct bitmap_cache_entry *next;
+  struct bitmap_cache_key key;
+  unsigned int width;
+  unsigned int height;
+  int variant;
+  enum grub_video_blit_format blit_format;
+  grub_size_t size;
+  struct grub_video_bitmap *bitmap;
+};
+
+static struct bitmap_cache_entry *bitmap_cache;
+static grub_size_t bitmap_cache_size;
+
+static grub_size_t
+bitmap_data_size (struct grub_video_bitmap *bitmap)
+{
+  return (grub_size_t) bitmap->mode_info.pitch * bitmap->mode_info.height;
+}
+
+/* Context for bitmap_cache_find_mtime.  */
+struct bitmap_mtime_ctx
+{
+  const char *basename;
+  struct bitmap_cache_key *key;
+};
+
+static int
+bitmap_cache_find_mtime (const char *filename,
+                         const struct grub_dirhook_info *info, void *data)
+{
+  struct bitmap_mtime_ctx *ctx = data;
+
+  if ((info->case_insensitive ? grub_strcasecmp (filename, ctx->basename)
+       : grub_strcmp (filename, ctx->basename)) != 0)
+    return 0;
+  ctx->key->mtime = info->mtime;
+  ctx->key->mtimeset = info->mtimeset;
+  return 1;
+}
+
+/* Fill KEY for FILENAME as it would be opened now, so that the same path
+   on another root device, or a file replaced since, doesn't hit.  Returns
+   0 if the file can't be looked at.  */
+static int
+bitmap_cache_make_key (const char *filename, struct bitmap_cache_key *key)
+{
+  struct bitmap_mtime_ctx ctx;
+  grub_file_t file;
+  const char *root, *path, *base;
+  char *dir;
+
+  if (filename[0] == '(')
+    key->filename = grub_strdup (filename);
+  else
+    {
+      root = grub_env_get ("root");
+      if (! root)
+        root = "";
+      key->filename = grub_xasprintf ("(%s)%s", root, filename);
+    }
+  if (! key->filename)
+    goto fail;
+
+  file = grub_file_open (key->filename, GRUB_FILE_TYPE_GET_SIZE
+                         | GRUB_FILE_TYPE_NO_DECOMPRESS);
+  if (! file)
+    {
+      grub_free (key->filename);
+      goto fail;
+    }
+  key->file_size = file->size;
+  key->mtimeset = 0;
+
+  /* The modification time is only reported by directory listings.  */
+  path = grub_strchr (key->filename, ')');
+  base = path ? grub_strrchr (path, '/') : NULL;
+  if (file->device && file->fs && file->fs->fs_dir && base)
+    {
+      dir = grub_strndup (path + 1, base - path);
+      if (dir)
+        {
+          ctx.basename = base + 1;
+          ctx.key = key;
+          (file->fs->fs_dir) (file->device, dir, bitmap_cache_find_mtime,
+                              &ctx);
+          grub_free (dir);
+        }
+    }
+  grub_file_close (file);
+  grub_errno = GRUB_ERR_NONE;
+  return 1;
+
+ fail:
+  grub_errno = GRUB_ERR_NONE;
+  return 0;
+}
+
+static int
+bitmap_cache_key_equal (const struct bitmap_cache_key *a,
+                        const struct bitmap_cache_key *b)
+{
+  return (a->file_size == b->file_size
+          && a->mtimeset == b->mtimeset
+          && (! a->mtimeset || a->mtime == b->mtime)
+          && grub_strcmp (a->filename, b->filename) == 0);
+}
+
+static void
+bitmap_cache_free_entry (struct bitmap_cache_entry *entry)
+{
+  bitmap_cache_size -= entry->size;
+  grub_video_bitmap_destroy (entry->bitmap);
+  grub_free (entry->key.filename);
+  grub_free (entry);
+}
+
+/* Drop the entries made from an older version of KEY's file.  */
+static void
+bitmap_cache_drop_stale (const struct bitmap_cache_key *key)
+{
+  struct bitmap_cache_entry **prev, *entry;
+
+  for (prev = &bitmap_cache; (entry = *prev); )
+    if (grub_strcmp (entry->key.filename, key->filename) == 0
+        && ! bitmap_cache_key_equal (&entry->key, key))
+      {
+        *prev = entry->next;
+        bitmap_cache_free_entry (entry);
+      }
+    else
+      prev = &entry->next;
+}
+
+static struct grub_video_bitmap *
+bitmap_cache_lookup (const struct bitmap_cache_key *key, unsigned int width,
+                     unsigned int height, int variant, int any_format,
+                     enum grub_video_blit_format blit_format)
+{
+  struct bitmap_cache_entry **prev, *entry;
+
+  for (prev = &bitmap_cache; (entry = *prev); prev = &entry->next)
+    if (entry->width == width && entry->height == height
+        && entry->variant == variant
+        && (any_format || entry->blit_format == blit_format)
+        && bitmap_cache_key_equal (&entry->key, key))
+      {
+        /* Move to the front.  */
+        *prev = entry->next;
+        entry->next = bitmap_cache;
+        bitmap_cache = entry;
+
+        entry->bitmap->refcnt++;
+        return entry->bitmap;
+      }
+
+  bitmap_cache_drop_stale (key);
+  return 0;
+}
+
+/* Insert BITMAP under KEY, taking over KEY's file name.  */
+static void
+bitmap_cache_add (struct grub_video_bitmap *bitmap,
+                  struct bitmap_cache_key *key,
+                  unsigned int width, unsigned int height, int variant)
+{
+  struct bitmap_cache_entry *entry, **prev;
+  grub_size_t size;
+
+  size = bitmap_data_size (bitmap);
+  if (size > BITMAP_CACHE_MAX_SIZE / 2)
+    goto fail;
+
+  entry = grub_zalloc (sizeof (*entry));
+  if (! entry)
+    goto fail;
+  entry->key = *key;
+  entry->width = width;
+  entry->height = height;
+  entry->variant = variant;
+  entry->blit_format = bitmap->mode_info.blit_format;
+  entry->size = size;
+  entry->bitmap = bitmap;
+  bitmap->refcnt++;
+
+  entry->next = bitmap_cache;
+  bitmap_cache = entry;
+  bitmap_cache_size += size;
+
+  /* Evict from the tail until we are within budget again.  */
+  while (bitmap_cache_size > BITMAP_CACHE_MAX_SIZE)
+    {
+      for (prev = &bitmap_cache; (*prev)->next; prev = &(*prev)->next);
+      entry = *prev;
+      *prev = 0;
+      bitmap_cache_free_entry (entry);
+    }
+  return;
+
+ fail:
+  grub_free (key->filename);
+  grub_errno = GRUB_ERR_NONE;
+}
+
+/* Look up FILENAME scaled from SOURCE to WIDTH x HEIGHT with scaling
+   VARIANT.  On a hit *BITMAP gets a reference to the cached bitmap, to
+   be dropped with grub_video_bitmap_destroy.  */
+int
+grub_video_bitmap_cache_find (struct grub_video_bitmap **bitmap,
+                              const char *filename,
+                              struct grub_video_bitmap *source,
+                              unsigned int width, unsigned int height,
+                              int variant)
+{
+  struct bitmap_cache_key key;
+
+  *bitmap = 0;
+  if (! bitmap_cache_make_key (filename, &key))
+    return 0;
+  *bitmap = bitmap_cache_lookup (&key, width, height, variant, 0,
+                                 source->mode_info.blit_format);
+  grub_free (key.filename);
+  return *bitmap != 0;
+}
+
+/* Keep a reference to BITMAP.  Failures are silently ignored, the cache
+   is only an optimization.  */
+void
+grub_video_bitmap_cache_insert (struct grub_video_bitmap *bitmap,
+                                const char *filename,
+                                unsigned int width, unsigned int height,
+                                int variant)
+{
+  struct bitmap_cache_key key;
+
+  if (bitmap && bitmap_cache_make_key (filename, &key))
+    bitmap_cache_add (bitmap, &key, width, height, variant);
+}
+
+/* Drop every cached bitmap.  */
+void
+grub_video_bitmap_cache_flush (void)
+{
+  struct bitmap_cache_entry *entry;
+
+  while ((entry = bitmap_cache))
+    {
+      bitmap_cache = entry->next;
+      bitmap_cache_free_entry (entry);
+    }
+}
+
 /* Loads bitmap using registered bitmap readers.  */
 grub_err_t
 grub_video_bitmap_load (struct grub_video_bitmap **bitmap,
                         const char *filename)
 {
   grub_video_bitmap_reader_t reader = bitmap_readers_list;
+  struct bitmap_cache_key key;
+  int have_key;
+  grub_err_t err;
 
   if (!bitmap)
     return grub_error (GRUB_ERR_BUG, "invalid argument");
 
   *bitmap = 0;
 
+  /* Readers pick the format themselves, so any cached one will do.  */
+  have_key = bitmap_cache_make_key (filename, &key);
+  if (have_key)
+    {
+      *bitmap = bitmap_cache_lookup (&key, 0, 0, 0, 1, 0);
+      if (*bitmap)
+        {
+          grub_free (key.filename);
+          return GRUB_ERR_NONE;
+        }
+    }
+
   while (reader)
     {
       if (match_extension (filename, reader->extension))
-        return reader->reader (bitmap, filename);
+        {
+          err = reader->reader (bitmap, filename);
+          if (err == GRUB_ERR_NONE && have_key)
+            bitmap_cache_add (*bitmap, &key, 0, 0, 0);
+          else if (have_key)
+            grub_free (key.filename);
+          return err;
+        }
 
       reader = reader->next;
     }
 
+  if (have_key)
+    grub_free (key.filename);
   return grub_error (GRUB_ERR_BAD_FILE_TYPE,
 		     /* TRANSLATORS: We're speaking about bitmap images like
 			JPEG or PNG.  */
@@ -229,3 +535,8 @@ void *grub_video_bitmap_get_data (struct grub_video_bitmap *bitmap)
   return bitmap->data;
 }
 
+
+GRUB_MOD_FINI (bitmap)
+{
+  grub_video_bitmap_cache_flush ();
+}
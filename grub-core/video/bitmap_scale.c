@@ -122,6 +122,50 @@ grub_video_bitmap_create_scaled (struct grub_video_bitmap **dst,
     }
 }
 
+grub_err_t
+grub_video_bitmap_load_scaled (struct grub_video_bitmap **dst,
+                               const char *filename,
+                               int dst_width, int dst_height,
+                               enum grub_video_bitmap_scale_method
+                               scale_method)
+{
+  struct grub_video_bitmap *raw;
+  grub_err_t err;
+
+  *dst = 0;
+
+  if (dst_width <= 0 || dst_height <= 0)
+    return grub_error (GRUB_ERR_BUG,
+                       "requested to scale to a size w/ a zero dimension");
+
+  /* Usually a cache hit as well, and needed for its format.  */
+  err = grub_video_bitmap_load (&raw, filename);
+  if (err != GRUB_ERR_NONE)
+    return err;
+
+  if (grub_video_bitmap_cache_find (dst, filename, raw, dst_width, dst_height,
+                                    scale_method + 1))
+    {
+      grub_video_bitmap_destroy (raw);
+      return GRUB_ERR_NONE;
+    }
+
+  if (raw->mode_info.width == (unsigned) dst_width
+      && raw->mode_info.height == (unsigned) dst_height)
+    {
+      *dst = raw;
+      return GRUB_ERR_NONE;
+    }
+
+  err = grub_video_bitmap_create_scaled (dst, dst_width, dst_height, raw,
+                                         scale_method);
+  grub_video_bitmap_destroy (raw);
+  if (err == GRUB_ERR_NONE)
+    grub_video_bitmap_cache_insert (*dst, filename, dst_width, dst_height,
+                                    scale_method + 1);
+  return err;
+}
+
 static grub_err_t
 make_h_align (unsigned *x, unsigned *w, unsigned new_w,
               grub_video_bitmap_h_align_t h_align)
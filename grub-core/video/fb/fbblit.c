@@ -759,7 +759,9 @@ grub_video_fbblit_blend_8bit_indexa (struct grub_video_fbblit_info *dst,
 }
 
 
-/* Optimized replacing blitter for RGBX8888 to BGRX8888.  */
+/* Optimized replacing blitter for RGBX8888 to BGRX8888.  Both formats
+   keep green and alpha in the same place, so each pixel is converted as a
+   whole word by exchanging the red and blue bytes.  */
 static void
 grub_video_fbblit_replace_BGRX8888_RGBX8888 (struct grub_video_fbblit_info *dst,
 					     struct grub_video_fbblit_info *src,
@@ -769,8 +771,8 @@ grub_video_fbblit_replace_BGRX8888_RGBX8888 (struct grub_video_fbblit_info *dst,
 {
   int i;
   int j;
-  grub_uint8_t *srcptr;
-  grub_uint8_t *dstptr;
+  grub_uint32_t *srcptr;
+  grub_uint32_t *dstptr;
   unsigned int srcrowskip;
   unsigned int dstrowskip;
 
@@ -786,29 +788,15 @@ grub_video_fbblit_replace_BGRX8888_RGBX8888 (struct grub_video_fbblit_info *dst,
     {
       for (i = 0; i < width; i++)
         {
-#ifdef GRUB_CPU_WORDS_BIGENDIAN
-          grub_uint8_t a = *srcptr++;
-#endif
-          grub_uint8_t r = *srcptr++;
-          grub_uint8_t g = *srcptr++;
-          grub_uint8_t b = *srcptr++;
-#ifndef GRUB_CPU_WORDS_BIGENDIAN
-          grub_uint8_t a = *srcptr++;
-#endif
+          grub_uint32_t color = *srcptr++;
 
-#ifdef GRUB_CPU_WORDS_BIGENDIAN
-          *dstptr++ = a;
-#endif
-          *dstptr++ = b;
-          *dstptr++ = g;
-          *dstptr++ = r;
-#ifndef GRUB_CPU_WORDS_BIGENDIAN
-          *dstptr++ = a;
-#endif
+          *dstptr++ = (color & 0xFF00FF00)
+            | ((color << 16) & 0x00FF0000)
+            | ((color >> 16) & 0x000000FF);
         }
 
-      srcptr += srcrowskip;
-      dstptr += dstrowskip;
+      GRUB_VIDEO_FB_ADVANCE_POINTER (srcptr, srcrowskip);
+      GRUB_VIDEO_FB_ADVANCE_POINTER (dstptr, dstrowskip);
     }
 }
 
@@ -1159,6 +1147,20 @@ alpha_dilute (grub_uint8_t bg, grub_uint8_t fg, grub_uint8_t alpha)
   return h;
 }
 
+/* Same as alpha_dilute, but for two channels at once.  BG and FG carry the
+   channels in bits 0-7 and 16-23 (mask 0x00FF00FF), so that the 16-bit
+   intermediate products of both never overlap.  The result is in the same
+   layout and is bit-identical to calling alpha_dilute per channel.  */
+static inline grub_uint32_t
+alpha_dilute_2x8 (grub_uint32_t bg, grub_uint32_t fg, grub_uint32_t alpha)
+{
+  grub_uint32_t s;
+  s = (fg * alpha) + (bg * (255 ^ alpha));
+  /* Division by 255 of both halves: (s + 1 + (s >> 8)) >> 8.  */
+  s += 0x00010001 + ((s >> 8) & 0x00FF00FF);
+  return (s >> 8) & 0x00FF00FF;
+}
+
 /* Generic blending blitter.  Works for every supported format.  */
 static void
 grub_video_fbblit_blend (struct grub_video_fbblit_info *dst,
@@ -1245,13 +1247,11 @@ grub_video_fbblit_blend_BGRA8888_RGBA8888 (struct grub_video_fbblit_info *dst,
       for (i = 0; i < width; i++)
         {
           grub_uint32_t color;
-          unsigned int sr;
+          grub_uint32_t srb;
+          grub_uint32_t drb;
           unsigned int sg;
-          unsigned int sb;
-          unsigned int a;
-          unsigned int dr;
           unsigned int dg;
-          unsigned int db;
+          unsigned int a;
 
           color = *srcptr++;
 
@@ -1264,33 +1264,24 @@ grub_video_fbblit_blend_BGRA8888_RGBA8888 (struct grub_video_fbblit_info *dst,
               continue;
             }
 
-          sr = (color >> 0) & 0xFF;
-          sg = (color >> 8) & 0xFF;
-          sb = (color >> 16) & 0xFF;
+          /* Red and blue swap places between the two formats.  */
+          srb = ((color << 16) & 0x00FF0000) | ((color >> 16) & 0xFF);
+          sg = color & 0xFF00;
 
           if (a == 255)
             {
               /* Opaque pixel shortcut.  */
-              dr = sr;
-              dg = sg;
-              db = sb;
+              *dstptr++ = 0xFF000000 | srb | sg;
+              continue;
             }
-          else
-            {
-              /* General pixel color blending.  */
-              color = *dstptr;
 
-              dr = (color >> 16) & 0xFF;
-              dr = alpha_dilute (dr, sr, a);
-              dg = (color >> 8) & 0xFF;
-              dg = alpha_dilute (dg, sg, a);
-              db = (color >> 0) & 0xFF;
-              db = alpha_dilute (db, sb, a);
-            }
+          /* General pixel color blending, red and blue together.  */
+          color = *dstptr;
 
-          color = (a << 24) | (dr << 16) | (dg << 8) | db;
+          drb = alpha_dilute_2x8 (color & 0x00FF00FF, srb, a);
+          dg = alpha_dilute ((color >> 8) & 0xFF, sg >> 8, a);
 
-          *dstptr++ = color;
+          *dstptr++ = (a << 24) | drb | (dg << 8);
         }
 
       GRUB_VIDEO_FB_ADVANCE_POINTER (srcptr, srcrowskip);
@@ -1405,13 +1396,9 @@ grub_video_fbblit_blend_RGBA8888_RGBA8888 (struct grub_video_fbblit_info *dst,
   int j;
   grub_uint32_t *srcptr;
   grub_uint32_t *dstptr;
-  unsigned int sr;
-  unsigned int sg;
-  unsigned int sb;
   unsigned int a;
-  unsigned int dr;
+  grub_uint32_t drb;
   unsigned int dg;
-  unsigned int db;
   grub_size_t srcrowskip;
   grub_size_t dstrowskip;
 
@@ -1441,23 +1428,11 @@ grub_video_fbblit_blend_RGBA8888_RGBA8888 (struct grub_video_fbblit_info *dst,
               continue;
             }
 
-          sr = (color >> 0) & 0xFF;
-          sg = (color >> 8) & 0xFF;
-          sb = (color >> 16) & 0xFF;
-
-          color = *dstptr;
-
-          dr = (color >> 0) & 0xFF;
-          dg = (color >> 8) & 0xFF;
-          db = (color >> 16) & 0xFF;
-
-          dr = alpha_dilute (dr, sr, a);
-          dg = alpha_dilute (dg, sg, a);
-          db = alpha_dilute (db, sb, a);
+          /* Red and blue are blended together, green on its own.  */
+          drb = alpha_dilute_2x8 (*dstptr & 0x00FF00FF, color & 0x00FF00FF, a);
+          dg = alpha_dilute ((*dstptr >> 8) & 0xFF, (color >> 8) & 0xFF, a);
 
-          color = (a << 24) | (db << 16) | (dg << 8) | dr;
-
-          *dstptr++ = color;
+          *dstptr++ = (a << 24) | (dg << 8) | drb;
         }
       GRUB_VIDEO_FB_ADVANCE_POINTER (srcptr, srcrowskip);
       GRUB_VIDEO_FB_ADVANCE_POINTER (dstptr, dstrowskip);
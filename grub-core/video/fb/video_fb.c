@@ -31,10 +31,17 @@ GRUB_MOD_LICENSE ("GPLv3+");
 typedef grub_err_t (*grub_video_fb_doublebuf_update_screen_t) (void);
 typedef volatile void *framebuf_t;
 
+/* Upper bound on the number of separate rectangles tracked per frame.
+   Once reached, new damage is merged into the rectangle that grows the
+   least by absorbing it.  */
+#define DIRTY_MAX_RECTS 16
+
+/* Areas of the back buffer changed since the last screen update.  The
+   rectangles never overlap or share an edge.  */
 struct dirty
 {
-  int first_line;
-  int last_line;
+  unsigned int count;
+  struct grub_video_rect rects[DIRTY_MAX_RECTS];
 };
 
 static struct
@@ -55,6 +62,8 @@ static struct
   grub_video_fb_set_page_t set_page;
   char *offscreen_buffer;
   grub_video_fb_doublebuf_update_screen_t update_screen;
+
+  struct grub_video_fb_update_stats stats;
 } framebuffer;
 
 /* Specify "standard" VGA palette, some video cards may
@@ -830,14 +839,158 @@ grub_video_fb_unmap_color_int (struct grub_video_fbblit_info * source,
 }
 
 static void
-dirty (int y, int height)
+dirty_reset (struct dirty *d)
+{
+  d->count = 0;
+}
+
+static inline grub_uint64_t
+rect_area (const struct grub_video_rect *r)
+{
+  return (grub_uint64_t) r->width * r->height;
+}
+
+/* Nonzero if A and B overlap or share a piece of an edge.  Rectangles
+   meeting only at a corner are kept apart, their union would cover two
+   undamaged areas.  */
+static inline int
+rect_touch (const struct grub_video_rect *a, const struct grub_video_rect *b)
+{
+  int x_overlap = (a->x < b->x + b->width && b->x < a->x + a->width);
+  int y_overlap = (a->y < b->y + b->height && b->y < a->y + a->height);
+  int x_touch = (a->x <= b->x + b->width && b->x <= a->x + a->width);
+  int y_touch = (a->y <= b->y + b->height && b->y <= a->y + a->height);
+
+  return (x_overlap && y_touch) || (x_touch && y_overlap);
+}
+
+static void
+rect_union (struct grub_video_rect *res, const struct grub_video_rect *a,
+	    const struct grub_video_rect *b)
+{
+  unsigned x1, y1, x2, y2;
+
+  x1 = grub_min (a->x, b->x);
+  y1 = grub_min (a->y, b->y);
+  x2 = grub_max (a->x + a->width, b->x + b->width);
+  y2 = grub_max (a->y + a->height, b->y + b->height);
+  res->x = x1;
+  res->y = y1;
+  res->width = x2 - x1;
+  res->height = y2 - y1;
+}
+
+static void
+dirty_add (struct dirty *d, const struct grub_video_rect *rect)
+{
+  struct grub_video_rect r = *rect;
+  unsigned int i;
+
+ again:
+  /* Absorb every rectangle the new one touches.  The union may reach
+     further ones, so start over after each merge.  */
+  for (i = 0; i < d->count; i++)
+    if (rect_touch (&d->rects[i], &r))
+      {
+	rect_union (&r, &r, &d->rects[i]);
+	d->rects[i] = d->rects[--d->count];
+	goto again;
+      }
+
+  if (d->count < DIRTY_MAX_RECTS)
+    {
+      d->rects[d->count++] = r;
+      return;
+    }
+
+  /* No room left.  Merge with the rectangle costing the fewest extra
+     pixels and re-add the result, which may now touch others.  */
+  {
+    unsigned int best = 0;
+    grub_uint64_t best_growth = ~(grub_uint64_t) 0;
+    struct grub_video_rect u;
+
+    for (i = 0; i < d->count; i++)
+      {
+	grub_uint64_t growth;
+
+	rect_union (&u, &d->rects[i], &r);
+	growth = rect_area (&u) - rect_area (&d->rects[i]);
+	if (growth < best_growth)
+	  {
+	    best_growth = growth;
+	    best = i;
+	  }
+      }
+    rect_union (&r, &d->rects[best], &r);
+    d->rects[best] = d->rects[--d->count];
+    goto again;
+  }
+}
+
+static void
+dirty (int x, int y, int width, int height)
 {
+  struct grub_video_rect r;
+
   if (framebuffer.render_target != framebuffer.back_target)
     return;
-  if (framebuffer.current_dirty.first_line > y)
-    framebuffer.current_dirty.first_line = y;
-  if (framebuffer.current_dirty.last_line < y + height)
-    framebuffer.current_dirty.last_line = y + height;
+  if (width <= 0 || height <= 0)
+    return;
+
+  r.x = x;
+  r.y = y;
+  r.width = width;
+  r.height = height;
+  dirty_add (&framebuffer.current_dirty, &r);
+}
+
+/* Copy the areas listed in D from the back buffer to PAGE.  */
+static void
+dirty_copy (framebuf_t page, const struct dirty *d)
+{
+  struct grub_video_mode_info *mode_info = &framebuffer.back_target->mode_info;
+  grub_size_t bytes = 0;
+  unsigned int i, line;
+
+  for (i = 0; i < d->count; i++)
+    {
+      const struct grub_video_rect *r = &d->rects[i];
+      grub_size_t offset = r->y * mode_info->pitch
+	+ r->x * mode_info->bytes_per_pixel;
+      grub_size_t len = r->width * mode_info->bytes_per_pixel;
+
+      if (r->x == 0 && r->width == mode_info->width)
+	{
+	  /* Whole lines: one contiguous copy.  */
+	  len = r->height * mode_info->pitch;
+	  grub_memcpy ((char *) page + offset,
+		       (char *) framebuffer.back_target->data + offset, len);
+	  bytes += len;
+	  continue;
+	}
+
+      for (line = 0; line < r->height; line++)
+	{
+	  grub_memcpy ((char *) page + offset,
+		       (char *) framebuffer.back_target->data + offset, len);
+	  offset += mode_info->pitch;
+	}
+      bytes += len * r->height;
+    }
+
+  framebuffer.stats.frames++;
+  framebuffer.stats.rects += d->count;
+  framebuffer.stats.bytes += bytes;
+  framebuffer.stats.last_frame_bytes = bytes;
+  grub_dprintf ("video_fb", "screen update: %u rectangles, %" PRIuGRUB_SIZE
+		" bytes\n", d->count, bytes);
+}
+
+void
+grub_video_fb_get_update_stats (struct grub_video_fb_update_stats *stats)
+{
+  *stats = framebuffer.stats;
 }
 
 grub_err_t
@@ -895,7 +1048,7 @@ grub_video_fb_fill_rect (grub_video_color_t color, int x, int y,
   x += area_x;
   y += area_y;
 
-  dirty (y, height);
+  dirty (x, y, width, height);
 
   /* Use fbblit_info to encapsulate rendering.  */
   target.mode_info = &framebuffer.render_target->mode_info;
@@ -1008,7 +1161,7 @@ grub_video_fb_blit_source (struct grub_video_fbblit_info *source,
   target.data = framebuffer.render_target->data;
 
   /* Do actual blitting.  */
-  dirty (y, height);
+  dirty (x, y, width, height);
   grub_video_fb_dispatch_blit (&target, source, oper, x, y, width, height,
                                offset_x, offset_y);
 
@@ -1060,7 +1213,9 @@ grub_video_fb_scroll (grub_video_color_t color, int dx, int dy)
   width = framebuffer.render_target->viewport.width - grub_abs (dx);
   height = framebuffer.render_target->viewport.height - grub_abs (dy);
 
-  dirty (framebuffer.render_target->viewport.y,
+  dirty (framebuffer.render_target->viewport.x,
+	 framebuffer.render_target->viewport.y,
+	 framebuffer.render_target->viewport.width,
 	 framebuffer.render_target->viewport.height);
 
   if (dx < 0)
@@ -1415,20 +1570,8 @@ grub_video_fb_get_active_render_target (struct grub_video_fbrender_target **targ
 static grub_err_t
 doublebuf_blit_update_screen (void)
 {
-  if (framebuffer.current_dirty.first_line
-      <= framebuffer.current_dirty.last_line)
-    grub_memcpy ((char *) framebuffer.pages[0]
-		 + framebuffer.current_dirty.first_line
-		 * framebuffer.back_target->mode_info.pitch,
-		 (char *) framebuffer.back_target->data
-		 + framebuffer.current_dirty.first_line
-		 * framebuffer.back_target->mode_info.pitch,
-		 framebuffer.back_target->mode_info.pitch
-		 * (framebuffer.current_dirty.last_line
-		    - framebuffer.current_dirty.first_line));
-  framebuffer.current_dirty.first_line
-    = framebuffer.back_target->mode_info.height;
-  framebuffer.current_dirty.last_line = 0;
+  dirty_copy (framebuffer.pages[0], &framebuffer.current_dirty);
+  dirty_reset (&framebuffer.current_dirty);
 
   return GRUB_ERR_NONE;
 }
@@ -1461,8 +1604,8 @@ grub_video_fb_doublebuf_blit_init (struct grub_video_fbrender_target **back,
   framebuffer.pages[0] = framebuf;
   framebuffer.displayed_page = 0;
   framebuffer.render_page = 0;
-  framebuffer.current_dirty.first_line = mode_info.height;
-  framebuffer.current_dirty.last_line = 0;
+  dirty_reset (&framebuffer.current_dirty);
+  grub_memset (&framebuffer.stats, 0, sizeof (framebuffer.stats));
 
   return GRUB_ERR_NONE;
 }
@@ -1472,26 +1615,18 @@ doublebuf_pageflipping_update_screen (void)
 {
   int new_displayed_page;
   grub_err_t err;
-  int first_line, last_line;
-
-  first_line = framebuffer.current_dirty.first_line;
-  last_line = framebuffer.current_dirty.last_line;
-  if (first_line > framebuffer.previous_dirty.first_line)
-    first_line = framebuffer.previous_dirty.first_line;
-  if (last_line < framebuffer.previous_dirty.last_line)
-    last_line = framebuffer.previous_dirty.last_line;
-
-  if (first_line <= last_line)
-    grub_memcpy ((char *) framebuffer.pages[framebuffer.render_page]
-		 + first_line * framebuffer.back_target->mode_info.pitch,
-		 (char *) framebuffer.back_target->data
-		 + first_line * framebuffer.back_target->mode_info.pitch,
-		 framebuffer.back_target->mode_info.pitch
-		 * (last_line - first_line));
+  struct dirty both;
+  unsigned int i;
+
+  /* The page about to be drawn still shows the frame before the previous
+     one, so it misses the changes of both frames.  */
+  both = framebuffer.current_dirty;
+  for (i = 0; i < framebuffer.previous_dirty.count; i++)
+    dirty_add (&both, &framebuffer.previous_dirty.rects[i]);
+
+  dirty_copy (framebuffer.pages[framebuffer.render_page], &both);
   framebuffer.previous_dirty = framebuffer.current_dirty;
-  framebuffer.current_dirty.first_line
-    = framebuffer.back_target->mode_info.height;
-  framebuffer.current_dirty.last_line = 0;
+  dirty_reset (&framebuffer.current_dirty);
 
   /* Swap the page numbers in the framebuffer struct.  */
   new_displayed_page = framebuffer.render_page;
@@ -1544,12 +1679,9 @@ doublebuf_pageflipping_init (struct grub_video_mode_info *mode_info,
   framebuffer.pages[0] = page0_ptr;
   framebuffer.pages[1] = page1_ptr;
 
-  framebuffer.current_dirty.first_line
-    = framebuffer.back_target->mode_info.height;
-  framebuffer.current_dirty.last_line = 0;
-  framebuffer.previous_dirty.first_line
-    = framebuffer.back_target->mode_info.height;
-  framebuffer.previous_dirty.last_line = 0;
+  dirty_reset (&framebuffer.current_dirty);
+  dirty_reset (&framebuffer.previous_dirty);
+  grub_memset (&framebuffer.stats, 0, sizeof (framebuffer.stats));
 
   /* Set the framebuffer memory data pointer and display the right page.  */
   err = set_page_in (framebuffer.displayed_page);
@@ -1635,9 +1767,8 @@ grub_video_fb_setup (unsigned int mode_type, unsigned int mode_mask,
   framebuffer.displayed_page = 0;
   framebuffer.render_page = 0;
   framebuffer.set_page = 0;
-  framebuffer.current_dirty.first_line
-    = framebuffer.back_target->mode_info.height;
-  framebuffer.current_dirty.last_line = 0;
+  dirty_reset (&framebuffer.current_dirty);
+  grub_memset (&framebuffer.stats, 0, sizeof (framebuffer.stats));
 
   mode_info->mode_type &= ~GRUB_VIDEO_MODE_TYPE_DOUBLE_BUFFERED;
 
@@ -523,49 +523,56 @@ grub_jpeg_decode_du (struct grub_jpeg_data *data, int id, jpeg_data_unit_t du)
   grub_jpeg_idct_transform (du);
 }
 
+/* Chroma contributions to each colour channel, indexed by the 0..255
+   sample value.  Green keeps the unshifted products so that it is rounded
+   exactly as the direct computation would be.  */
+static int jpeg_cr_red[256];
+static int jpeg_cb_blue[256];
+static int jpeg_cr_green[256];
+static int jpeg_cb_green[256];
+
 static void
-grub_jpeg_ycrcb_to_rgb (int yy, int cr, int cb, grub_uint8_t * rgb)
+grub_jpeg_init_color_tables (void)
 {
-  int dd;
+  int i;
 
-  cr -= 128;
-  cb -= 128;
+  for (i = 0; i < 256; i++)
+    {
+      jpeg_cr_red[i] = ((i - 128) * CONST (1.402)) >> SHIFT_BITS;
+      jpeg_cb_blue[i] = ((i - 128) * CONST (1.772)) >> SHIFT_BITS;
+      jpeg_cr_green[i] = (i - 128) * CONST (0.71414);
+      jpeg_cb_green[i] = (i - 128) * CONST (0.34414);
+    }
+}
 
-  /* Red  */
-  dd = yy + ((cr * CONST (1.402)) >> SHIFT_BITS);
+static inline grub_uint8_t
+grub_jpeg_clamp (int dd)
+{
   if (dd < 0)
-    dd = 0;
+    return 0;
   if (dd > 255)
-    dd = 255;
-#ifdef GRUB_CPU_WORDS_BIGENDIAN
-  rgb[2] = dd;
-#else
-  *(rgb++) = dd;
-#endif
+    return 255;
+  return dd;
+}
 
-  /* Green  */
-  dd = yy - ((cb * CONST (0.34414) + cr * CONST (0.71414)) >> SHIFT_BITS);
-  if (dd < 0)
-    dd = 0;
-  if (dd > 255)
-    dd = 255;
-#ifdef GRUB_CPU_WORDS_BIGENDIAN
-  rgb[1] = dd;
-#else
-  *(rgb++) = dd;
-#endif
+static void
+grub_jpeg_ycrcb_to_rgb (int yy, int cr, int cb, grub_uint8_t * rgb)
+{
+  grub_uint8_t r, g, b;
+
+  r = grub_jpeg_clamp (yy + jpeg_cr_red[cr]);
+  g = grub_jpeg_clamp (yy - ((jpeg_cb_green[cb] + jpeg_cr_green[cr])
+			     >> SHIFT_BITS));
+  b = grub_jpeg_clamp (yy + jpeg_cb_blue[cb]);
 
-  /* Blue  */
-  dd = yy + ((cb * CONST (1.772)) >> SHIFT_BITS);
-  if (dd < 0)
-    dd = 0;
-  if (dd > 255)
-    dd = 255;
 #ifdef GRUB_CPU_WORDS_BIGENDIAN
-  rgb[0] = dd;
-  rgb += 3;
+  rgb[0] = b;
+  rgb[1] = g;
+  rgb[2] = r;
 #else
-  *(rgb++) = dd;
+  rgb[0] = r;
+  rgb[1] = g;
+  rgb[2] = b;
 #endif
 }
 
@@ -835,6 +842,7 @@ static struct grub_video_bitmap_reader jpeg_reader = {
 
 GRUB_MOD_INIT (jpeg)
 {
+  grub_jpeg_init_color_tables ();
   grub_video_bitmap_reader_register (&jpg_reader);
   grub_video_bitmap_reader_register (&jpeg_reader);
 #if defined(JPEG_DEBUG)
@@ -23,6 +23,9 @@
 #include <grub/mm.h>
 #include <grub/misc.h>
 #include <grub/bufio.h>
+#include <grub/deflate.h>
+#include <grub/i18n.h>
+#include <grub/safemath.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
@@ -60,41 +63,15 @@ enum
     PNG_CHUNK_PLTE = 0x504c5445
   };
 
-#define Z_DEFLATED		8
-#define Z_FLAG_DICT		32
-
-#define INFLATE_STORED		0
-#define INFLATE_FIXED		1
-#define INFLATE_DYNAMIC		2
-
-#define WSIZE			0x8000
-
-#define DEFLATE_HCLEN_BASE	4
-#define DEFLATE_HCLEN_MAX	19
-#define DEFLATE_HLIT_BASE	257
-#define DEFLATE_HLIT_MAX	288
-#define DEFLATE_HDIST_BASE	1
-#define DEFLATE_HDIST_MAX	30
-
-#define DEFLATE_HUFF_LEN	16
-
 #ifdef PNG_DEBUG
 static grub_command_t cmd;
 #endif
 
-struct huff_table
-{
-  int *values, *maxval, *offset;
-  int num_values, max_length;
-};
-
 struct grub_png_data
 {
   grub_file_t file;
   struct grub_video_bitmap **bitmap;
 
-  int bit_count, bit_save;
-
   grub_uint32_t next_offset;
 
   unsigned image_width, image_height;
@@ -103,27 +80,13 @@ struct grub_png_data
   int row_bytes, color_bits;
   grub_uint8_t *image_data;
 
-  int inside_idat, idat_remain;
-
-  int code_values[DEFLATE_HLIT_MAX];
-  int code_maxval[DEFLATE_HUFF_LEN];
-  int code_offset[DEFLATE_HUFF_LEN];
-
-  int dist_values[DEFLATE_HDIST_MAX];
-  int dist_maxval[DEFLATE_HUFF_LEN];
-  int dist_offset[DEFLATE_HUFF_LEN];
+  /* Compressed image data gathered from all IDAT chunks.  */
+  grub_uint8_t *idat;
+  grub_size_t idat_size, idat_alloc;
 
   grub_uint8_t palette[256][3];
 
-  struct huff_table code_table;
-  struct huff_table dist_table;
-
-  grub_uint8_t slide[WSIZE];
-  int wp;
-
   grub_uint8_t *cur_rgb;
-
-  int cur_column, cur_filter, first_line;
 };
 
 static grub_uint32_t
@@ -142,85 +105,12 @@ grub_png_get_byte (struct grub_png_data *data)
 {
   grub_uint8_t r;
 
-  if ((data->inside_idat) && (data->idat_remain == 0))
-    {
-      grub_uint32_t len, type;
-
-      do
-	{
-          /* Skip crc checksum.  */
-	  grub_png_get_dword (data);
-
-          if (data->file->offset != data->next_offset)
-            {
-              grub_error (GRUB_ERR_BAD_FILE_TYPE,
-                          "png: chunk size error");
-              return 0;
-            }
-
-	  len = grub_png_get_dword (data);
-	  type = grub_png_get_dword (data);
-	  if (type != PNG_CHUNK_IDAT)
-	    {
-	      grub_error (GRUB_ERR_BAD_FILE_TYPE,
-			  "png: unexpected end of data");
-	      return 0;
-	    }
-
-          data->next_offset = data->file->offset + len + 4;
-	}
-      while (len == 0);
-      data->idat_remain = len;
-    }
-
   r = 0;
   grub_file_read (data->file, &r, 1);
 
-  if (data->inside_idat)
-    data->idat_remain--;
-
   return r;
 }
 
-static int
-grub_png_get_bits (struct grub_png_data *data, int num)
-{
-  int code, shift;
-
-  if (data->bit_count == 0)
-    {
-      data->bit_save = grub_png_get_byte (data);
-      data->bit_count = 8;
-    }
-
-  code = 0;
-  shift = 0;
-  while (grub_errno == 0)
-    {
-      int n;
-
-      n = data->bit_count;
-      if (n > num)
-	n = num;
-
-      code += (int) (data->bit_save & ((1 << n) - 1)) << shift;
-      num -= n;
-      if (!num)
-	{
-	  data->bit_count -= n;
-	  data->bit_save >>= n;
-	  break;
-	}
-
-      shift += n;
-
-      data->bit_save = grub_png_get_byte (data);
-      data->bit_count = 8;
-    }
-
-  return code;
-}
-
 static grub_err_t
 grub_png_decode_image_palette (struct grub_png_data *data,
 			       unsigned len)
@@ -325,9 +215,6 @@ grub_png_decode_image_header (struct grub_png_data *data)
 
   data->raw_bytes = data->image_height * (data->row_bytes + 1);
 
-  data->cur_column = 0;
-  data->first_line = 1;
-
   if (grub_png_get_byte (data) != PNG_COMPRESSION_BASE)
     return grub_error (GRUB_ERR_BAD_FILE_TYPE,
 		       "png: compression method not supported");
@@ -346,469 +233,183 @@ grub_png_decode_image_header (struct grub_png_data *data)
   return grub_errno;
 }
 
-/* Order of the bit length code lengths.  */
-static const grub_uint8_t bitorder[] = {
-  16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
-};
-
-/* Copy lengths for literal codes 257..285.  */
-static const int cplens[] = {
-  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
-  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258, 0, 0
-};
-
-/* Extra bits for literal codes 257..285.  */
-static const grub_uint8_t cplext[] = {
-  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
-  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0, 99, 99
-};				/* 99==invalid  */
-
-/* Copy offsets for distance codes 0..29.  */
-static const int cpdist[] = {
-  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
-  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
-  8193, 12289, 16385, 24577
-};
-
-/* Extra bits for distance codes.  */
-static const grub_uint8_t cpdext[] = {
-  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
-  7, 7, 8, 8, 9, 9, 10, 10, 11, 11,
-  12, 12, 13, 13
-};
-
-static void
-grub_png_init_huff_table (struct huff_table *ht, int cur_maxlen,
-			  int *cur_values, int *cur_maxval, int *cur_offset)
-{
-  ht->values = cur_values;
-  ht->maxval = cur_maxval;
-  ht->offset = cur_offset;
-  ht->num_values = 0;
-  ht->max_length = cur_maxlen;
-  grub_memset (cur_maxval, 0, sizeof (int) * cur_maxlen);
-}
-
-static void
-grub_png_insert_huff_item (struct huff_table *ht, int code, int len)
+/* Append the contents of an IDAT chunk of LEN bytes to the compressed
+   image data.  The stream is inflated in one go once all of it is in.  */
+static grub_err_t
+grub_png_read_image_data (struct grub_png_data *data, grub_uint32_t len)
 {
-  int i, n;
-
-  if (len == 0)
-    return;
-
-  if (len > ht->max_length)
-    {
-      grub_error (GRUB_ERR_BAD_FILE_TYPE, "png: invalid code length");
-      return;
-    }
-
-  n = 0;
-  for (i = len; i < ht->max_length; i++)
-    n += ht->maxval[i];
-
-  for (i = 0; i < n; i++)
-    ht->values[ht->num_values - i] = ht->values[ht->num_values - i - 1];
+  grub_off_t file_size;
+  grub_size_t need;
 
-  ht->values[ht->num_values - n] = code;
-  ht->num_values++;
-  ht->maxval[len - 1]++;
-}
+  /* The length comes from the file, don't let it make us allocate more
+     than the file could possibly hold.  */
+  file_size = grub_file_size (data->file);
+  if (file_size != GRUB_FILE_SIZE_UNKNOWN
+      && len > file_size - grub_file_tell (data->file))
+    return grub_error (GRUB_ERR_BAD_FILE_TYPE, "png: chunk too large");
 
-static void
-grub_png_build_huff_table (struct huff_table *ht)
-{
-  int base, ofs, i;
+  if (grub_add (data->idat_size, len, &need))
+    return grub_error (GRUB_ERR_OUT_OF_RANGE, N_("overflow is detected"));
 
-  base = 0;
-  ofs = 0;
-  for (i = 0; i < ht->max_length; i++)
+  if (need > data->idat_alloc)
     {
-      base += ht->maxval[i];
-      ofs += ht->maxval[i];
+      grub_size_t new_alloc;
+      grub_uint8_t *new_idat;
 
-      ht->maxval[i] = base;
-      ht->offset[i] = ofs - base;
+      new_alloc = data->idat_alloc ? data->idat_alloc : 0x10000;
+      while (new_alloc < need)
+	if (grub_mul (new_alloc, 2, &new_alloc))
+	  return grub_error (GRUB_ERR_OUT_OF_RANGE, N_("overflow is detected"));
 
-      base <<= 1;
+      new_idat = grub_realloc (data->idat, new_alloc);
+      if (!new_idat)
+	return grub_errno;
+      data->idat = new_idat;
+      data->idat_alloc = new_alloc;
     }
-}
-
-static int
-grub_png_get_huff_code (struct grub_png_data *data, struct huff_table *ht)
-{
-  int code, i;
 
-  code = 0;
-  for (i = 0; i < ht->max_length; i++)
+  if (grub_file_read (data->file, data->idat + data->idat_size, len)
+      != (grub_ssize_t) len)
     {
-      code = (code << 1) + grub_png_get_bits (data, 1);
-      if (code < ht->maxval[i])
-	return ht->values[code + ht->offset[i]];
+      if (!grub_errno)
+	grub_error (GRUB_ERR_BAD_FILE_TYPE, "png: unexpected end of data");
+      return grub_errno;
     }
-  return 0;
-}
-
-static grub_err_t
-grub_png_init_fixed_block (struct grub_png_data *data)
-{
-  int i;
-
-  grub_png_init_huff_table (&data->code_table, DEFLATE_HUFF_LEN,
-			    data->code_values, data->code_maxval,
-			    data->code_offset);
-
-  for (i = 0; i < 144; i++)
-    grub_png_insert_huff_item (&data->code_table, i, 8);
+  data->idat_size += len;
 
-  for (; i < 256; i++)
-    grub_png_insert_huff_item (&data->code_table, i, 9);
-
-  for (; i < 280; i++)
-    grub_png_insert_huff_item (&data->code_table, i, 7);
-
-  for (; i < DEFLATE_HLIT_MAX; i++)
-    grub_png_insert_huff_item (&data->code_table, i, 8);
-
-  grub_png_build_huff_table (&data->code_table);
-
-  grub_png_init_huff_table (&data->dist_table, DEFLATE_HUFF_LEN,
-			    data->dist_values, data->dist_maxval,
-			    data->dist_offset);
-
-  for (i = 0; i < DEFLATE_HDIST_MAX; i++)
-    grub_png_insert_huff_item (&data->dist_table, i, 5);
-
-  grub_png_build_huff_table (&data->dist_table);
-
-  return grub_errno;
-}
-
-static grub_err_t
-grub_png_init_dynamic_block (struct grub_png_data *data)
-{
-  int nl, nd, nb, i, prev;
-  struct huff_table cl;
-  int cl_values[sizeof (bitorder)];
-  int cl_maxval[8];
-  int cl_offset[8];
-  grub_uint8_t lens[DEFLATE_HCLEN_MAX];
-
-  nl = DEFLATE_HLIT_BASE + grub_png_get_bits (data, 5);
-  nd = DEFLATE_HDIST_BASE + grub_png_get_bits (data, 5);
-  nb = DEFLATE_HCLEN_BASE + grub_png_get_bits (data, 4);
-
-  if ((nl > DEFLATE_HLIT_MAX) || (nd > DEFLATE_HDIST_MAX) ||
-      (nb > DEFLATE_HCLEN_MAX))
-    return grub_error (GRUB_ERR_BAD_FILE_TYPE, "png: too much data");
-
-  grub_png_init_huff_table (&cl, 8, cl_values, cl_maxval, cl_offset);
-
-  for (i = 0; i < nb; i++)
-    lens[bitorder[i]] = grub_png_get_bits (data, 3);
-
-  for (; i < DEFLATE_HCLEN_MAX; i++)
-    lens[bitorder[i]] = 0;
-
-  for (i = 0; i < DEFLATE_HCLEN_MAX; i++)
-    grub_png_insert_huff_item (&cl, i, lens[i]);
-
-  grub_png_build_huff_table (&cl);
-
-  grub_png_init_huff_table (&data->code_table, DEFLATE_HUFF_LEN,
-			    data->code_values, data->code_maxval,
-			    data->code_offset);
-
-  grub_png_init_huff_table (&data->dist_table, DEFLATE_HUFF_LEN,
-			    data->dist_values, data->dist_maxval,
-			    data->dist_offset);
-
-  prev = 0;
-  for (i = 0; i < nl + nd; i++)
-    {
-      int n, code;
-      struct huff_table *ht;
-
-      if (grub_errno)
-	return grub_errno;
-
-      if (i < nl)
-	{
-	  ht = &data->code_table;
-	  code = i;
-	}
-      else
-	{
-	  ht = &data->dist_table;
-	  code = i - nl;
-	}
-
-      n = grub_png_get_huff_code (data, &cl);
-      if (n < 16)
-	{
-	  grub_png_insert_huff_item (ht, code, n);
-	  prev = n;
-	}
-      else if (n == 16)
-	{
-	  int c;
-
-	  c = 3 + grub_png_get_bits (data, 2);
-	  while (c > 0)
-	    {
-	      grub_png_insert_huff_item (ht, code++, prev);
-	      i++;
-	      c--;
-	    }
-	  i--;
-	}
-      else if (n == 17)
-	i += 3 + grub_png_get_bits (data, 3) - 1;
-      else
-	i += 11 + grub_png_get_bits (data, 7) - 1;
-    }
-
-  grub_png_build_huff_table (&data->code_table);
-  grub_png_build_huff_table (&data->dist_table);
+  /* Skip crc checksum.  */
+  grub_png_get_dword (data);
 
   return grub_errno;
 }
 
-static grub_err_t
-grub_png_output_byte (struct grub_png_data *data, grub_uint8_t n)
+/* Undo the filter FILTER on row CUR, given the previous unfiltered row UP
+   (all zeros for the first row).  */
+static void
+grub_png_unfilter_row (struct grub_png_data *data, int filter,
+		       grub_uint8_t *cur, const grub_uint8_t *up)
 {
-  if (--data->raw_bytes < 0)
-    return grub_error (GRUB_ERR_BAD_FILE_TYPE, "image size overflown");
+  const grub_uint8_t *left = cur;
 
-  if (data->cur_column == 0)
+  switch (filter)
     {
-      if (n >= PNG_FILTER_VALUE_LAST)
-	return grub_error (GRUB_ERR_BAD_FILE_TYPE, "invalid filter value");
-
-      data->cur_filter = n;
-    }
-  else
-    *data->cur_rgb++ = n;
+    case PNG_FILTER_VALUE_SUB:
+      {
+	int i;
 
-  data->cur_column++;
-  if (data->cur_column == data->row_bytes + 1)
-    {
-      grub_uint8_t *blank_line = NULL;
-      grub_uint8_t *cur = data->cur_rgb - data->row_bytes;
-      grub_uint8_t *left = cur;
-      grub_uint8_t *up;
+	cur += data->bpp;
+	for (i = data->bpp; i < data->row_bytes; i++, cur++, left++)
+	  *cur += *left;
 
-      if (data->first_line)
-	{
-	  blank_line = grub_zalloc (data->row_bytes);
-	  if (blank_line == NULL)
-	    return grub_errno;
+	break;
+      }
+    case PNG_FILTER_VALUE_UP:
+      {
+	int i;
 
-	  up = blank_line;
-	}
-      else
-	up = cur - data->row_bytes;
+	for (i = 0; i < data->row_bytes; i++, cur++, up++)
+	  *cur += *up;
 
-      switch (data->cur_filter)
-	{
-	case PNG_FILTER_VALUE_SUB:
-	  {
-	    int i;
-
-	    cur += data->bpp;
-	    for (i = data->bpp; i < data->row_bytes; i++, cur++, left++)
-	      *cur += *left;
+	break;
+      }
+    case PNG_FILTER_VALUE_AVG:
+      {
+	int i;
 
-	    break;
-	  }
-	case PNG_FILTER_VALUE_UP:
-	  {
-	    int i;
+	for (i = 0; i < data->bpp; i++, cur++, up++)
+	  *cur += *up >> 1;
 
-	    for (i = 0; i < data->row_bytes; i++, cur++, up++)
-	      *cur += *up;
+	for (; i < data->row_bytes; i++, cur++, up++, left++)
+	  *cur += ((int) *up + (int) *left) >> 1;
 
-	    break;
-	  }
-	case PNG_FILTER_VALUE_AVG:
-	  {
-	    int i;
-
-	    for (i = 0; i < data->bpp; i++, cur++, up++)
-	      *cur += *up >> 1;
+	break;
+      }
+    case PNG_FILTER_VALUE_PAETH:
+      {
+	int i;
+	const grub_uint8_t *upper_left = up;
 
-	    for (; i < data->row_bytes; i++, cur++, up++, left++)
-	      *cur += ((int) *up + (int) *left) >> 1;
+	for (i = 0; i < data->bpp; i++, cur++, up++)
+	  *cur += *up;
 
-	    break;
-	  }
-	case PNG_FILTER_VALUE_PAETH:
+	for (; i < data->row_bytes; i++, cur++, up++, left++, upper_left++)
 	  {
-	    int i;
-	    grub_uint8_t *upper_left = up;
+	    int a, b, c, pa, pb, pc;
 
-	    for (i = 0; i < data->bpp; i++, cur++, up++)
-	      *cur += *up;
+	    a = *left;
+	    b = *up;
+	    c = *upper_left;
 
-	    for (; i < data->row_bytes; i++, cur++, up++, left++, upper_left++)
-	      {
-		int a, b, c, pa, pb, pc;
+	    pa = b - c;
+	    pb = a - c;
+	    pc = pa + pb;
 
-                a = *left;
-                b = *up;
-                c = *upper_left;
+	    if (pa < 0)
+	      pa = -pa;
 
-                pa = b - c;
-                pb = a - c;
-                pc = pa + pb;
+	    if (pb < 0)
+	      pb = -pb;
 
-                if (pa < 0)
-                  pa = -pa;
+	    if (pc < 0)
+	      pc = -pc;
 
-                if (pb < 0)
-                  pb = -pb;
-
-                if (pc < 0)
-                  pc = -pc;
-
-                *cur += ((pa <= pb) && (pa <= pc)) ? a : (pb <= pc) ? b : c;
-	      }
+	    *cur += ((pa <= pb) && (pa <= pc)) ? a : (pb <= pc) ? b : c;
 	  }
-	}
-
-      grub_free (blank_line);
-
-      data->cur_column = 0;
-      data->first_line = 0;
-    }
-
-  return grub_errno;
-}
-
-static grub_err_t
-grub_png_read_dynamic_block (struct grub_png_data *data)
-{
-  while (grub_errno == 0)
-    {
-      int n;
-
-      n = grub_png_get_huff_code (data, &data->code_table);
-      if (n < 256)
-	{
-	  data->slide[data->wp] = n;
-	  grub_png_output_byte (data, n);
-
-	  data->wp++;
-	  if (data->wp >= WSIZE)
-	    data->wp = 0;
-	}
-      else if (n == 256)
-	break;
-      else
-	{
-	  int len, dist, pos;
-
-	  n -= 257;
-	  len = cplens[n];
-	  if (cplext[n])
-	    len += grub_png_get_bits (data, cplext[n]);
-
-	  n = grub_png_get_huff_code (data, &data->dist_table);
-	  dist = cpdist[n];
-	  if (cpdext[n])
-	    dist += grub_png_get_bits (data, cpdext[n]);
-
-	  pos = data->wp - dist;
-	  if (pos < 0)
-	    pos += WSIZE;
-
-	  while (len > 0)
-	    {
-	      data->slide[data->wp] = data->slide[pos];
-	      grub_png_output_byte (data, data->slide[data->wp]);
-
-	      data->wp++;
-	      if (data->wp >= WSIZE)
-		data->wp = 0;
-
-	      pos++;
-	      if (pos >= WSIZE)
-		pos = 0;
-
-	      len--;
-	    }
-	}
+      }
     }
-
-  return grub_errno;
 }
 
+/* Inflate the gathered IDAT data with the shared zlib decoder and undo the
+   per-row filters into the destination buffer.  */
 static grub_err_t
 grub_png_decode_image_data (struct grub_png_data *data)
 {
-  grub_uint8_t cmf, flg;
-  int final;
+  grub_uint8_t *raw, *src, *cur, *blank_line;
+  grub_ssize_t ret;
+  unsigned j;
 
-  cmf = grub_png_get_byte (data);
-  flg = grub_png_get_byte (data);
-
-  if ((cmf & 0xF) != Z_DEFLATED)
-    return grub_error (GRUB_ERR_BAD_FILE_TYPE,
-		       "png: only support deflate compression method");
+  raw = grub_malloc (data->raw_bytes);
+  if (!raw)
+    return grub_errno;
 
-  if (flg & Z_FLAG_DICT)
-    return grub_error (GRUB_ERR_BAD_FILE_TYPE,
-		       "png: dictionary not supported");
+  ret = grub_zlib_decompress ((char *) data->idat, data->idat_size, 0,
+			      (char *) raw, data->raw_bytes);
+  if (ret != data->raw_bytes)
+    {
+      grub_free (raw);
+      if (!grub_errno)
+	grub_error (GRUB_ERR_BAD_FILE_TYPE, "png: unexpected end of data");
+      return grub_errno;
+    }
 
-  do
+  blank_line = grub_zalloc (data->row_bytes);
+  if (!blank_line)
     {
-      int block_type;
+      grub_free (raw);
+      return grub_errno;
+    }
 
-      final = grub_png_get_bits (data, 1);
-      block_type = grub_png_get_bits (data, 2);
+  src = raw;
+  cur = data->cur_rgb;
+  for (j = 0; j < data->image_height; j++)
+    {
+      int filter = *src++;
 
-      switch (block_type)
+      if (filter >= PNG_FILTER_VALUE_LAST)
 	{
-	case INFLATE_STORED:
-	  {
-	    grub_uint16_t i, len;
-
-	    data->bit_count = 0;
-	    len = grub_png_get_byte (data);
-	    len += ((grub_uint16_t) grub_png_get_byte (data)) << 8;
-
-            /* Skip NLEN field.  */
-	    grub_png_get_byte (data);
-	    grub_png_get_byte (data);
-
-	    for (i = 0; i < len; i++)
-	      grub_png_output_byte (data, grub_png_get_byte (data));
-
-	    break;
-	  }
-
-	case INFLATE_FIXED:
-          grub_png_init_fixed_block (data);
-	  grub_png_read_dynamic_block (data);
+	  grub_error (GRUB_ERR_BAD_FILE_TYPE, "invalid filter value");
 	  break;
-
-	case INFLATE_DYNAMIC:
-	  grub_png_init_dynamic_block (data);
-	  grub_png_read_dynamic_block (data);
-	  break;
-
-	default:
-	  return grub_error (GRUB_ERR_BAD_FILE_TYPE,
-			     "png: unknown block type");
 	}
-    }
-  while ((!final) && (grub_errno == 0));
 
-  /* Skip adler checksum.  */
-  grub_png_get_dword (data);
+      grub_memcpy (cur, src, data->row_bytes);
+      grub_png_unfilter_row (data, filter, cur,
+			     j ? cur - data->row_bytes : blank_line);
+      src += data->row_bytes;
+      cur += data->row_bytes;
+    }
 
-  /* Skip crc checksum.  */
-  grub_png_get_dword (data);
+  grub_free (blank_line);
+  grub_free (raw);
 
   return grub_errno;
 }
@@ -1049,16 +650,19 @@ grub_png_decode_png (struct grub_png_data *data)
 	  break;
 
 	case PNG_CHUNK_IDAT:
-	  data->inside_idat = 1;
-	  data->idat_remain = len;
-	  data->bit_count = 0;
-
-	  grub_png_decode_image_data (data);
-
-	  data->inside_idat = 0;
+	  if (!data->cur_rgb)
+	    return grub_error (GRUB_ERR_BAD_FILE_TYPE,
+			       "png: image data before header");
+	  grub_png_read_image_data (data, len);
 	  break;
 
 	case PNG_CHUNK_IEND:
+	  if (!data->cur_rgb)
+	    return grub_error (GRUB_ERR_BAD_FILE_TYPE,
+			       "png: no image data");
+	  if (grub_png_decode_image_data (data))
+	    return grub_errno;
+
           if (data->image_data)
             grub_png_convert_image (data);
 
@@ -1099,6 +703,7 @@ grub_video_reader_png (struct grub_video_bitmap **bitmap,
       grub_png_decode_png (data);
 
       grub_free (data->image_data);
+      grub_free (data->idat);
       grub_free (data);
     }
 
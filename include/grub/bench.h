@@ -0,0 +1,90 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRUB_BENCH_HEADER
+#define GRUB_BENCH_HEADER
+
+#include <grub/dl.h>
+#include <grub/err.h>
+#include <grub/list.h>
+#include <grub/misc.h>
+#include <grub/types.h>
+
+struct grub_bench
+{
+  /* The next benchmark.  */
+  struct grub_bench *next;
+  struct grub_bench **prev;
+
+  /* The benchmark name.  */
+  const char *name;
+
+  /* Bytes processed by one call of RUN, or 0 if throughput does not
+     make sense for this benchmark.  */
+  grub_size_t bytes;
+
+  /* Optional.  Set up the state passed to RUN.  */
+  grub_err_t (*init) (void **data);
+
+  /* The operation being timed.  If it sets grub_errno, the benchmark
+     stops and is reported as failed.  */
+  void (*run) (void *data);
+
+  /* Optional.  Release the state set up by INIT.  */
+  void (*fini) (void *data);
+};
+typedef struct grub_bench *grub_bench_t;
+
+extern grub_bench_t grub_bench_list;
+
+void grub_bench_register (grub_bench_t bench);
+void grub_bench_unregister (grub_bench_t bench);
+
+enum grub_bench_output
+  {
+    GRUB_BENCH_OUTPUT_TEXT,
+    GRUB_BENCH_OUTPUT_JSON
+  };
+
+/* Run every registered benchmark whose name contains one of PATTERNS (all
+   of them if NPATTERNS is 0).  If BASELINE is not NULL it holds the JSON
+   output of an earlier run; results are compared against it and
+   GRUB_ERR_TEST_FAILURE is returned if any benchmark got slower by more
+   than THRESHOLD percent.  */
+grub_err_t grub_bench_run_all (char **patterns, int npatterns,
+			       enum grub_bench_output output,
+			       const char *baseline, unsigned threshold);
+
+/* Register every benchmark in an array from a module.  The list is built
+   by pushing to the front, so go backwards to keep the array order.  */
+#define GRUB_BENCHMARKS(name, benches)				\
+  GRUB_MOD_INIT(name)						\
+  {								\
+    unsigned i;							\
+    for (i = ARRAY_SIZE (benches); i > 0; i--)			\
+      grub_bench_register (&(benches)[i - 1]);			\
+  }								\
+								\
+  GRUB_MOD_FINI(name)						\
+  {								\
+    unsigned i;							\
+    for (i = 0; i < ARRAY_SIZE (benches); i++)			\
+      grub_bench_unregister (&(benches)[i]);			\
+  }
+
+#endif /* ! GRUB_BENCH_HEADER */
@@ -31,6 +31,11 @@ struct grub_video_bitmap
 
   /* Pointer to bitmap data formatted according to mode_info.  */
   void *data;
+
+  /* References beyond the first one, taken by the bitmap cache and its
+     users.  grub_video_bitmap_destroy frees the bitmap only when this is
+     zero.  */
+  unsigned int refcnt;
 };
 
 struct grub_video_bitmap_reader
@@ -59,6 +64,19 @@ grub_err_t EXPORT_FUNC (grub_video_bitmap_destroy) (struct grub_video_bitmap *bi
 grub_err_t EXPORT_FUNC (grub_video_bitmap_load) (struct grub_video_bitmap **bitmap,
 						 const char *filename);
 
+int EXPORT_FUNC (grub_video_bitmap_cache_find) (struct grub_video_bitmap **bitmap,
+						const char *filename,
+						struct grub_video_bitmap *source,
+						unsigned int width, unsigned int height,
+						int variant);
+
+void EXPORT_FUNC (grub_video_bitmap_cache_insert) (struct grub_video_bitmap *bitmap,
+						   const char *filename,
+						   unsigned int width, unsigned int height,
+						   int variant);
+
+void EXPORT_FUNC (grub_video_bitmap_cache_flush) (void);
+
 /* Return bitmap width.  */
 static inline unsigned int
 grub_video_bitmap_get_width (struct grub_video_bitmap *bitmap)
@@ -69,6 +69,16 @@ EXPORT_FUNC (grub_video_bitmap_create_scaled) (struct grub_video_bitmap **dst,
 					       grub_video_bitmap_scale_method
 					       scale_method);
 
+/* Load FILENAME and scale it to DST_WIDTH x DST_HEIGHT, reusing an
+   earlier result when the file has not changed.  */
+grub_err_t
+EXPORT_FUNC (grub_video_bitmap_load_scaled) (struct grub_video_bitmap **dst,
+					     const char *filename,
+					     int dst_width, int dst_height,
+					     enum
+					     grub_video_bitmap_scale_method
+					     scale_method);
+
 grub_err_t
 EXPORT_FUNC (grub_video_bitmap_scale_proportional)
                                      (struct grub_video_bitmap **dst,
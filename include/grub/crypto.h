@@ -88,6 +88,8 @@ enum gcry_cipher_modes
 /* Don't rely on this. Check!  */
 #define GRUB_CRYPTO_MAX_MDLEN 64
 #define GRUB_CRYPTO_MAX_CIPHER_BLOCKSIZE 16
+/* Blocks per batch when a chained mode uses the bulk entry points.  */
+#define GRUB_CRYPTO_BULK_BLOCKS 8
 #define GRUB_CRYPTO_MAX_MD_CONTEXT_SIZE 256
 
 /* Type for the cipher_setkey function.  */
@@ -117,6 +119,19 @@ typedef void (*gcry_cipher_stdecrypt_t) (void *c,
 					 const unsigned char *inbuf,
 					 unsigned int n);
 
+/* Type for the cipher_encrypt_blocks function.  Processes N consecutive
+   independent blocks; OUTBUF and INBUF may be the same.  */
+typedef void (*gcry_cipher_encrypt_blocks_t) (void *c,
+					      unsigned char *outbuf,
+					      const unsigned char *inbuf,
+					      unsigned int n);
+
+/* Type for the cipher_decrypt_blocks function.  */
+typedef void (*gcry_cipher_decrypt_blocks_t) (void *c,
+					      unsigned char *outbuf,
+					      const unsigned char *inbuf,
+					      unsigned int n);
+
 typedef struct gcry_cipher_oid_spec
 {
   const char *oid;
@@ -137,6 +152,9 @@ typedef struct gcry_cipher_spec
   gcry_cipher_decrypt_t decrypt;
   gcry_cipher_stencrypt_t stencrypt;
   gcry_cipher_stdecrypt_t stdecrypt;
+  /* Optional, may be NULL.  */
+  gcry_cipher_encrypt_blocks_t encrypt_blocks;
+  gcry_cipher_decrypt_blocks_t decrypt_blocks;
 #ifdef GRUB_UTIL
   const char *modname;
 #endif
@@ -50,6 +50,7 @@ enum grub_disk_dev_id
     GRUB_DISK_DEVICE_UBOOTDISK_ID,
     GRUB_DISK_DEVICE_XEN,
     GRUB_DISK_DEVICE_OBDISK_ID,
+    GRUB_DISK_DEVICE_BENCH_ID,
   };
 
 struct grub_disk;
@@ -143,6 +144,17 @@ struct grub_disk
   /* Caller-specific data passed to the read hook.  */
   void *read_hook_data;
 
+  /* If not NULL, the whole disk is available in memory at this address,
+     MAPPED_SIZE bytes of it, and reads are served from it directly
+     instead of through the disk cache.  Bytes past MAPPED_SIZE read as
+     zeros.  */
+  const char *mapped;
+  grub_uint64_t mapped_size;
+
+  /* If set, data of reads spanning whole cache units goes straight to the
+     caller and is not stored in the disk cache.  */
+  int cache_bypass;
+
   /* Device-specific data.  */
   void *data;
 };
@@ -214,9 +226,22 @@ extern grub_err_t (*EXPORT_VAR(grub_disk_write_weak)) (grub_disk_t disk,
 
 grub_uint64_t EXPORT_FUNC(grub_disk_get_size) (grub_disk_t disk);
 
-#if DISK_CACHE_STATS
+/* The utilities always keep statistics, grub-fstest reports them.  */
+#if DISK_CACHE_STATS || defined (GRUB_UTIL)
+#define GRUB_DISK_STATS 1
+#else
+#define GRUB_DISK_STATS 0
+#endif
+
+#if GRUB_DISK_STATS
 void
 EXPORT_FUNC(grub_disk_cache_get_performance) (unsigned long *hits, unsigned long *misses);
+
+/* Number of requests passed to the disk drivers and the bytes they
+   transferred.  */
+void
+EXPORT_FUNC(grub_disk_get_device_stats) (unsigned long *reads,
+					 grub_uint64_t *bytes);
 #endif
 
 extern void (* EXPORT_VAR(grub_disk_firmware_fini)) (void);
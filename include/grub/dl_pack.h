@@ -0,0 +1,54 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026 Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRUB_DL_PACK_HEADER
+#define GRUB_DL_PACK_HEADER	1
+
+#include <grub/types.h>
+
+/* A module pack holds the modules of one platform directory in a single
+   file, so that loading a module and its dependencies needs only one
+   open and one read.  All fields are little-endian.
+
+   The header is followed by the index: NMODULES entries, then the
+   dependency arrays and the module names.  NAME and DEPS are offsets
+   from the start of the index, OFFSET from the start of the file.
+   Modules come after all their dependencies, and each dependency is an
+   index of an earlier entry.  The index ends with a NUL byte.  */
+
+#define GRUB_DL_PACK_NAME	"modules.pack"
+#define GRUB_DL_PACK_MAGIC	"GRUBMPK1"
+#define GRUB_DL_PACK_ALIGN	16
+
+struct grub_dl_pack_header
+{
+  char magic[8];
+  grub_uint32_t nmodules;
+  grub_uint32_t index_size;
+} GRUB_PACKED;
+
+struct grub_dl_pack_entry
+{
+  grub_uint32_t name;
+  grub_uint32_t offset;
+  grub_uint32_t size;
+  grub_uint32_t ndeps;
+  grub_uint32_t deps;
+} GRUB_PACKED;
+
+#endif /* ! GRUB_DL_PACK_HEADER */
@@ -86,6 +86,9 @@ struct grub_util_hostdisk_data
   char *dev;
   int access_mode;
   grub_util_fd_t fd;
+  /* Byte offset in FD of the sector last passed to
+     grub_util_fd_open_device.  */
+  grub_uint64_t offset;
   int is_disk;
   int device_map;
 };
@@ -41,8 +41,16 @@ grub_util_fd_seek (grub_util_fd_t fd, grub_uint64_t off);
 ssize_t
 EXPORT_FUNC(grub_util_fd_read) (grub_util_fd_t fd, char *buf, size_t len);
 ssize_t
+EXPORT_FUNC(grub_util_fd_pread) (grub_util_fd_t fd, char *buf, size_t len,
+				 grub_uint64_t off);
+ssize_t
 EXPORT_FUNC(grub_util_fd_write) (grub_util_fd_t fd, const char *buf, size_t len);
 
+void *
+grub_util_fd_map (grub_util_fd_t fd, grub_uint64_t size);
+void
+grub_util_fd_unmap (void *addr, grub_uint64_t size);
+
 grub_util_fd_t
 EXPORT_FUNC(grub_util_fd_open) (const char *os_dev, int flags);
 const char *
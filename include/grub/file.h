@@ -132,7 +132,10 @@ enum grub_file_type
 
     /* --skip-sig is specified.  */
     GRUB_FILE_TYPE_SKIP_SIGNATURE = 0x10000,
-    GRUB_FILE_TYPE_NO_DECOMPRESS = 0x20000
+    GRUB_FILE_TYPE_NO_DECOMPRESS = 0x20000,
+    /* The file is read once in large blocks, don't keep its data in the
+       disk cache.  */
+    GRUB_FILE_TYPE_NO_DISK_CACHE = 0x40000
   };
 
 /* File description.  */
@@ -165,6 +168,10 @@ struct grub_file
   /* Filesystem-specific data.  */
   void *data;
 
+  /* If not NULL, the whole file content is available at this address for
+     as long as the file is open.  Set by the filesystem.  */
+  const char *mapped;
+
   /* This is called when a sector is read. Used only for a disk device.  */
   grub_disk_read_hook_t read_hook;
 
@@ -44,7 +44,15 @@ struct grub_font
   short leading;
   grub_uint32_t num_chars;
   struct char_index_entry *char_index;
-  grub_uint16_t *bmp_idx;
+  /* Two-level index of the BMP: 256 pages of 256 entries each, a page
+     is only allocated when the font has a glyph in it.  */
+  grub_uint16_t **bmp_idx;
+  /* Whole font file when it was preloaded, NULL when glyphs are read
+     from FILE on demand.  */
+  grub_uint8_t *data;
+  grub_size_t data_size;
+  /* Current read position in DATA.  */
+  grub_size_t data_offset;
 };
 
 /* Font type used to access font functions.  */
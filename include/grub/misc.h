@@ -64,7 +64,7 @@ grub_stpcpy (char *dest, const char *src)
   return d - 1;
 }
 
-/* XXX: If grub_memmove is too slow, we must implement grub_memcpy.  */
+/* grub_memmove goes forwards whenever the buffers allow it.  */
 static inline void *
 grub_memcpy (void *dest, const void *src, grub_size_t n)
 {
@@ -445,8 +445,13 @@ struct grub_boot_time
 {
   struct grub_boot_time *next;
   grub_uint64_t tp;
+  /* For spans, when the span ended, or 0 while it is still open.  */
+  grub_uint64_t end;
   const char *file;
   int line;
+  /* Number of spans this one is nested in.  */
+  int depth;
+  int is_span;
   char *msg;
 };
 
@@ -455,9 +460,26 @@ extern struct grub_boot_time *EXPORT_VAR(grub_boot_time_head);
 void EXPORT_FUNC(grub_real_boot_time) (const char *file,
 				       const int line,
 				       const char *fmt, ...) __attribute__ ((format (GNU_PRINTF, 3, 4)));
+void EXPORT_FUNC(grub_real_boot_time_begin) (const char *file,
+					     const int line,
+					     const char *fmt, ...) __attribute__ ((format (GNU_PRINTF, 3, 4)));
+void EXPORT_FUNC(grub_real_boot_time_begin_disk) (const char *file,
+						  const int line,
+						  const char *fmt, ...) __attribute__ ((format (GNU_PRINTF, 3, 4)));
+void EXPORT_FUNC(grub_real_boot_time_end) (void);
 #define grub_boot_time(...) grub_real_boot_time(GRUB_FILE, __LINE__, __VA_ARGS__)
+/* Spans must be strictly nested: every grub_boot_time_begin needs a
+   matching grub_boot_time_end on all paths.  */
+#define grub_boot_time_begin(...) grub_real_boot_time_begin(GRUB_FILE, __LINE__, __VA_ARGS__)
+/* Like grub_boot_time_begin, for device reads, which are limited
+   separately.  */
+#define grub_boot_time_begin_disk(...) grub_real_boot_time_begin_disk(GRUB_FILE, __LINE__, __VA_ARGS__)
+#define grub_boot_time_end() grub_real_boot_time_end()
 #else
 #define grub_boot_time(...)
+#define grub_boot_time_begin(...)
+#define grub_boot_time_begin_disk(...)
+#define grub_boot_time_end()
 #endif
 
 #define grub_max(a, b) (((a) > (b)) ? (a) : (b))
@@ -0,0 +1,69 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Arithmetic on sizes taken from untrusted data.  Each macro stores the
+   result in *RES and evaluates to nonzero if it didn't fit.  */
+
+#ifndef GRUB_SAFEMATH_HEADER
+#define GRUB_SAFEMATH_HEADER	1
+
+#include <grub/compiler.h>
+
+#if defined (__clang__) && defined (__has_builtin)
+#  if __has_builtin (__builtin_add_overflow)
+#    define GRUB_HAVE_BUILTIN_OVERFLOW	1
+#  endif
+#elif GNUC_PREREQ(5,1)
+#  define GRUB_HAVE_BUILTIN_OVERFLOW	1
+#endif
+
+#ifdef GRUB_HAVE_BUILTIN_OVERFLOW
+
+#define grub_add(a, b, res)	__builtin_add_overflow ((a), (b), (res))
+#define grub_sub(a, b, res)	__builtin_sub_overflow ((a), (b), (res))
+#define grub_mul(a, b, res)	__builtin_mul_overflow ((a), (b), (res))
+
+#else
+
+/* Older compilers: unsigned operands only.  The operands are read once,
+   before *RES is written, so RES may point to one of them.  */
+#define grub_safemath_op_(op, a, b, res, ovf)				\
+  ({									\
+    __typeof__ (a) grub_sm_a0_ = (a);					\
+    __typeof__ (b) grub_sm_b0_ = (b);					\
+    __typeof__ (*(res)) grub_sm_a_ = grub_sm_a0_, grub_sm_b_ = grub_sm_b0_; \
+    __typeof__ (*(res)) grub_sm_r_ = grub_sm_a_ op grub_sm_b_;		\
+    int grub_sm_ovf_ = (grub_sm_a_ != grub_sm_a0_			\
+			|| grub_sm_b_ != grub_sm_b0_ || (ovf));		\
+    *(res) = grub_sm_r_;						\
+    grub_sm_ovf_;							\
+  })
+
+#define grub_add(a, b, res)						\
+  grub_safemath_op_ (+, a, b, res, grub_sm_r_ < grub_sm_a_)
+
+#define grub_sub(a, b, res)						\
+  grub_safemath_op_ (-, a, b, res, grub_sm_b_ > grub_sm_a_)
+
+#define grub_mul(a, b, res)						\
+  grub_safemath_op_ (*, a, b, res,					\
+		     grub_sm_a_ != 0 && grub_sm_r_ / grub_sm_a_ != grub_sm_b_)
+
+#endif
+
+#endif /* ! GRUB_SAFEMATH_HEADER */
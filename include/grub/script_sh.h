@@ -292,6 +292,16 @@ grub_script_arg_add (struct grub_parser_param *state,
 struct grub_script *grub_script_parse (char *script,
 				       grub_reader_getline_t getline_func,
 				       void *getline_func_data);
+
+/* Time spent parsing scripts, reported with `debug=scripts'.  */
+struct grub_script_stats
+{
+  grub_uint64_t parse_ms;
+  unsigned long parses;
+  /* Sourced scripts run from the parse cache instead of parsed again.  */
+  unsigned long cache_hits;
+};
+extern struct grub_script_stats grub_script_stats;
 void grub_script_free (struct grub_script *script);
 struct grub_script *grub_script_create (struct grub_script_cmd *cmd,
 					struct grub_script_mem *mem);
@@ -331,6 +341,7 @@ grub_err_t grub_script_execute_cmdwhile (struct grub_script_cmd *cmd);
 grub_err_t grub_script_execute (struct grub_script *script);
 grub_err_t grub_script_execute_sourcecode (const char *source);
 grub_err_t grub_script_execute_new_scope (const char *source, int argc, char **args);
+void grub_script_cache_flush (void);
 
 /* Break command for loops.  */
 grub_err_t grub_script_break (grub_command_t cmd, int argc, char *argv[]);
@@ -371,6 +382,10 @@ typedef struct grub_script_function *grub_script_function_t;
 
 extern grub_script_function_t grub_script_function_list;
 
+/* Bumped whenever a function is defined.  Parsing a definition has the
+   side effect of registering it, so such scripts can't be reused.  */
+extern unsigned long grub_script_function_generation;
+
 #define FOR_SCRIPT_FUNCTIONS(var) for((var) = grub_script_function_list; \
 				      (var); (var) = (var)->next)
 
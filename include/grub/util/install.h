@@ -43,6 +43,8 @@
   { "compress", GRUB_INSTALL_OPTIONS_INSTALL_COMPRESS,		  \
     "no|xz|gz|lzo", 0,				  \
     N_("compress GRUB files [optional]"), 1 },			          \
+  { "module-pack", GRUB_INSTALL_OPTIONS_MODULE_PACK, 0, 0,		  \
+    N_("also put the installed modules into a single pack file"), 1 },   \
   {"core-compress", GRUB_INSTALL_OPTIONS_INSTALL_CORE_COMPRESS,		\
       "xz|none|auto",						\
       0, N_("choose the compression to use for core image"), 2},	\
@@ -122,7 +124,8 @@ enum grub_install_options {
   GRUB_INSTALL_OPTIONS_THEMES_DIRECTORY,
   GRUB_INSTALL_OPTIONS_GRUB_MKIMAGE,
   GRUB_INSTALL_OPTIONS_INSTALL_CORE_COMPRESS,
-  GRUB_INSTALL_OPTIONS_DTB
+  GRUB_INSTALL_OPTIONS_DTB,
+  GRUB_INSTALL_OPTIONS_MODULE_PACK
 };
 
 extern char *grub_install_source_directory;
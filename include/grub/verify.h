@@ -27,7 +27,15 @@ enum grub_verify_flags
     GRUB_VERIFY_FLAGS_SKIP_VERIFICATION	= 1,
     GRUB_VERIFY_FLAGS_SINGLE_CHUNK	= 2,
     /* Defer verification to another authority. */
-    GRUB_VERIFY_FLAGS_DEFER_AUTH	= 4
+    GRUB_VERIFY_FLAGS_DEFER_AUTH	= 4,
+    /*
+     * Feed the data to write() as the consumer reads it instead of
+     * reading the whole file at open.  fini() runs when the last byte is
+     * read and a failure is reported by that read, so only request this
+     * for file types whose consumers read the whole file, front to back,
+     * before using it.  Ignored if another verifier needs the whole file.
+     */
+    GRUB_VERIFY_FLAGS_STREAM		= 8
   };
 
 enum grub_verify_string_type
@@ -52,9 +60,9 @@ struct grub_file_verifier
 		      void **context, enum grub_verify_flags *flags);
 
   /*
-   * Right now we pass the whole file in one call but it may
-   * change in the future. If you insist on single buffer you
-   * need to set GRUB_VERIFY_FLAGS_SINGLE_CHUNK in verify_flags.
+   * Unless GRUB_VERIFY_FLAGS_STREAM is used we pass the whole file in
+   * one call but it may change in the future. If you insist on single
+   * buffer you need to set GRUB_VERIFY_FLAGS_SINGLE_CHUNK in verify_flags.
    */
   grub_err_t (*write) (void *context, void *buf, grub_size_t size);
 
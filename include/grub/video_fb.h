@@ -148,4 +148,19 @@ grub_err_t
 EXPORT_FUNC (grub_video_fb_get_info_and_fini) (struct grub_video_mode_info *mode_info,
 					       void **framebuf);
 
+/* Amount of data copied from the back buffer to the visible framebuffer.  */
+struct grub_video_fb_update_stats
+{
+  /* Number of screen updates since the mode was set.  */
+  grub_uint64_t frames;
+  /* Number of rectangles and bytes copied in those updates.  */
+  grub_uint64_t rects;
+  grub_uint64_t bytes;
+  /* Bytes copied by the most recent update.  */
+  grub_size_t last_frame_bytes;
+};
+
+void
+EXPORT_FUNC (grub_video_fb_get_update_stats) (struct grub_video_fb_update_stats *stats);
+
 #endif /* ! GRUB_VIDEO_FB_HEADER */
@@ -0,0 +1,112 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Host driver for the benchmarks in grub-core/tests, the counterpart of the
+   `benchmark' command.
+
+   Usage: microbench [--json] [--baseline FILE] [--threshold PERCENT]
+		     [PATTERN...]  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <grub/bench.h>
+#include <grub/crypto.h>
+#include <grub/err.h>
+
+void grub_mem_bench_init (void);
+void grub_disk_bench_init (void);
+void grub_decompress_bench_init (void);
+void grub_crypto_bench_init (void);
+void grub_video_bench_init (void);
+
+static char *
+read_baseline (const char *name)
+{
+  FILE *f;
+  long size;
+  char *buf;
+
+  f = fopen (name, "rb");
+  if (f == NULL)
+    {
+      perror (name);
+      exit (2);
+    }
+  if (fseek (f, 0, SEEK_END) != 0 || (size = ftell (f)) < 0
+      || fseek (f, 0, SEEK_SET) != 0)
+    {
+      perror (name);
+      exit (2);
+    }
+  buf = malloc (size + 1);
+  if (buf == NULL || fread (buf, 1, size, f) != (size_t) size)
+    {
+      fprintf (stderr, "%s: cannot read baseline\n", name);
+      exit (2);
+    }
+  buf[size] = '\0';
+  fclose (f);
+  return buf;
+}
+
+int
+main (int argc, char *argv[])
+{
+  enum grub_bench_output output = GRUB_BENCH_OUTPUT_TEXT;
+  char *baseline = NULL;
+  unsigned threshold = 10;
+  char **patterns;
+  int npatterns = 0;
+  int i;
+
+  patterns = calloc (argc, sizeof (patterns[0]));
+  if (patterns == NULL)
+    exit (2);
+
+  for (i = 1; i < argc; i++)
+    {
+      if (strcmp (argv[i], "--json") == 0)
+	output = GRUB_BENCH_OUTPUT_JSON;
+      else if (strcmp (argv[i], "--baseline") == 0 && i + 1 < argc)
+	baseline = read_baseline (argv[++i]);
+      else if (strcmp (argv[i], "--threshold") == 0 && i + 1 < argc)
+	threshold = strtoul (argv[++i], NULL, 0);
+      else
+	patterns[npatterns++] = argv[i];
+    }
+
+  grub_gcry_init_all ();
+  grub_mem_bench_init ();
+  grub_disk_bench_init ();
+  grub_decompress_bench_init ();
+  grub_crypto_bench_init ();
+  grub_video_bench_init ();
+
+  if (grub_bench_run_all (patterns, npatterns, output, baseline,
+			  threshold) != GRUB_ERR_NONE)
+    {
+      fprintf (stderr, "%s\n", grub_errmsg);
+      exit (1);
+    }
+
+  free (baseline);
+  free (patterns);
+  exit (0);
+}
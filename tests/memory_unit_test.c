@@ -0,0 +1,178 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026 Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* grub_memmove, grub_memset and grub_memcmp have separate byte, word and
+   string instruction paths depending on size and alignment.  Check all of
+   them against trivial byte loops.  */
+
+#include <string.h>
+#include <grub/test.h>
+#include <grub/misc.h>
+
+#define BUF_SIZE 2048
+#define MAX_OFFSET 16
+
+/* Sizes around the thresholds between the paths.  */
+static const grub_size_t sizes[] =
+  {
+    0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 23, 24, 25, 31, 32, 33,
+    63, 64, 65, 127, 128, 129, 255, 256, 257, 511, 800
+  };
+
+static grub_uint8_t buf[BUF_SIZE];
+static grub_uint8_t ref[BUF_SIZE];
+
+static void
+fill (grub_uint8_t *p)
+{
+  unsigned i;
+
+  for (i = 0; i < BUF_SIZE; i++)
+    p[i] = i * 7 + 3;
+}
+
+static void
+ref_move (grub_uint8_t *d, const grub_uint8_t *s, grub_size_t n)
+{
+  grub_uint8_t tmp[BUF_SIZE];
+  grub_size_t i;
+
+  for (i = 0; i < n; i++)
+    tmp[i] = s[i];
+  for (i = 0; i < n; i++)
+    d[i] = tmp[i];
+}
+
+static void
+memmove_test (void)
+{
+  unsigned so, dofs, i;
+
+  for (i = 0; i < ARRAY_SIZE (sizes); i++)
+    for (so = 0; so < MAX_OFFSET; so++)
+      for (dofs = 0; dofs < MAX_OFFSET; dofs++)
+	{
+	  grub_size_t n = sizes[i];
+	  void *ret;
+
+	  /* Disjoint.  */
+	  fill (buf);
+	  fill (ref);
+	  ret = grub_memmove (buf + BUF_SIZE / 2 + dofs, buf + so, n);
+	  ref_move (ref + BUF_SIZE / 2 + dofs, ref + so, n);
+	  grub_test_assert (ret == buf + BUF_SIZE / 2 + dofs,
+			    "memmove returned the wrong pointer");
+	  grub_test_assert (memcmp (buf, ref, BUF_SIZE) == 0,
+			    "memmove of %d bytes from +%u to +%u failed",
+			    (int) n, so, BUF_SIZE / 2 + dofs);
+
+	  /* Overlapping, destination above and below the source.  */
+	  fill (buf);
+	  fill (ref);
+	  grub_memmove (buf + so + dofs, buf + so, n);
+	  ref_move (ref + so + dofs, ref + so, n);
+	  grub_test_assert (memcmp (buf, ref, BUF_SIZE) == 0,
+			    "overlapping memmove of %d bytes up by %u failed",
+			    (int) n, dofs);
+
+	  fill (buf);
+	  fill (ref);
+	  grub_memmove (buf + so, buf + so + dofs, n);
+	  ref_move (ref + so, ref + so + dofs, n);
+	  grub_test_assert (memcmp (buf, ref, BUF_SIZE) == 0,
+			    "overlapping memmove of %d bytes down by %u failed",
+			    (int) n, dofs);
+	}
+}
+
+static void
+memset_test (void)
+{
+  unsigned ofs, i;
+  grub_size_t j;
+
+  for (i = 0; i < ARRAY_SIZE (sizes); i++)
+    for (ofs = 0; ofs < MAX_OFFSET; ofs++)
+      {
+	grub_size_t n = sizes[i];
+	void *ret;
+
+	fill (buf);
+	fill (ref);
+	ret = grub_memset (buf + ofs, 0xa5, n);
+	for (j = 0; j < n; j++)
+	  ref[ofs + j] = 0xa5;
+	grub_test_assert (ret == buf + ofs, "memset returned the wrong pointer");
+	grub_test_assert (memcmp (buf, ref, BUF_SIZE) == 0,
+			  "memset of %d bytes at +%u failed", (int) n, ofs);
+      }
+}
+
+static int
+sign (int x)
+{
+  return (x > 0) - (x < 0);
+}
+
+static void
+memcmp_test (void)
+{
+  unsigned o1, o2, i;
+  grub_size_t pos;
+
+  for (i = 0; i < ARRAY_SIZE (sizes); i++)
+    for (o1 = 0; o1 < MAX_OFFSET; o1 += 3)
+      for (o2 = 0; o2 < MAX_OFFSET; o2 += 5)
+	{
+	  grub_size_t n = sizes[i];
+	  grub_uint8_t *a = buf + o1, *b = ref + BUF_SIZE / 2 + o2;
+
+	  fill (buf);
+	  memcpy (b, a, n);
+	  grub_test_assert (grub_memcmp (a, b, n) == 0,
+			    "memcmp of %d equal bytes failed", (int) n);
+
+	  /* A difference at each position, with both signs and with bytes
+	     that compare differently signed and unsigned.  */
+	  for (pos = 0; pos < n; pos += (n > 64 ? 7 : 1))
+	    {
+	      grub_uint8_t saved = b[pos];
+
+	      b[pos] = a[pos] ^ 0x80;
+	      grub_test_assert (sign (grub_memcmp (a, b, n))
+				== sign ((int) a[pos] - (int) b[pos]),
+				"memcmp of %d bytes differing at %d failed",
+				(int) n, (int) pos);
+	      grub_test_assert (sign (grub_memcmp (b, a, n))
+				== sign ((int) b[pos] - (int) a[pos]),
+				"memcmp of %d bytes differing at %d failed",
+				(int) n, (int) pos);
+	      b[pos] = saved;
+	    }
+	}
+}
+
+static void
+memory_test (void)
+{
+  memmove_test ();
+  memset_test ();
+  memcmp_test ();
+}
+
+GRUB_UNIT_TEST ("memory_unit_test", memory_test);
@@ -0,0 +1,146 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026 Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* A double-buffered screen update must copy exactly the damaged areas of
+   the back buffer.  The visible buffer is filled with a marker that the
+   back buffer never contains, so any pixel copied without being drawn
+   shows up.  */
+
+#include <string.h>
+#include <grub/test.h>
+#include <grub/video.h>
+#include <grub/video_fb.h>
+
+#define WIDTH	32
+#define HEIGHT	32
+#define MARKER	0xdeadbeef
+#define COLOR	0x11223344
+
+static grub_uint32_t screen[WIDTH * HEIGHT];
+static grub_uint8_t drawn[WIDTH * HEIGHT];
+
+static void
+setup (void)
+{
+  struct grub_video_mode_info mode_info;
+  unsigned i;
+
+  memset (&mode_info, 0, sizeof (mode_info));
+  mode_info.width = WIDTH;
+  mode_info.height = HEIGHT;
+  mode_info.mode_type = GRUB_VIDEO_MODE_TYPE_RGB;
+  mode_info.bpp = 32;
+  mode_info.bytes_per_pixel = 4;
+  mode_info.pitch = WIDTH * 4;
+  mode_info.red_mask_size = 8;
+  mode_info.red_field_pos = 0;
+  mode_info.green_mask_size = 8;
+  mode_info.green_field_pos = 8;
+  mode_info.blue_mask_size = 8;
+  mode_info.blue_field_pos = 16;
+  mode_info.reserved_mask_size = 8;
+  mode_info.reserved_field_pos = 24;
+  mode_info.blit_format = GRUB_VIDEO_BLIT_FORMAT_RGBA_8888;
+
+  for (i = 0; i < WIDTH * HEIGHT; i++)
+    screen[i] = MARKER;
+  memset (drawn, 0, sizeof (drawn));
+
+  grub_video_fb_init ();
+  grub_test_assert (grub_video_fb_setup (GRUB_VIDEO_MODE_TYPE_DOUBLE_BUFFERED,
+					 GRUB_VIDEO_MODE_TYPE_DOUBLE_BUFFERED,
+					 &mode_info, screen, NULL, NULL)
+		    == GRUB_ERR_NONE, "double-buffered setup failed");
+}
+
+static void
+fill (int x, int y, int width, int height)
+{
+  int i, j;
+
+  grub_video_fb_fill_rect (COLOR, x, y, width, height);
+  for (j = y; j < y + height; j++)
+    for (i = x; i < x + width; i++)
+      drawn[j * WIDTH + i] = 1;
+}
+
+/* Every drawn pixel must reach the screen.  With EXACT, nothing else may,
+   and the update statistics must count exactly the drawn pixels.  */
+static void
+check (const char *what, int exact)
+{
+  struct grub_video_fb_update_stats stats;
+  unsigned i, wrong = 0, overdrawn = 0, ndrawn = 0;
+
+  grub_video_fb_swap_buffers ();
+  grub_video_fb_get_update_stats (&stats);
+
+  for (i = 0; i < WIDTH * HEIGHT; i++)
+    if (drawn[i])
+      {
+	ndrawn++;
+	if (screen[i] != COLOR)
+	  wrong++;
+      }
+    else if (screen[i] != MARKER)
+      overdrawn++;
+
+  grub_test_assert (wrong == 0, "%s: %u drawn pixels not updated", what, wrong);
+  grub_test_assert (!exact || overdrawn == 0,
+		    "%s: %u pixels copied without damage", what, overdrawn);
+  grub_test_assert (stats.frames == 1, "%s: %llu screen updates counted",
+		    what, (unsigned long long) stats.frames);
+  grub_test_assert (stats.bytes == stats.last_frame_bytes,
+		    "%s: total and last update bytes differ", what);
+  grub_test_assert (!exact || stats.last_frame_bytes == ndrawn * 4,
+		    "%s: %llu bytes counted for %u pixels", what,
+		    (unsigned long long) stats.last_frame_bytes, ndrawn);
+  grub_video_fb_fini ();
+}
+
+static void
+video_fb_test (void)
+{
+  int i;
+
+  /* Meeting at a corner only: the bounding box would cover two undrawn
+     squares.  */
+  setup ();
+  fill (4, 4, 4, 4);
+  fill (8, 8, 4, 4);
+  check ("corner", 1);
+
+  /* Sharing a whole edge, horizontally and vertically, and drawn twice.  */
+  setup ();
+  fill (0, 0, 8, 4);
+  fill (0, 4, 8, 4);
+  fill (16, 16, 4, 8);
+  fill (20, 16, 4, 8);
+  fill (24, 0, 4, 4);
+  fill (24, 0, 4, 4);
+  check ("edge", 1);
+
+  /* More separate areas than the list holds, some get merged.  */
+  setup ();
+  for (i = 0; i < 40; i++)
+    fill ((i % 8) * 4, (i / 8) * 6, 2, 3);
+  fill (0, 0, WIDTH, 1);
+  check ("many", 0);
+}
+
+GRUB_UNIT_TEST ("video_fb_unit_test", video_fb_test);
@@ -29,6 +29,7 @@
 #include <grub/env.h>
 #include <grub/term.h>
 #include <grub/mm.h>
+#include <grub/time.h>
 #include <grub/lib/hexdump.h>
 #include <grub/crypto.h>
 #include <grub/command.h>
@@ -69,7 +70,8 @@ enum {
   CMD_BLOCKLIST,
   CMD_TESTLOAD,
   CMD_ZFSINFO,
-  CMD_XNU_UUID
+  CMD_XNU_UUID,
+  CMD_BENCH
 };
 #define BUF_SIZE  32256
 
@@ -367,6 +369,283 @@ cmd_crc (char *pathname)
   free (crc32_context);
 }
 
+/* Number and size of the reads at random offsets.  */
+#define BENCH_RANDOM_READS	1024
+#define BENCH_RANDOM_SIZE	4096
+/* Don't follow directory loops forever.  */
+#define BENCH_MAX_DEPTH		64
+
+struct bench_stats
+{
+  grub_uint64_t start_ms;
+  unsigned long hits, misses, reads;
+  grub_uint64_t bytes;
+};
+
+struct bench_dir
+{
+  char *name;
+  int depth;
+};
+
+struct bench_ctx
+{
+  struct bench_dir *dirs;
+  grub_size_t ndirs, dirs_alloc;
+  char **files;
+  grub_size_t nfiles, files_alloc;
+  grub_uint64_t entries;
+  /* The directory being listed.  */
+  grub_size_t cur;
+};
+
+/* Every phase starts with a cold disk cache so that the numbers do not
+   depend on what ran before.  */
+static void
+bench_start (struct bench_stats *st)
+{
+  grub_disk_cache_invalidate_all ();
+  grub_disk_cache_get_performance (&st->hits, &st->misses);
+  grub_disk_get_device_stats (&st->reads, &st->bytes);
+  st->start_ms = grub_get_time_ms ();
+}
+
+static grub_uint64_t
+bench_report (const char *phase, const struct bench_stats *st,
+	      grub_uint64_t count, const char *unit)
+{
+  grub_uint64_t ms = grub_get_time_ms () - st->start_ms;
+  unsigned long hits, misses, reads;
+  grub_uint64_t bytes;
+
+  grub_disk_cache_get_performance (&hits, &misses);
+  grub_disk_get_device_stats (&reads, &bytes);
+  hits -= st->hits;
+  misses -= st->misses;
+  reads -= st->reads;
+  bytes -= st->bytes;
+
+  printf ("%-10s %" GRUB_HOST_PRIuLONG_LONG " %s in %"
+	  GRUB_HOST_PRIuLONG_LONG " ms", phase, (unsigned long long) count,
+	  unit, (unsigned long long) ms);
+  if (ms)
+    printf (" (%" GRUB_HOST_PRIuLONG_LONG " %s/s)",
+	    (unsigned long long) (count * 1000 / ms), unit);
+  printf ("; disk: %lu reads, %" GRUB_HOST_PRIuLONG_LONG " KiB", reads,
+	  (unsigned long long) (bytes >> 10));
+  if (hits + misses)
+    printf (", cache hits %lu/%lu (%lu.%lu%%)", hits, hits + misses,
+	    (unsigned long) ((grub_uint64_t) hits * 100 / (hits + misses)),
+	    (unsigned long) ((grub_uint64_t) hits * 1000
+			     / (hits + misses) % 10));
+  printf ("\n");
+  return ms;
+}
+
+static int
+bench_dir_hook (const char *filename, const struct grub_dirhook_info *info,
+		void *data)
+{
+  struct bench_ctx *ctx = data;
+  const struct bench_dir *cur = &ctx->dirs[ctx->cur];
+  char *name;
+  int depth = cur->depth + 1;
+
+  if (grub_strcmp (filename, ".") == 0 || grub_strcmp (filename, "..") == 0)
+    return 0;
+
+  ctx->entries++;
+  name = grub_xasprintf ("%s/%s", cur->name, filename);
+  if (!name)
+    grub_util_error ("%s", grub_errmsg);
+
+  if (info->dir)
+    {
+      if (depth > BENCH_MAX_DEPTH)
+	{
+	  grub_free (name);
+	  return 0;
+	}
+      if (ctx->ndirs == ctx->dirs_alloc)
+	{
+	  ctx->dirs_alloc *= 2;
+	  ctx->dirs = xrealloc (ctx->dirs,
+				ctx->dirs_alloc * sizeof (ctx->dirs[0]));
+	}
+      ctx->dirs[ctx->ndirs].name = name;
+      ctx->dirs[ctx->ndirs].depth = depth;
+      ctx->ndirs++;
+    }
+  else
+    {
+      if (ctx->nfiles == ctx->files_alloc)
+	{
+	  ctx->files_alloc = ctx->files_alloc * 2 + 16;
+	  ctx->files = xrealloc (ctx->files,
+				 ctx->files_alloc * sizeof (ctx->files[0]));
+	}
+      ctx->files[ctx->nfiles++] = name;
+    }
+  return 0;
+}
+
+static grub_file_t
+bench_open (const char *name)
+{
+  return grub_file_open (name, ((uncompress == 0)
+				? GRUB_FILE_TYPE_NO_DECOMPRESS
+				: GRUB_FILE_TYPE_NONE)
+			 | GRUB_FILE_TYPE_FSTEST);
+}
+
+/* Measure directory listing, path lookup, sequential and random reads on
+   everything under PATHNAME.  */
+static void
+cmd_bench (char *pathname)
+{
+  static char buf[BUF_SIZE];
+  struct bench_ctx ctx = { 0 };
+  struct bench_stats st;
+  grub_device_t dev;
+  grub_fs_t fs;
+  char *device_name;
+  grub_size_t i, nfailed = 0;
+  grub_uint64_t total = 0, largest_size = 0;
+  const char *largest = NULL;
+  grub_size_t len;
+
+  device_name = grub_file_get_device_name (pathname);
+  dev = grub_device_open (device_name);
+  if (!dev)
+    grub_util_error ("%s", grub_errmsg);
+  fs = grub_fs_probe (dev);
+  if (!fs)
+    grub_util_error ("%s", grub_errmsg);
+
+  /* Directory names are kept with the device and without the trailing
+     slash, files are opened by their full name.  */
+  len = grub_strlen (pathname);
+  while (len > 0 && pathname[len - 1] == '/')
+    len--;
+  ctx.dirs_alloc = 16;
+  ctx.dirs = xmalloc (ctx.dirs_alloc * sizeof (ctx.dirs[0]));
+  ctx.dirs[0].name = grub_strndup (pathname, len);
+  if (!ctx.dirs[0].name)
+    grub_util_error ("%s", grub_errmsg);
+  ctx.dirs[0].depth = 0;
+  ctx.ndirs = 1;
+
+  bench_start (&st);
+  for (ctx.cur = 0; ctx.cur < ctx.ndirs; ctx.cur++)
+    {
+      const char *name = ctx.dirs[ctx.cur].name;
+      const char *dir_path;
+
+      dir_path = grub_strchr (name, ')');
+      dir_path = dir_path ? dir_path + 1 : name;
+      if ((fs->fs_dir) (dev, *dir_path ? dir_path : "/", bench_dir_hook, &ctx))
+	{
+	  grub_util_warn (_("cannot list `%s': %s"), name, grub_errmsg);
+	  grub_errno = GRUB_ERR_NONE;
+	}
+    }
+  bench_report ("list", &st, ctx.entries, "entries");
+
+  bench_start (&st);
+  for (i = 0; i < ctx.nfiles; i++)
+    {
+      grub_file_t file = bench_open (ctx.files[i]);
+
+      if (!file)
+	{
+	  grub_util_info ("cannot open `%s': %s", ctx.files[i], grub_errmsg);
+	  grub_errno = GRUB_ERR_NONE;
+	  nfailed++;
+	  continue;
+	}
+      if (file->size > largest_size)
+	{
+	  largest_size = file->size;
+	  largest = ctx.files[i];
+	}
+      grub_file_close (file);
+    }
+  bench_report ("lookup", &st, ctx.nfiles - nfailed, "files");
+  if (nfailed)
+    printf ("%" GRUB_HOST_PRIuLONG_LONG " files could not be opened\n",
+	    (unsigned long long) nfailed);
+
+  bench_start (&st);
+  for (i = 0; i < ctx.nfiles; i++)
+    {
+      grub_file_t file = bench_open (ctx.files[i]);
+      grub_ssize_t sz;
+
+      if (!file)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  continue;
+	}
+      while ((sz = grub_file_read (file, buf, BUF_SIZE)) > 0)
+	total += sz;
+      if (sz < 0)
+	{
+	  char *msg = grub_xasprintf (_("read error at offset %llu: %s"),
+				      (unsigned long long) file->offset,
+				      grub_errmsg);
+	  grub_util_error ("%s", msg);
+	}
+      grub_file_close (file);
+    }
+  bench_report ("sequential", &st, total >> 10, "KiB");
+
+  if (largest)
+    {
+      grub_file_t file = bench_open (largest);
+      grub_uint32_t state = 1;
+      grub_size_t size = BENCH_RANDOM_SIZE;
+      grub_uint64_t ms;
+
+      if (!file)
+	grub_util_error ("%s", grub_errmsg);
+      if (size > largest_size)
+	size = largest_size;
+
+      bench_start (&st);
+      for (i = 0; i < BENCH_RANDOM_READS; i++)
+	{
+	  grub_uint64_t ofs;
+
+	  state = state * 1103515245 + 12345;
+	  ofs = ((grub_uint64_t) state << 16 | (state >> 16))
+	    % (largest_size - size + 1);
+	  grub_file_seek (file, ofs);
+	  if (grub_file_read (file, buf, size) != (grub_ssize_t) size)
+	    {
+	      char *msg = grub_xasprintf (_("read error at offset %llu: %s"),
+					  (unsigned long long) ofs,
+					  grub_errmsg);
+	      grub_util_error ("%s", msg);
+	    }
+	}
+      ms = bench_report ("random", &st, BENCH_RANDOM_READS, "reads");
+      printf ("%-10s %" GRUB_HOST_PRIuLONG_LONG " bytes each from `%s', %"
+	      GRUB_HOST_PRIuLONG_LONG " us per read\n", "",
+	      (unsigned long long) size, largest,
+	      (unsigned long long) (ms * 1000 / BENCH_RANDOM_READS));
+      grub_file_close (file);
+    }
+
+  for (i = 0; i < ctx.ndirs; i++)
+    grub_free (ctx.dirs[i].name);
+  for (i = 0; i < ctx.nfiles; i++)
+    grub_free (ctx.files[i]);
+  free (ctx.dirs);
+  free (ctx.files);
+  grub_free (device_name);
+  grub_device_close (dev);
+}
+
 static const char *root = NULL;
 static int args_count = 0;
 static int nparm = 0;
@@ -386,7 +665,9 @@ fstest (int n)
 
   for (i = 0; i < num_disks; i++)
     {
-      char *argv[2];
+      char *argv[3];
+      int argc = 0;
+
       loop_name = grub_xasprintf ("loop%d", i);
       if (!loop_name)
 	grub_util_error ("%s", grub_errmsg);
@@ -395,12 +676,18 @@ fstest (int n)
       if (!host_file)
 	grub_util_error ("%s", grub_errmsg);
 
-      argv[0] = loop_name;
-      argv[1] = host_file;
+      /* Host images are mapped into memory, which would bypass the disk
+	 cache and the driver.  The benchmark is about exactly those.  */
+      if (cmd == CMD_BENCH)
+	argv[argc++] = xstrdup ("-n");
+      argv[argc++] = loop_name;
+      argv[argc++] = host_file;
 
-      if (execute_command ("loopback", 2, argv))
+      if (execute_command ("loopback", argc, argv))
         grub_util_error (_("`loopback' command fails: %s"), grub_errmsg);
 
+      if (cmd == CMD_BENCH)
+	free (argv[0]);
       grub_free (loop_name);
       grub_free (host_file);
     }
@@ -450,6 +737,9 @@ fstest (int n)
     case CMD_CRC:
       cmd_crc (args[0]);
       break;
+    case CMD_BENCH:
+      cmd_bench (args[0]);
+      break;
     case CMD_BLOCKLIST:
       execute_command ("blocklist", n, args);
       grub_printf ("\n");
@@ -512,6 +802,7 @@ static struct argp_option options[] = {
   {N_("crc FILE"), 0, 0     , OPTION_DOC, N_("Get crc32 checksum of FILE."), 1},
   {N_("blocklist FILE"), 0, 0, OPTION_DOC, N_("Display blocklist of FILE."), 1},
   {N_("xnu_uuid DEVICE"), 0, 0, OPTION_DOC, N_("Compute XNU UUID of the device."), 1},
+  {N_("bench PATH"), 0, 0, OPTION_DOC, N_("Measure listing, lookup and read speed of the files under PATH."), 1},
   
   {"root",      'r', N_("DEVICE_NAME"), 0, N_("Set root device."),                 2},
   {"skip",      's', N_("NUM"),           0, N_("Skip N bytes from output file."),   2},
@@ -706,6 +997,11 @@ argp_parser (int key, char *arg, struct argp_state *state)
 	  cmd = CMD_XNU_UUID;
 	  nparm = 0;
 	}
+      else if (grub_strcmp (arg, "bench") == 0)
+	{
+	  cmd = CMD_BENCH;
+	  nparm = 1;
+	}
       else
 	{
 	  fprintf (stderr, _("Invalid command %s.\n"), arg);
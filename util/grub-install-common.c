@@ -38,6 +38,7 @@
 #include <grub/emu/hostfile.h>
 #include <grub/emu/config.h>
 #include <grub/emu/hostfile.h>
+#include <grub/dl_pack.h>
 
 #include <stdio.h>
 #include <unistd.h>
@@ -202,6 +203,7 @@ clean_grub_dir (const char *di)
       if ((ext && (strcmp (ext, ".mod") == 0
 		   || strcmp (ext, ".lst") == 0
 		   || strcmp (ext, ".img") == 0
+		   || strcmp (ext, ".pack") == 0
 		   || strcmp (ext, ".mo") == 0)
 	   && strcmp (de->d_name, "menu.lst") != 0)
 	  || strcmp (de->d_name, "efiemu32.o") == 0
@@ -231,6 +233,7 @@ struct install_list install_locales = { 1, 0, 0, 0 };
 struct install_list install_fonts = { 1, 0, 0, 0 };
 struct install_list install_themes = { 1, 0, 0, 0 };
 char *grub_install_source_directory = NULL;
+static int install_module_pack;
 char *grub_install_locale_directory = NULL;
 char *grub_install_themes_directory = NULL;
 
@@ -400,6 +403,9 @@ grub_install_parse (int key, char *arg)
       grub_util_error (_("Unrecognized compression `%s'"), arg);
     case GRUB_INSTALL_OPTIONS_GRUB_MKIMAGE:
       return 1;
+    case GRUB_INSTALL_OPTIONS_MODULE_PACK:
+      install_module_pack = 1;
+      return 1;
     default:
       return 0;
     }
@@ -789,6 +795,231 @@ grub_install_get_platform_platform (enum grub_install_plat platid)
 }
 
 
+struct pack_module
+{
+  char *name;
+  char *path;
+  char **deps;
+  size_t ndeps;
+  int visited;
+  grub_uint32_t index;
+  grub_uint32_t offset;
+  size_t size;
+};
+
+static struct pack_module *
+pack_find (struct pack_module *mods, size_t nmods, const char *name)
+{
+  size_t i;
+
+  for (i = 0; i < nmods; i++)
+    if (strcmp (mods[i].name, name) == 0)
+      return &mods[i];
+  return NULL;
+}
+
+/* Put MOD into ORDER after all its dependencies.  */
+static void
+pack_order (struct pack_module *mods, size_t nmods, struct pack_module *mod,
+	    struct pack_module **order, size_t *norder)
+{
+  size_t i;
+
+  if (mod->visited)
+    return;
+  mod->visited = 1;
+  for (i = 0; i < mod->ndeps; i++)
+    {
+      struct pack_module *dep = pack_find (mods, nmods, mod->deps[i]);
+      if (dep)
+	pack_order (mods, nmods, dep, order, norder);
+    }
+  mod->index = *norder;
+  order[(*norder)++] = mod;
+}
+
+static void
+pack_write (FILE *out, const void *buf, size_t size, const char *name)
+{
+  if (size && fwrite (buf, 1, size, out) != size)
+    grub_util_error (_("cannot write to `%s': %s"), name, strerror (errno));
+}
+
+static void
+pack_pad (FILE *out, size_t *pos, const char *name)
+{
+  static const char zeros[GRUB_DL_PACK_ALIGN];
+  size_t pad = ALIGN_UP (*pos, GRUB_DL_PACK_ALIGN) - *pos;
+
+  pack_write (out, zeros, pad, name);
+  *pos += pad;
+}
+
+/* Write the modules NAMES from SRC, with their dependencies from
+   moddep.lst, into DST/modules.pack.  */
+static void
+grub_install_make_module_pack (const char *src, const char *dst,
+			       char **names, size_t nnames)
+{
+  struct pack_module *mods, **order;
+  size_t nmods = 0, norder = 0, i, j, pos;
+  grub_uint32_t index_size, deps_size = 0, names_size = 0, off, data;
+  struct grub_dl_pack_header head;
+  char *depfile, *tmp, *dstf;
+  char line[1024];
+  FILE *fp, *out;
+
+  mods = xmalloc (nnames * sizeof (mods[0]));
+  for (i = 0; i < nnames; i++)
+    {
+      char *modfile = xasprintf ("%s.mod", names[i]);
+      mods[nmods].path = grub_util_path_concat (2, src, modfile);
+      free (modfile);
+      if (!grub_util_is_regular (mods[nmods].path))
+	{
+	  free (mods[nmods].path);
+	  continue;
+	}
+      mods[nmods].name = xstrdup (names[i]);
+      mods[nmods].deps = NULL;
+      mods[nmods].ndeps = 0;
+      mods[nmods].visited = 0;
+      mods[nmods].size = grub_util_get_image_size (mods[nmods].path);
+      nmods++;
+    }
+
+  depfile = grub_util_path_concat (2, src, "moddep.lst");
+  fp = grub_util_fopen (depfile, "r");
+  if (!fp)
+    grub_util_error (_("cannot open `%s': %s"), depfile, strerror (errno));
+  while (fgets (line, sizeof (line), fp))
+    {
+      char *p = strchr (line, ':'), *tok;
+      struct pack_module *mod;
+
+      if (!p)
+	continue;
+      *p++ = '\0';
+      mod = pack_find (mods, nmods, line);
+      if (!mod)
+	continue;
+      for (tok = strtok (p, " \t\r\n"); tok; tok = strtok (NULL, " \t\r\n"))
+	{
+	  mod->deps = xrealloc (mod->deps, (mod->ndeps + 1)
+				* sizeof (mod->deps[0]));
+	  mod->deps[mod->ndeps++] = xstrdup (tok);
+	}
+    }
+  fclose (fp);
+  free (depfile);
+
+  /* xmalloc fails on a zero size.  */
+  order = xmalloc ((nmods ? nmods : 1) * sizeof (order[0]));
+  for (i = 0; i < nmods; i++)
+    pack_order (mods, nmods, &mods[i], order, &norder);
+
+  for (i = 0; i < nmods; i++)
+    {
+      names_size += strlen (order[i]->name) + 1;
+      for (j = 0; j < order[i]->ndeps; j++)
+	if (pack_find (mods, nmods, order[i]->deps[j]))
+	  deps_size += sizeof (grub_uint32_t);
+    }
+  index_size = nmods * sizeof (struct grub_dl_pack_entry) + deps_size
+    + names_size;
+  /* The index has to end with a NUL even when empty.  */
+  if (!nmods)
+    index_size = 1;
+
+  data = ALIGN_UP (sizeof (head) + index_size, GRUB_DL_PACK_ALIGN);
+  for (i = 0; i < nmods; i++)
+    {
+      order[i]->offset = data;
+      data = ALIGN_UP (data + order[i]->size, GRUB_DL_PACK_ALIGN);
+    }
+
+  tmp = grub_util_make_temporary_file ();
+  out = grub_util_fopen (tmp, "wb");
+  if (!out)
+    grub_util_error (_("cannot open `%s': %s"), tmp, strerror (errno));
+
+  memcpy (head.magic, GRUB_DL_PACK_MAGIC, sizeof (head.magic));
+  head.nmodules = grub_cpu_to_le32 (nmods);
+  head.index_size = grub_cpu_to_le32 (index_size);
+  pack_write (out, &head, sizeof (head), tmp);
+
+  /* Entries, then dependency arrays, then names.  */
+  off = nmods * sizeof (struct grub_dl_pack_entry);
+  data = off + deps_size;
+  for (i = 0; i < nmods; i++)
+    {
+      struct grub_dl_pack_entry ent;
+      grub_uint32_t ndeps = 0;
+
+      for (j = 0; j < order[i]->ndeps; j++)
+	if (pack_find (mods, nmods, order[i]->deps[j]))
+	  ndeps++;
+      ent.name = grub_cpu_to_le32 (data);
+      ent.offset = grub_cpu_to_le32 (order[i]->offset);
+      ent.size = grub_cpu_to_le32 (order[i]->size);
+      ent.ndeps = grub_cpu_to_le32 (ndeps);
+      ent.deps = grub_cpu_to_le32 (off);
+      pack_write (out, &ent, sizeof (ent), tmp);
+      off += ndeps * sizeof (grub_uint32_t);
+      data += strlen (order[i]->name) + 1;
+    }
+  for (i = 0; i < nmods; i++)
+    for (j = 0; j < order[i]->ndeps; j++)
+      {
+	struct pack_module *dep = pack_find (mods, nmods, order[i]->deps[j]);
+	grub_uint32_t idx;
+
+	if (!dep)
+	  continue;
+	idx = grub_cpu_to_le32 (dep->index);
+	pack_write (out, &idx, sizeof (idx), tmp);
+      }
+  for (i = 0; i < nmods; i++)
+    pack_write (out, order[i]->name, strlen (order[i]->name) + 1, tmp);
+  if (!nmods)
+    pack_write (out, "", 1, tmp);
+
+  pos = sizeof (head) + index_size;
+  for (i = 0; i < nmods; i++)
+    {
+      char *img;
+
+      pack_pad (out, &pos, tmp);
+      img = grub_util_read_image (order[i]->path);
+      pack_write (out, img, order[i]->size, tmp);
+      pos += order[i]->size;
+      free (img);
+    }
+
+  grub_util_file_sync (out);
+  if (fclose (out) != 0)
+    grub_util_error (_("cannot write to `%s': %s"), tmp, strerror (errno));
+
+  /* Never compressed: GRUB seeks to each module, and a compressed file
+     would be decompressed from the start for every one of them.  */
+  dstf = grub_util_path_concat (2, dst, GRUB_DL_PACK_NAME);
+  grub_install_copy_file (tmp, dstf, 1);
+  grub_util_unlink (tmp);
+  free (dstf);
+  free (tmp);
+
+  for (i = 0; i < nmods; i++)
+    {
+      for (j = 0; j < mods[i].ndeps; j++)
+	free (mods[i].deps[j]);
+      free (mods[i].deps);
+      free (mods[i].name);
+      free (mods[i].path);
+    }
+  free (mods);
+  free (order);
+}
+
 void
 grub_install_copy_files (const char *src,
 			 const char *dst,
@@ -797,6 +1028,7 @@ grub_install_copy_files (const char *src,
   char *dst_platform, *dst_fonts;
   const char *pkgdatadir = grub_util_get_pkgdatadir ();
   char *themes_dir;
+  size_t i;
 
   {
     char *platform;
@@ -813,10 +1045,41 @@ grub_install_copy_files (const char *src,
   grub_install_copy_nls(src, dst);
 
   if (install_modules.is_default)
-    copy_by_ext (src, dst_platform, ".mod", 1);
+    {
+      copy_by_ext (src, dst_platform, ".mod", 1);
+      if (install_module_pack)
+	{
+	  grub_util_fd_dir_t d;
+	  grub_util_fd_dirent_t de;
+	  char **names = NULL;
+	  size_t nnames = 0;
+
+	  d = grub_util_fd_opendir (src);
+	  if (!d)
+	    grub_util_error (_("cannot open directory `%s': %s"),
+			     src, grub_util_fd_strerror ());
+	  while ((de = grub_util_fd_readdir (d)))
+	    {
+	      const char *ext = strrchr (de->d_name, '.');
+	      if (!ext || strcmp (ext, ".mod") != 0)
+		continue;
+	      names = xrealloc (names, (nnames + 1) * sizeof (names[0]));
+	      names[nnames] = xstrdup (de->d_name);
+	      names[nnames++][ext - de->d_name] = '\0';
+	    }
+	  grub_util_fd_closedir (d);
+
+	  grub_install_make_module_pack (src, dst_platform, names, nnames);
+	  for (i = 0; i < nnames; i++)
+	    free (names[i]);
+	  free (names);
+	}
+    }
   else
     {
       struct grub_util_path_list *path_list, *p;
+      char **names = NULL;
+      size_t nnames = 0;
 
       path_list = grub_util_resolve_dependencies (src, "moddep.lst",
 						  install_modules.entries);
@@ -824,7 +1087,7 @@ grub_install_copy_files (const char *src,
 	{
 	  const char *srcf = p->name;
 	  const char *dir;
-	  char *dstf;
+	  char *dstf, *ext;
 
 	  dir = grub_strrchr (srcf, '/');
 	  if (dir)
@@ -834,9 +1097,22 @@ grub_install_copy_files (const char *src,
 	  dstf = grub_util_path_concat (2, dst_platform, dir);
 	  grub_install_compress_file (srcf, dstf, 1);
 	  free (dstf);
+
+	  names = xrealloc (names, (nnames + 1) * sizeof (names[0]));
+	  names[nnames] = xstrdup (dir);
+	  ext = strrchr (names[nnames], '.');
+	  if (ext)
+	    *ext = '\0';
+	  nnames++;
 	}
 
       grub_util_free_path_list (path_list);
+
+      if (install_module_pack)
+	grub_install_make_module_pack (src, dst_platform, names, nnames);
+      for (i = 0; i < nnames; i++)
+	free (names[i]);
+      free (names);
     }
 
   const char *pkglib_DATA[] = {"efiemu32.o", "efiemu64.o",
@@ -845,7 +1121,6 @@ grub_install_copy_files (const char *src,
 			       "parttool.lst",
 			       "video.lst", "crypto.lst",
 			       "terminal.lst", "modinfo.sh" };
-  size_t i;
 
   for (i = 0; i < ARRAY_SIZE (pkglib_DATA); i++)
     {
@@ -40,6 +40,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <stdlib.h>
+#include <pthread.h>
 
 #pragma GCC diagnostic ignored "-Wmissing-prototypes"
 #pragma GCC diagnostic ignored "-Wmissing-declarations"
@@ -59,6 +60,176 @@ static int fuse_argc = 0;
 static int num_disks = 0;
 static int mount_crypt = 0;
 
+/* FUSE runs multithreaded, but the GRUB disk and filesystem stack keeps
+   global state (grub_errno, the disk cache, per-filesystem data), so every
+   call into it is made with grub_lock held.  Attributes are cached
+   separately, the image is read-only, so getattr on a path that was seen
+   before never has to wait for GRUB.  */
+static pthread_mutex_t grub_lock = PTHREAD_MUTEX_INITIALIZER;
+
+struct attr_cache_entry
+{
+  struct attr_cache_entry *next;
+  int exists;
+  struct stat st;
+  char path[0];
+};
+
+/* Upper bound on cached paths.  Once reached, inserting drops the other
+   entries of the bucket the new one goes to.  */
+#define ATTR_CACHE_MAX_ENTRIES 65536
+
+static pthread_mutex_t attr_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct attr_cache_entry **attr_cache;
+static grub_size_t attr_cache_buckets;
+static grub_size_t attr_cache_count;
+
+static grub_size_t
+attr_cache_hash (const char *path)
+{
+  grub_size_t hash = 5381;
+
+  while (*path)
+    hash = hash * 33 + (grub_uint8_t) *path++;
+  return hash;
+}
+
+/* Look up PATH.  On a hit set *EXISTS and, if the file exists, *ST and
+   return 1.  */
+static int
+attr_cache_lookup (const char *path, struct stat *st, int *exists)
+{
+  struct attr_cache_entry *entry;
+  int found = 0;
+
+  pthread_mutex_lock (&attr_cache_lock);
+  if (attr_cache)
+    for (entry = attr_cache[attr_cache_hash (path) & (attr_cache_buckets - 1)];
+	 entry; entry = entry->next)
+      if (strcmp (entry->path, path) == 0)
+	{
+	  *exists = entry->exists;
+	  if (entry->exists)
+	    *st = entry->st;
+	  found = 1;
+	  break;
+	}
+  pthread_mutex_unlock (&attr_cache_lock);
+  return found;
+}
+
+static void
+attr_cache_grow (void)
+{
+  struct attr_cache_entry **n, *entry, *next;
+  grub_size_t size, i, h;
+
+  size = attr_cache_buckets ? attr_cache_buckets * 2 : 1024;
+  n = xmalloc (size * sizeof (n[0]));
+  memset (n, 0, size * sizeof (n[0]));
+  for (i = 0; i < attr_cache_buckets; i++)
+    for (entry = attr_cache[i]; entry; entry = next)
+      {
+	next = entry->next;
+	h = attr_cache_hash (entry->path) & (size - 1);
+	entry->next = n[h];
+	n[h] = entry;
+      }
+  free (attr_cache);
+  attr_cache = n;
+  attr_cache_buckets = size;
+}
+
+static void
+attr_cache_insert (const char *path, const struct stat *st)
+{
+  struct attr_cache_entry *entry, *next;
+  grub_size_t h;
+
+  pthread_mutex_lock (&attr_cache_lock);
+  if (attr_cache_count >= attr_cache_buckets * 2
+      && attr_cache_buckets < ATTR_CACHE_MAX_ENTRIES / 2)
+    attr_cache_grow ();
+
+  h = attr_cache_hash (path) & (attr_cache_buckets - 1);
+  for (entry = attr_cache[h]; entry; entry = entry->next)
+    if (strcmp (entry->path, path) == 0)
+      break;
+  if (! entry && attr_cache_count >= ATTR_CACHE_MAX_ENTRIES)
+    {
+      for (entry = attr_cache[h]; entry; entry = next)
+	{
+	  next = entry->next;
+	  free (entry);
+	  attr_cache_count--;
+	}
+      attr_cache[h] = NULL;
+    }
+  if (! entry)
+    {
+      entry = xmalloc (sizeof (*entry) + strlen (path) + 1);
+      strcpy (entry->path, path);
+      entry->next = attr_cache[h];
+      attr_cache[h] = entry;
+      attr_cache_count++;
+    }
+  entry->exists = !! st;
+  if (st)
+    entry->st = *st;
+  pthread_mutex_unlock (&attr_cache_lock);
+}
+
+static void
+attr_cache_free (void)
+{
+  struct attr_cache_entry *entry, *next;
+  grub_size_t i;
+
+  for (i = 0; i < attr_cache_buckets; i++)
+    for (entry = attr_cache[i]; entry; entry = next)
+      {
+	next = entry->next;
+	free (entry);
+      }
+  free (attr_cache);
+  attr_cache = NULL;
+  attr_cache_buckets = attr_cache_count = 0;
+}
+
+/* Fill *ST for a directory entry, opening regular files to learn their
+   size.  Must be called with grub_lock held.  If the file can't be opened
+   the error is left in grub_errno.  */
+static grub_err_t
+fill_stat (const char *path, const struct grub_dirhook_info *info,
+	   struct stat *st)
+{
+  memset (st, 0, sizeof (*st));
+  st->st_mode = info->dir ? (0555 | S_IFDIR) : (0444 | S_IFREG);
+  if (!info->dir)
+    {
+      grub_file_t file;
+      file = grub_file_open (path, GRUB_FILE_TYPE_GET_SIZE);
+      /* Symlink to directory.  */
+      if (! file && grub_errno == GRUB_ERR_BAD_FILE_TYPE)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  st->st_mode = (0555 | S_IFDIR);
+	}
+      else if (! file)
+	return grub_errno;
+      else
+	{
+	  st->st_size = file->size;
+	  grub_file_close (file);
+	}
+    }
+  st->st_blksize = 512;
+  st->st_blocks = (st->st_size + 511) >> 9;
+  st->st_atime = st->st_mtime = st->st_ctime
+    = info->mtimeset ? info->mtime : 0;
+  return GRUB_ERR_NONE;
+}
+
 static grub_err_t
 execute_command (const char *name, int n, char **args)
 {
@@ -151,6 +322,7 @@ fuse_getattr (const char *path, struct stat *st)
 {
   struct fuse_getattr_ctx ctx;
   char *pathname, *path2;
+  int exists;
   
   if (path[0] == '/' && path[1] == 0)
     {
@@ -167,6 +339,9 @@ fuse_getattr (const char *path, struct stat *st)
       return 0;
     }
 
+  if (attr_cache_lookup (path, st, &exists))
+    return exists ? 0 : -ENOENT;
+
   ctx.file_exists = 0;
 
   pathname = xstrdup (path);
@@ -189,44 +364,30 @@ fuse_getattr (const char *path, struct stat *st)
       path2[ctx.filename - pathname] = 0;
     }
 
+  pthread_mutex_lock (&grub_lock);
+
   /* It's the whole device. */
   (fs->fs_dir) (dev, path2, fuse_getattr_find_file, &ctx);
 
   grub_free (path2);
+  free (pathname);
   if (!ctx.file_exists)
     {
       grub_errno = GRUB_ERR_NONE;
+      pthread_mutex_unlock (&grub_lock);
+      attr_cache_insert (path, NULL);
       return -ENOENT;
     }
-  st->st_dev = 0;
-  st->st_ino = 0;
-  st->st_mode = ctx.file_info.dir ? (0555 | S_IFDIR) : (0444 | S_IFREG);
-  st->st_uid = 0;
-  st->st_gid = 0;
-  st->st_rdev = 0;
-  st->st_size = 0;
-  if (!ctx.file_info.dir)
+  /* Errors are not cached, a later attempt may succeed.  */
+  if (fill_stat (path, &ctx.file_info, st) != GRUB_ERR_NONE)
     {
-      grub_file_t file;
-      file = grub_file_open (path, GRUB_FILE_TYPE_GET_SIZE);
-      if (! file && grub_errno == GRUB_ERR_BAD_FILE_TYPE)
-	{
-	  grub_errno = GRUB_ERR_NONE;
-	  st->st_mode = (0555 | S_IFDIR);
-	}
-      else if (! file)
-	return translate_error ();
-      else
-	{
-	  st->st_size = file->size;
-	  grub_file_close (file);
-	}
+      int ret = translate_error ();
+      pthread_mutex_unlock (&grub_lock);
+      return ret;
     }
-  st->st_blksize = 512;
-  st->st_blocks = (st->st_size + 511) >> 9;
-  st->st_atime = st->st_mtime = st->st_ctime = ctx.file_info.mtimeset
-    ? ctx.file_info.mtime : 0;
-  grub_errno = GRUB_ERR_NONE;
+  pthread_mutex_unlock (&grub_lock);
+
+  attr_cache_insert (path, st);
   return 0;
 }
 
@@ -236,52 +397,125 @@ fuse_opendir (const char *path, struct fuse_file_info *fi)
   return 0;
 }
 
-/* FIXME */
-static grub_file_t files[65536];
-static int first_fd = 1;
+/* Open files, indexed by fi->fh.  Free slots are chained through
+   free_handles so that they get reused.  */
+static grub_file_t *files;
+static grub_size_t num_files;
+static grub_size_t *free_handles;
+static grub_size_t num_free_handles;
+static pthread_mutex_t files_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static grub_size_t
+alloc_handle (grub_file_t file)
+{
+  grub_size_t fh;
+
+  pthread_mutex_lock (&files_lock);
+  if (num_free_handles)
+    fh = free_handles[--num_free_handles];
+  else
+    {
+      if ((num_files & (num_files - 1)) == 0)
+	{
+	  files = xrealloc (files, (num_files ? num_files * 2 : 16)
+			    * sizeof (files[0]));
+	  free_handles = xrealloc (free_handles,
+				   (num_files ? num_files * 2 : 16)
+				   * sizeof (free_handles[0]));
+	}
+      fh = num_files++;
+    }
+  files[fh] = file;
+  pthread_mutex_unlock (&files_lock);
+  return fh;
+}
+
+static grub_file_t
+get_handle (grub_size_t fh)
+{
+  grub_file_t file = NULL;
+
+  pthread_mutex_lock (&files_lock);
+  if (fh < num_files)
+    file = files[fh];
+  pthread_mutex_unlock (&files_lock);
+  return file;
+}
+
+static grub_file_t
+free_handle (grub_size_t fh)
+{
+  grub_file_t file = NULL;
+
+  pthread_mutex_lock (&files_lock);
+  if (fh < num_files && files[fh])
+    {
+      file = files[fh];
+      files[fh] = NULL;
+      free_handles[num_free_handles++] = fh;
+    }
+  pthread_mutex_unlock (&files_lock);
+  return file;
+}
 
 static int 
 fuse_open (const char *path, struct fuse_file_info *fi __attribute__ ((unused)))
 {
   grub_file_t file;
+  int ret = 0;
+
+  pthread_mutex_lock (&grub_lock);
   file = grub_file_open (path, GRUB_FILE_TYPE_MOUNT);
   if (! file)
-    return translate_error ();
-  files[first_fd++] = file;
-  fi->fh = first_fd;
-  files[first_fd++] = file;
+    ret = translate_error ();
+  else
+    fi->fh = alloc_handle (file);
   grub_errno = GRUB_ERR_NONE;
-  return 0;
+  pthread_mutex_unlock (&grub_lock);
+  return ret;
 } 
 
 static int 
 fuse_read (const char *path, char *buf, size_t sz, off_t off,
 	   struct fuse_file_info *fi)
 {
-  grub_file_t file = files[fi->fh];
+  grub_file_t file = get_handle (fi->fh);
   grub_ssize_t size;
+  int ret;
+
+  if (! file)
+    return -EBADF;
 
   if (off > file->size)
     return -EINVAL;
 
+  pthread_mutex_lock (&grub_lock);
   file->offset = off;
   
   size = grub_file_read (file, buf, sz);
   if (size < 0)
-    return translate_error ();
+    ret = translate_error ();
   else
     {
       grub_errno = GRUB_ERR_NONE;
-      return size;
+      ret = size;
     }
+  pthread_mutex_unlock (&grub_lock);
+  return ret;
 } 
 
 static int 
 fuse_release (const char *path, struct fuse_file_info *fi)
 {
-  grub_file_close (files[fi->fh]);
-  files[fi->fh] = NULL;
+  grub_file_t file = free_handle (fi->fh);
+
+  if (! file)
+    return 0;
+
+  pthread_mutex_lock (&grub_lock);
+  grub_file_close (file);
   grub_errno = GRUB_ERR_NONE;
+  pthread_mutex_unlock (&grub_lock);
   return 0;
 }
 
@@ -300,36 +534,18 @@ fuse_readdir_call_fill (const char *filename,
 {
   struct fuse_readdir_ctx *ctx = data;
   struct stat st;
-
-  grub_memset (&st, 0, sizeof (st));
-  st.st_mode = info->dir ? (0555 | S_IFDIR) : (0444 | S_IFREG);
-  if (!info->dir)
-    {
-      grub_file_t file;
-      char *tmp;
-      tmp = xasprintf ("%s/%s", ctx->path, filename);
-      file = grub_file_open (tmp, GRUB_FILE_TYPE_GET_SIZE);
-      free (tmp);
-      /* Symlink to directory.  */
-      if (! file && grub_errno == GRUB_ERR_BAD_FILE_TYPE)
-	{
-	  grub_errno = GRUB_ERR_NONE;
-	  st.st_mode = (0555 | S_IFDIR);
-	}
-      else if (!file)
-	{
-	  grub_errno = GRUB_ERR_NONE;
-	}
-      else
-	{
-	  st.st_size = file->size;
-	  grub_file_close (file);
-	}
-    }
-  st.st_blksize = 512;
-  st.st_blocks = (st.st_size + 511) >> 9;
-  st.st_atime = st.st_mtime = st.st_ctime
-    = info->mtimeset ? info->mtime : 0;
+  char *tmp;
+
+  tmp = xasprintf ("%s/%s", ctx->path[1] ? ctx->path : "", filename);
+  /* The later getattr on this entry is answered from the cache.  Only
+     case-sensitive names are cached, a lookup with a different case has
+     to go through the filesystem.  An entry that can't be opened is
+     listed anyway, but getattr has to report the error itself.  */
+  if (fill_stat (tmp, info, &st) != GRUB_ERR_NONE)
+    grub_errno = GRUB_ERR_NONE;
+  else if (! info->case_insensitive)
+    attr_cache_insert (tmp, &st);
+  free (tmp);
   ctx->fill (ctx->buf, filename, &st, 0);
   return 0;
 }
@@ -352,9 +568,13 @@ fuse_readdir (const char *path, void *buf,
 	 && pathname[grub_strlen (pathname) - 1] == '/')
     pathname[grub_strlen (pathname) - 1] = 0;
 
+  ctx.path = pathname;
+
+  pthread_mutex_lock (&grub_lock);
   (fs->fs_dir) (dev, pathname, fuse_readdir_call_fill, &ctx);
-  free (pathname);
   grub_errno = GRUB_ERR_NONE;
+  pthread_mutex_unlock (&grub_lock);
+  free (pathname);
   return 0;
 }
 
@@ -427,6 +647,10 @@ fuse_init (void)
   if (fuse_main (fuse_argc, fuse_args, &grub_opers, NULL))
     grub_error (GRUB_ERR_IO, "fuse_main failed");
 
+  attr_cache_free ();
+  free (files);
+  free (free_handles);
+
   for (i = 0; i < num_disks; i++)
     {
       char *argv[2];
@@ -562,12 +786,9 @@ main (int argc, char *argv[])
 
   grub_util_host_init (&argc, &argv);
 
-  fuse_args = xrealloc (fuse_args, (fuse_argc + 2) * sizeof (fuse_args[0]));
+  fuse_args = xrealloc (fuse_args, (fuse_argc + 1) * sizeof (fuse_args[0]));
   fuse_args[fuse_argc] = xstrdup (argv[0]);
   fuse_argc++;
-  /* Run single-threaded.  */
-  fuse_args[fuse_argc] = xstrdup ("-s");
-  fuse_argc++;
 
   argp_parse (&argp, argc, argv, 0, 0, 0);
   
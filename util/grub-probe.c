@@ -30,6 +30,7 @@
 #include <grub/gpt_partition.h>
 #include <grub/i386/pc/boot.h>
 #include <grub/emu/hostdisk.h>
+#include <grub/emu/hostfile.h>
 #include <grub/emu/getroot.h>
 #include <grub/term.h>
 #include <grub/env.h>
@@ -45,6 +46,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #define _GNU_SOURCE	1
 
@@ -106,6 +110,204 @@ static const char *targets[] =
 static int print = PRINT_FS;
 static unsigned int argument_is_device = 0;
 
+/* Results of the OS device lookups, kept in the file named by --cache or
+   $GRUB_PROBE_CACHE so that the many grub-probe calls of a grub-mkconfig
+   run resolve each path and device once.  Path entries are keyed by the
+   path and the st_dev it lives on, drive entries by the device node, its
+   st_rdev and st_mtime and the size of the device, so a re-created node
+   or a partition that changed size is looked up again.  The cache still
+   can't notice every change of the disk layout, so it is only meant to
+   live for one grub-mkconfig run.
+   Each line holds a key, a NUL and the value, a list separated by
+   tabs.  */
+struct probe_cache_entry
+{
+  char *key;
+  char *value;
+};
+
+static struct probe_cache_entry *probe_cache;
+static size_t probe_cache_count;
+static const char *probe_cache_file;
+static int probe_cache_dirty;
+
+static const char *
+probe_cache_get (const char *key)
+{
+  size_t i;
+
+  for (i = 0; i < probe_cache_count; i++)
+    if (strcmp (probe_cache[i].key, key) == 0)
+      return probe_cache[i].value;
+  return NULL;
+}
+
+static void
+probe_cache_put (char *key, char *value)
+{
+  probe_cache = xrealloc (probe_cache, (probe_cache_count + 1)
+			  * sizeof (probe_cache[0]));
+  probe_cache[probe_cache_count].key = key;
+  probe_cache[probe_cache_count].value = value;
+  probe_cache_count++;
+  probe_cache_dirty = 1;
+}
+
+static void
+probe_cache_load (void)
+{
+  FILE *f;
+  char *line = NULL;
+  size_t len = 0;
+  ssize_t n;
+
+  f = grub_util_fopen (probe_cache_file, "r");
+  if (!f)
+    return;
+
+  while ((n = getline (&line, &len, f)) > 0)
+    {
+      char *sep;
+
+      if (line[n - 1] == '\n')
+	line[n - 1] = '\0';
+      /* Paths may contain anything but NUL, so that separates the key.  */
+      sep = memchr (line, '\0', n);
+      if (!sep || sep == line + n - 1)
+	continue;
+      probe_cache = xrealloc (probe_cache, (probe_cache_count + 1)
+			      * sizeof (probe_cache[0]));
+      probe_cache[probe_cache_count].key = xstrdup (line);
+      probe_cache[probe_cache_count].value = xstrdup (sep + 1);
+      probe_cache_count++;
+    }
+  free (line);
+  fclose (f);
+}
+
+static void
+probe_cache_save (void)
+{
+  FILE *f;
+  char *tmp;
+  size_t i;
+
+  if (!probe_cache_dirty)
+    return;
+
+  /* Write a new file and rename it over the old one so that a concurrent
+     reader never sees a partial cache.  */
+  tmp = xasprintf ("%s.%d", probe_cache_file, (int) getpid ());
+  f = grub_util_fopen (tmp, "w");
+  if (!f)
+    {
+      grub_util_info ("cannot write `%s': %s", tmp, strerror (errno));
+      free (tmp);
+      return;
+    }
+  for (i = 0; i < probe_cache_count; i++)
+    fprintf (f, "%s%c%s\n", probe_cache[i].key, '\0', probe_cache[i].value);
+  if (fclose (f) != 0 || rename (tmp, probe_cache_file) != 0)
+    {
+      grub_util_info ("cannot write `%s': %s", probe_cache_file,
+		      strerror (errno));
+      unlink (tmp);
+    }
+  free (tmp);
+}
+
+static void
+probe_cache_free (void)
+{
+  size_t i;
+
+  for (i = 0; i < probe_cache_count; i++)
+    {
+      free (probe_cache[i].key);
+      free (probe_cache[i].value);
+    }
+  free (probe_cache);
+  probe_cache = NULL;
+  probe_cache_count = 0;
+}
+
+/* grub_guess_root_devices with the cache in front.  */
+static char **
+guess_root_devices (const char *path)
+{
+  struct stat st;
+  const char *value;
+  char *key, **devices, **ptr, *p;
+  size_t n, len;
+
+  if (!probe_cache_file || stat (path, &st) != 0)
+    return grub_guess_root_devices (path);
+
+  key = xasprintf ("path %s %llx", path, (unsigned long long) st.st_dev);
+  value = probe_cache_get (key);
+  if (value)
+    {
+      free (key);
+      for (n = 1, p = (char *) value; (p = strchr (p, '\t')); p++, n++);
+      devices = xmalloc ((n + 1) * sizeof (devices[0]));
+      for (ptr = devices; ; ptr++)
+	{
+	  p = strchr (value, '\t');
+	  len = p ? (size_t) (p - value) : strlen (value);
+	  *ptr = xmalloc (len + 1);
+	  memcpy (*ptr, value, len);
+	  (*ptr)[len] = '\0';
+	  if (!p)
+	    break;
+	  value = p + 1;
+	}
+      ptr[1] = NULL;
+      return devices;
+    }
+
+  devices = grub_guess_root_devices (path);
+  if (!devices || !devices[0])
+    {
+      free (key);
+      return devices;
+    }
+
+  for (len = 0, ptr = devices; *ptr; ptr++)
+    len += strlen (*ptr) + 1;
+  p = xmalloc (len);
+  p[0] = '\0';
+  for (ptr = devices; *ptr; ptr++)
+    {
+      if (ptr != devices)
+	strcat (p, "\t");
+      strcat (p, *ptr);
+    }
+  probe_cache_put (key, p);
+  return devices;
+}
+
+static char *
+drive_cache_key (const char *os_dev)
+{
+  struct stat st;
+  grub_util_fd_t fd;
+  grub_uint64_t size;
+
+  if (!probe_cache_file || stat (os_dev, &st) != 0)
+    return NULL;
+
+  fd = grub_util_fd_open (os_dev, GRUB_UTIL_FD_O_RDONLY);
+  if (!GRUB_UTIL_FD_IS_VALID (fd))
+    return NULL;
+  size = grub_util_get_fd_size (fd, os_dev, NULL);
+  grub_util_fd_close (fd);
+
+  return xasprintf ("drive %s %llx %llx %llx", os_dev,
+		    (unsigned long long) st.st_rdev,
+		    (unsigned long long) st.st_mtime,
+		    (unsigned long long) size);
+}
+
 static char *
 get_targets_string (void)
 {
@@ -321,7 +523,7 @@ probe (const char *path, char **device_names, char delim)
       grub_path = grub_canonicalize_file_name (path);
       if (! grub_path)
 	grub_util_error (_("failed to get canonical path of `%s'"), path);
-      device_names = grub_guess_root_devices (grub_path);
+      device_names = guess_root_devices (grub_path);
       free (grub_path);
     }
 
@@ -357,23 +559,53 @@ probe (const char *path, char **device_names, char delim)
     }
 
   for (curdev = device_names; *curdev; curdev++)
+    ndev++;
+
+  drives_names = xmalloc (sizeof (drives_names[0]) * (ndev + 1)); 
+
+  /* Printing the drive does not open it, so when every drive is known the
+     costly device scan can be skipped altogether.  */
+  if (print == PRINT_DRIVE)
     {
-      grub_util_pull_device (*curdev);
-      ndev++;
+      for (curdev = device_names, curdrive = drives_names; *curdev; curdev++,
+	   curdrive++)
+	{
+	  char *key = drive_cache_key (*curdev);
+	  const char *value = key ? probe_cache_get (key) : NULL;
+
+	  free (key);
+	  if (!value)
+	    break;
+	  *curdrive = xstrdup (value);
+	}
+      *curdrive = 0;
+      if (!*curdev)
+	goto print_drives;
+      for (curdrive = drives_names; *curdrive; curdrive++)
+	free (*curdrive);
     }
-  
-  drives_names = xmalloc (sizeof (drives_names[0]) * (ndev + 1)); 
+
+  for (curdev = device_names; *curdev; curdev++)
+    grub_util_pull_device (*curdev);
 
   for (curdev = device_names, curdrive = drives_names; *curdev; curdev++,
        curdrive++)
     {
+      char *key;
+
       *curdrive = grub_util_get_grub_dev (*curdev);
       if (! *curdrive)
 	grub_util_error (_("cannot find a GRUB drive for %s.  Check your device.map"),
 			 *curdev);
+      key = drive_cache_key (*curdev);
+      if (key && !probe_cache_get (key))
+	probe_cache_put (key, xstrdup (*curdrive));
+      else
+	free (key);
     }
   *curdrive = 0;
 
+ print_drives:
   if (print == PRINT_DRIVE)
     {
       for (curdrive = drives_names; *curdrive; curdrive++)
@@ -734,6 +966,8 @@ static struct argp_option options[] = {
   {"target",  't', N_("TARGET"), 0, 0, 0},
   {"verbose",     'v', 0,      0, N_("print verbose messages."), 0},
   {0, '0', 0, 0, N_("separate items in output using ASCII NUL characters"), 0},
+  {"cache",  'c', N_("FILE"), 0,
+   N_("remember device lookups in FILE [default=$GRUB_PROBE_CACHE]"), 0},
   { 0, 0, 0, 0, 0, 0 }
 };
 
@@ -815,6 +1049,10 @@ argp_parser (int key, char *arg, struct argp_state *state)
       arguments->zero_delim = 1;
       break;
 
+    case 'c':
+      probe_cache_file = arg;
+      break;
+
     case 'v':
       verbosity++;
       break;
@@ -836,9 +1074,9 @@ argp_parser (int key, char *arg, struct argp_state *state)
 }
 
 static struct argp argp = {
-  options, argp_parser, N_("[OPTION]... [PATH|DEVICE]"),
+  options, argp_parser, N_("[OPTION]... [PATH...|DEVICE]"),
   N_("\
-Probe device information for a given path (or device, if the -d option is given)."),
+Probe device information for the given paths (or device, if the -d option is given)."),
   NULL, help_filter, NULL
 };
 
@@ -867,16 +1105,12 @@ main (int argc, char *argv[])
   if (verbosity > 1)
     grub_env_set ("debug", "all");
 
-  /* Obtain ARGUMENT.  */
-  if (arguments.ndevices != 1 && !argument_is_device)
-    {
-      char *program = xstrdup(program_name);
-      fprintf (stderr, _("Unknown extra argument `%s'."), arguments.devices[1]);
-      fprintf (stderr, "\n");
-      argp_help (&argp, stderr, ARGP_HELP_STD_USAGE, program);
-      free (program);
-      exit(1);
-    }
+  if (!probe_cache_file)
+    probe_cache_file = getenv ("GRUB_PROBE_CACHE");
+  if (probe_cache_file && !*probe_cache_file)
+    probe_cache_file = NULL;
+  if (probe_cache_file)
+    probe_cache_load ();
 
   /* Initialize the emulated biosdisk driver.  */
   grub_util_biosdisk_init (arguments.dev_map ? : DEFAULT_DEVICE_MAP);
@@ -904,14 +1138,31 @@ main (int argc, char *argv[])
   if (arguments.zero_delim)
     delim = '\0';
 
-  /* Do it.  */
+  /* Do it.  Several paths are probed one after the other, each with its
+     own line of hints.  */
   if (argument_is_device)
-    probe (NULL, arguments.devices, delim);
+    {
+      probe (NULL, arguments.devices, delim);
+      if (delim == ' ')
+	putchar ('\n');
+    }
   else
-    probe (arguments.devices[0], NULL, delim);
+    {
+      size_t i;
+
+      for (i = 0; i < arguments.ndevices; i++)
+	{
+	  probe (arguments.devices[i], NULL, delim);
+	  if (delim == ' ')
+	    putchar ('\n');
+	}
+    }
 
-  if (delim == ' ')
-    putchar ('\n');
+  if (probe_cache_file)
+    {
+      probe_cache_save ();
+      probe_cache_free ();
+    }
 
   /* Free resources.  */
   grub_gcry_fini_all ();